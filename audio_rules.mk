@@ -16,33 +16,38 @@ $(SONG_BUILDDIR)/%.o: $(SONG_SUBDIR)/%.s
 $(MID_BUILDDIR)/%.o: $(MID_ASM_DIR)/%.s
 	$(AS) $(ASFLAGS) -I sound -o $@ $<
 
-# Compressed cries
-$(CRY_BIN_DIR)/%.bin: $(CRY_SUBDIR)/%.aif 
-	$(AIF) $< $@ --compress
-
-# Uncompressed cries
-$(CRY_BIN_DIR)/uncomp_%.bin: $(CRY_SUBDIR)/uncomp_%.aif 
-	$(AIF) $< $@
-
-# Uncompressed sounds
-$(SOUND_BIN_DIR)/%.bin: sound/%.aif 
-	$(AIF) $< $@
-
-# For each line in midi.cfg, we do some trickery to convert it into a make rule for the `.mid` file described on the line
-# Data following the colon in said file corresponds to arguments passed into mid2agb
+# All samples are converted by one aif2pcm run over a manifest, which skips the samples
+# whose .bin is already newer than their .aif. Cries are compressed, except for uncomp_ ones.
+AIF_SRCS := $(wildcard sound/direct_sound_samples/*.aif sound/direct_sound_samples/*/*.aif)
+AIF_BINS := $(AIF_SRCS:%.aif=%.bin)
+AIF_MANIFEST := sound/direct_sound_samples/aif2pcm.manifest
+AIF_STAMP := sound/direct_sound_samples/aif2pcm.stamp
+AIF_JOBS = $(foreach aif,$(AIF_SRCS),$(aif):$(aif:%.aif=%.bin)$(if $(filter $(CRY_SUBDIR)/%,$(filter-out $(CRY_SUBDIR)/uncomp_%,$(aif))),:--compress))
+
+# The manifest is written by make itself, as the job list is too long for a command line.
+$(AIF_STAMP): $(AIF_SRCS)
+	$(file >$(AIF_MANIFEST))
+	$(foreach job,$(AIF_JOBS),$(file >>$(AIF_MANIFEST),$(subst :, ,$(job))))
+	$(AIF) --manifest $(AIF_MANIFEST)
+	@touch $@
+
+$(AIF_BINS): $(AIF_STAMP) ;
+$(call checkstamp,$(AIF_STAMP),$(AIF_BINS))
+
+# midi.cfg doubles as mid2agb's manifest: each "name.mid: options" line converts name.mid
+# to name.s with those options. Songs are converted by one mid2agb run, which skips
+# those already newer than both their .mid and midi.cfg.
 MID_CFG_PATH := $(MID_SUBDIR)/midi.cfg
+MID_STAMP := $(MID_ASM_DIR)/mid2agb.stamp
+MID_CFG_ASMS := $(patsubst %,$(MID_ASM_DIR)/%.s,$(shell sed -n 's/^\([^ ]*\)\.mid:.*/\1/p' $(MID_CFG_PATH)))
+MID_CFG_ASMS := $(filter $(MID_SRCS:$(MID_SUBDIR)/%.mid=$(MID_ASM_DIR)/%.s),$(MID_CFG_ASMS))
+
+$(MID_STAMP): $(MID_SRCS) $(MID_CFG_PATH)
+	$(MID) -M $(MID_CFG_PATH)
+	@touch $@
 
-# $1: Source path no extension, $2 Options
-define MID_RULE
-$(MID_ASM_DIR)/$1.s: $(MID_SUBDIR)/$1.mid $(MID_CFG_PATH)
-	$(MID) $$< $$@ $2
-endef
-#                            source path,                             remaining text (options)
-define MID_EXPANSION
-	$(eval $(call MID_RULE,$(basename $(patsubst %:,%,$(word 1,$1))),$(wordlist 2,999,$1)))
-endef
-
-$(foreach line,$(shell cat $(MID_CFG_PATH) | sed "s/ /__SPACE__/g"),$(call MID_EXPANSION,$(subst __SPACE__, ,$(line))))
+$(MID_CFG_ASMS): $(MID_STAMP) ;
+$(call checkstamp,$(MID_STAMP),$(MID_CFG_ASMS))
 
 # Warn users building without a .cfg - build will fail at link time
 $(MID_ASM_DIR)/%.s: $(MID_SUBDIR)/%.mid
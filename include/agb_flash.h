@@ -3,6 +3,17 @@
 
 // Exported type declarations
 
+// Flash operations since the last call to ResetSimulatedFlashStats, and
+// roughly how long they would take on the chip being modeled.
+struct SimulatedFlashStats
+{
+    u32 elapsedMicros;
+    u32 bytesProgrammed;
+    u16 sectorsProgrammed;
+    u16 sectorsErased;
+    u16 chipErases;
+};
+
 // Exported RAM declarations
 
 // Exported ROM declarations
@@ -10,5 +21,8 @@
 u16 SetFlashTimerIntr(u8 timerNum, void (**intrFunc)(void));
 u16 IdentifyFlash(void);
 u32 ProgramFlashSectorAndVerify(u16 sectorNum, u8 *src);
+u32 VerifyFlashSectorNBytes(u16 sectorNum, u8 *src, u32 n);
+void ResetSimulatedFlashStats(void);
+const struct SimulatedFlashStats *GetSimulatedFlashStats(void);
 
 #endif //GUARD_AGB_FLASH_H
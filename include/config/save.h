@@ -20,4 +20,7 @@
 
                                             // Grand Total: 3790
 
+// Flash configs
+#define SAVE_FLASH_SIMULATOR                TESTING // Counts flash program and erase operations and models how long they take on the cartridge's chip. See src/agb_flash_sim.c.
+
 #endif // GUARD_CONFIG_SAVE_H
@@ -18,6 +18,13 @@
 #define BERRIES_POCKET     4
 #define POCKETS_COUNT      5
 
+// Keys for SortBagPocket
+#define ITEM_SORT_BY_INDEX  0
+#define ITEM_SORT_BY_NAME   1
+#define ITEM_SORT_BY_TYPE   2
+#define ITEM_SORT_BY_AMOUNT 3
+#define ITEM_SORT_COUNT     4
+
 #define REPEL_LURE_MASK         (1 << 15)
 #define IS_LAST_USED_LURE(var)  (var & REPEL_LURE_MASK)
 #define REPEL_LURE_STEPS(var)   (var & (REPEL_LURE_MASK - 1))
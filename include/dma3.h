@@ -11,6 +11,24 @@
 
 #define DMA3_16BIT 0
 #define DMA3_32BIT 1
+// OR with the mode to queue a transfer that must not be delayed by
+// pending bulk transfers, e.g. to OAM or palette RAM.
+// It still waits behind pending transfers to overlapping memory.
+#define DMA3_PRIORITY (1 << 1)
+
+// Counters for the most recent call to ProcessDma3Requests.
+// Merged and dropped requests are those requested since the previous call.
+// The peak and total are kept since boot, for the debug menu.
+struct Dma3Stats
+{
+    u32 bytesTransferred;
+    u32 bytesDeferred;
+    u32 bytesDropped;
+    u16 requestsMerged;
+    u16 requestsDropped;
+    u32 peakBytesDeferred;
+    u32 totalBytesDropped;
+};
 
 #define Dma3CopyLarge_(src, dest, size, bit)               \
 {                                                          \
@@ -61,12 +79,13 @@ void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 
 // Copy size bytes from src to dest.
-// mode takes a DMA3_*BIT macro
+// mode takes a DMA3_*BIT macro, optionally ORed with DMA3_PRIORITY
+// A copy which continues the previous request is merged into it
 // Returns the request index
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
 
 // Fill size bytes at dest with value.
-// mode takes a DMA3_*BIT macro
+// mode takes a DMA3_*BIT macro, optionally ORed with DMA3_PRIORITY
 // Returns the request index
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 
@@ -76,4 +95,6 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 // Returns -1 if pending, 0 otherwise
 s16 WaitDma3Request(s16 index);
 
+const struct Dma3Stats *GetDma3FrameStats(void);
+
 #endif // GUARD_DMA3_H
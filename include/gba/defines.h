@@ -15,6 +15,7 @@
 #define UNUSED __attribute__((unused))
 
 #define ARM_FUNC __attribute__((target("arm")))
+#define IWRAM_CODE __attribute__((section(".iwram.code"), long_call))
 
 #if MODERN
 #define NOINLINE __attribute__((noinline))
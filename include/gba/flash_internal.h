@@ -69,6 +69,9 @@ void ReadFlash(u16 sectorNum, u32 offset, u8 *dest, u32 size);
 
 u16 WaitForFlashWrite_Common(u8 phase, u8 *addr, u8 lastData);
 
+void UseSimulatedFlash(const struct FlashSetupInfo *chip);
+void SetSimulatedFlashTiming(const struct FlashSetupInfo *chip);
+
 u16 EraseFlashChip_MX(void);
 u16 EraseFlashSector_MX(u16 sectorNum);
 u16 ProgramFlashByte_MX(u16 sectorNum, u32 offset, u8 data);
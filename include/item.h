@@ -84,6 +84,7 @@ void SetBagPocketsPointers(void);
 void ItemPcCompaction(void);
 void RemovePCItem(u16 itemId, u16 quantity);
 void SortAndCompactBagPocket(struct BagPocket * pocket);
+void SortBagPocket(struct BagPocket * pocket, u8 sortKey);
 u8 CountItemsInPC(void);
 bool8 HasAtLeastOneBerry(void);
 bool8 HasAtLeastOnePokeBall(void);
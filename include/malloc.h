@@ -43,18 +43,42 @@ struct MemBlock {
     u8 data[0];
 };
 
+// Arenas are bump allocators for buffers which share a lifetime, e.g.
+// everything a screen allocates between its init and exit. Allocating
+// from an arena never walks the heap's free-list, and the whole arena is
+// released at once with ArenaReset or ArenaDestroy.
+struct Arena
+{
+    u8 *base;
+    u32 size;
+    u32 used;
+};
+
+// Arena allocations are rounded up to a multiple of 4 bytes. Scene arenas
+// should be sized as the sum of ARENA_ALLOC_SIZE of everything they hold.
+#define ARENA_ALLOC_SIZE(size) (((size) + 3) & ~3)
+
 #define HEAP_SIZE 0x1C000
+
+// Size of the scratch arena at the end of gHeap. It is reset at the start
+// of every iteration of AgbMainLoop, so allocations from it must not be
+// kept across frames.
+#define FRAME_ARENA_SIZE 0x800
+
 extern u8 gHeap[];
+extern struct Arena gFrameArena;
 
 #if TESTING || !defined(NDEBUG)
 
 #define Alloc(size) Alloc_(size, __FILE__ ":" STR(__LINE__))
 #define AllocZeroed(size) AllocZeroed_(size, __FILE__ ":" STR(__LINE__))
+#define ArenaCreate(size) ArenaCreate_(size, __FILE__ ":" STR(__LINE__))
 
 #else
 
 #define Alloc(size) Alloc_(size, NULL)
 #define AllocZeroed(size) AllocZeroed_(size, NULL)
+#define ArenaCreate(size) ArenaCreate_(size, NULL)
 
 #endif
 
@@ -63,6 +87,18 @@ void *AllocZeroed_(u32 size, const char *location);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
 
+void InitArena(struct Arena *arena, void *base, u32 size);
+struct Arena *ArenaCreate_(u32 size, const char *location);
+void ArenaDestroy(struct Arena *arena);
+void *ArenaAlloc(struct Arena *arena, u32 size);
+void *ArenaAllocZeroed(struct Arena *arena, u32 size);
+void ArenaReset(struct Arena *arena);
+u32 ArenaMark(const struct Arena *arena);
+void ArenaResetToMark(struct Arena *arena, u32 mark);
+
+#define FrameAlloc(size) ArenaAlloc(&gFrameArena, size)
+#define FrameAllocZeroed(size) ArenaAllocZeroed(&gFrameArena, size)
+
 const struct MemBlock *HeapHead(void);
 const char *MemBlockLocation(const struct MemBlock *block);
 
@@ -79,6 +79,7 @@ extern u32 gPlttBufferTransferPending;
 extern u16 ALIGNED(4) gPlttBufferUnfaded[PLTT_BUFFER_SIZE];
 extern u16 ALIGNED(4) gPlttBufferFaded[PLTT_BUFFER_SIZE];
 
+void MarkPalettesDirty(u32 selectedPalettes);
 void LoadCompressedPalette(const u32 *src, u32 offset, u32 size);
 void LoadPalette(const void *src, u32 offset, u32 size);
 void FillPalette(u32 value, u32 offset, u32 size);
@@ -108,6 +109,21 @@ void TimeBlendPalette(u16 palOffset, u32 coeff, u32 blendColor);
 void TimeMixPalettes(u32, u16 *, u16 *, struct BlendSettings *, struct BlendSettings *, u16);
 void AvgPaletteWeighted(u16 *src0, u16 *src1, u16 *dst, u16 weight0);
 
+// Code writing gPlttBufferFaded directly must mark what it wrote, or
+// TransferPlttBuffer will not upload it.
+static inline void MarkPaletteRangeDirty(u32 offset, u32 numColors)
+{
+    u32 first, last;
+
+    if (numColors == 0)
+        return;
+    first = offset / 16;
+    last = (offset + numColors - 1) / 16;
+    if (last > 31)
+        last = 31;
+    MarkPalettesDirty((((2u << last) - 1) >> first) << first);
+}
+
 static inline void SetBackdropFromColor(u32 color)
 {
   FillPalette(color, 0, PLTT_SIZEOF(1));
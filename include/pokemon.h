@@ -268,6 +268,17 @@ struct BoxPokemon
     } secure;
 };
 
+// A decrypted copy of a BoxPokemon, for reading or writing many fields
+// at once. Changes are written back, encrypted and checksummed, by
+// CommitDecodedBoxMon.
+struct DecodedBoxMon
+{
+    struct BoxPokemon *source;
+    struct BoxPokemon mon;
+    bool8 isValid; // FALSE if the checksum did not match.
+    bool8 isModified;
+};
+
 struct Pokemon
 {
     struct BoxPokemon box;
@@ -617,6 +628,7 @@ void ConvertPokemonToBattleTowerPokemon(struct Pokemon *mon, struct BattleTowerP
 void CalculateMonStats(struct Pokemon *mon);
 void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest);
 u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon);
+u8 GetLevelFromExp(u16 species, u32 exp);
 u16 GiveMoveToMon(struct Pokemon *mon, u16 move);
 u16 GiveMoveToBoxMon(struct BoxPokemon *boxMon, u16 move);
 u16 GiveMoveToBattleMon(struct BattlePokemon *mon, u16 move);
@@ -666,6 +678,11 @@ u32 GetBoxMonData2(struct BoxPokemon *boxMon, s32 field);
 
 void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg);
 void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg);
+u32 GetSubstructIndex(u32 personality, u32 substructType);
+void DecodeBoxMon(struct DecodedBoxMon *decoded, struct BoxPokemon *boxMon);
+u32 GetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, u8 *data);
+void SetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, const void *dataArg);
+void CommitDecodedBoxMon(struct DecodedBoxMon *decoded);
 void CopyMon(void *dest, void *src, size_t size);
 u8 GiveMonToPlayer(struct Pokemon *mon);
 u8 CalculatePlayerPartyCount(void);
@@ -53,11 +53,32 @@ struct PokemonStorage
 
 extern struct PokemonStorage *gPokemonStoragePtr;
 
+// The fields of a boxed mon needed to draw and search a box, cached so
+// that they can be read without decrypting the mon.
+struct BoxMonSummary
+{
+    u16 species;
+    u16 speciesOrEgg;
+    u16 heldItem;
+    // Detects changes made without going through the setters.
+    u16 checksum;
+    u32 personality;
+    u32 otId;
+    u8 level;
+    u8 isEgg:1;
+    u8 isShiny:1;
+    u8 markings:4;
+    u8 padding:2;
+};
+
 u8 *GetBoxNamePtr(u8 boxNumber);
 struct BoxPokemon *GetBoxedMonPtr(u8 boxId, u8 monPosition);
 void SetBoxMonNickAt(u8 boxId, u8 monPosition, const u8 *newNick);
 s16 CompactPartySlots(void);
 u32 GetBoxMonDataAt(u8 boxId, u8 monPosition, s32 request);
+const struct BoxMonSummary *GetBoxMonSummaryAt(u8 boxId, u8 boxPosition);
+void InvalidateBoxMonSummaryAt(u8 boxId, u8 boxPosition);
+void InvalidateBoxMonSummaries(void);
 void ZeroBoxMonAt(u8 boxId, u8 monPosition);
 void CB2_ReturnToPokeStorage(void);
 void ResetPokemonStorageSystem(void);
@@ -73,6 +73,16 @@ struct SaveSector
 #define SECTOR_SIGNATURE_OFFSET offsetof(struct SaveSector, signature)
 #define SECTOR_COUNTER_OFFSET   offsetof(struct SaveSector, counter)
 
+// Sectors of the save slot written or skipped as unchanged by the most
+// recent save, as bitmasks of SECTOR_ID_*.
+struct SaveWriteStats
+{
+    u16 sectorsWritten;
+    u16 sectorsSkipped;
+    u8 numWritten;
+    u8 numSkipped;
+};
+
 // operations for SetDamagedSectorBits
 enum
 {
@@ -103,5 +113,6 @@ u16 GetSaveBlocksPointersBaseOffset(void);
 u32 TryReadSpecialSaveSector(u8 sector, u8 *dst);
 u32 TryWriteSpecialSaveSector(u8 sector, u8 *src);
 void Task_LinkFullSave(u8 taskId);
+const struct SaveWriteStats *GetLastSaveWriteStats(void);
 
 #endif // GUARD_SAVE_H
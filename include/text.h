@@ -68,6 +68,13 @@ struct GlyphInfo
 
 extern struct GlyphInfo gGlyphInfo;
 
+// Glyph cache lookups since the last ClearGlyphCache.
+struct GlyphCacheStats
+{
+    u32 hits;
+    u32 misses;
+};
+
 struct TextPrinterSubStruct
 {
     u8 glyphId:4;  // 0x14
@@ -163,6 +170,9 @@ void RestoreTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor);
 void DecompressGlyphTile(const u16 *src, u16 *dest);
 u8 GetLastTextColor(u8 colorType);
 void CopyGlyphToWindow(struct TextPrinter *x);
+void ClearGlyphCache(void);
+const struct GlyphCacheStats *GetGlyphCacheStats(void);
+void SetGlyphCacheEnabled(bool32 enabled);
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width);
 
 void TextPrinterInitDownArrowCounters(struct TextPrinter *textPrinter);
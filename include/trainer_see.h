@@ -16,6 +16,8 @@ extern bool8 gTrainerApproachedPlayer;
 extern u8 gApproachingTrainerId;
 
 bool8 CheckForTrainersWantingBattle(void);
+void UpdateTrainerSight(struct ObjectEvent *objectEvent);
+u32 GetTrainersWhoMaySeeCoords(s16 x, s16 y);
 void MovementAction_RevealTrainer_RunTrainerSeeFuncList(struct ObjectEvent *var);
 u8 GetCurrentApproachingTrainerObjectEventId(void);
 u8 GetChosenApproachingTrainerObjectEventId(u8 arrayId);
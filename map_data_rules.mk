@@ -12,21 +12,39 @@ INCLUDECONSTS_OUTDIR := include/constants
 AUTO_GEN_TARGETS += $(INCLUDECONSTS_OUTDIR)/map_groups.h
 AUTO_GEN_TARGETS += $(INCLUDECONSTS_OUTDIR)/layouts.h
 
-MAP_DIRS := $(dir $(wildcard $(MAPS_DIR)/*/map.json))
+# The maps are the ones listed in map_groups.json, as those are the ones mapjson generates.
+MAP_NAMES := $(shell sed -n '/"group_order"/,/]/d; s/^ *"\([^"]*\)",\{0,1\}$$/\1/p' $(MAPS_DIR)/map_groups.json)
+MAP_DIRS := $(MAP_NAMES:%=$(MAPS_DIR)/%/)
 MAP_CONNECTIONS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/connections.inc,$(MAP_DIRS))
 MAP_EVENTS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/events.inc,$(MAP_DIRS))
 MAP_HEADERS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/header.inc,$(MAP_DIRS))
 
 $(DATA_ASM_BUILDDIR)/maps.o: $(DATA_ASM_SUBDIR)/maps.s $(LAYOUTS_DIR)/layouts.inc $(LAYOUTS_DIR)/layouts_table.inc $(MAPS_DIR)/headers.inc $(MAPS_DIR)/groups.inc $(MAPS_DIR)/connections.inc $(MAP_CONNECTIONS) $(MAP_HEADERS)
-	$(PREPROC) $< charmap.txt | $(CPP) -I include - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
+	$(PREPROC) -c $(CHARMAP_CACHE) $< charmap.txt | $(CPP) -I include - | $(PREPROC) -c $(CHARMAP_CACHE) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
 $(DATA_ASM_BUILDDIR)/map_events.o: $(DATA_ASM_SUBDIR)/map_events.s $(MAPS_DIR)/events.inc $(MAP_EVENTS)
-	$(PREPROC) $< charmap.txt | $(CPP) -I include - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
+	$(PREPROC) -c $(CHARMAP_CACHE) $< charmap.txt | $(CPP) -I include - | $(PREPROC) -c $(CHARMAP_CACHE) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
 
-$(MAPS_OUTDIR)/%/header.inc $(MAPS_OUTDIR)/%/events.inc $(MAPS_OUTDIR)/%/connections.inc: $(MAPS_DIR)/%/map.json
-	$(MAPJSON) map firered $< $(LAYOUTS_DIR)/layouts.json $(@D)
+# All maps are generated by one mapjson run, which leaves unchanged outputs
+# alone so that maps.o and map_events.o are only reassembled when needed.
+$(MAPS_OUTDIR)/maps.stamp: $(MAPS_DIR)/map_groups.json $(LAYOUTS_DIR)/layouts.json $(MAP_DIRS:%=%map.json)
+	$(MAPJSON) maps-all firered $< $(LAYOUTS_DIR)/layouts.json $(MAPS_OUTDIR)
+	@touch $@
 
-$(MAPS_OUTDIR)/connections.inc $(MAPS_OUTDIR)/groups.inc $(MAPS_OUTDIR)/events.inc $(MAPS_OUTDIR)/headers.inc $(INCLUDECONSTS_OUTDIR)/map_groups.h $(DATA_SRC_SUBDIR)/map_group_count.h: $(MAPS_DIR)/map_groups.json
+$(MAP_CONNECTIONS) $(MAP_EVENTS) $(MAP_HEADERS): $(MAPS_OUTDIR)/maps.stamp ;
+$(call checkstamp,$(MAPS_OUTDIR)/maps.stamp,$(MAP_CONNECTIONS) $(MAP_EVENTS) $(MAP_HEADERS))
+
+# mapjson leaves unchanged outputs alone, so the groups and layouts runs are
+# recorded by stamps too. map_groups.h takes the map ids from each map.json.
+$(MAPS_OUTDIR)/groups.stamp: $(MAPS_DIR)/map_groups.json $(MAP_DIRS:%=%map.json)
 	$(MAPJSON) groups firered $< $(MAPS_OUTDIR) $(INCLUDECONSTS_OUTDIR)
+	@touch $@
+
+$(MAPS_OUTDIR)/connections.inc $(MAPS_OUTDIR)/groups.inc $(MAPS_OUTDIR)/events.inc $(MAPS_OUTDIR)/headers.inc $(INCLUDECONSTS_OUTDIR)/map_groups.h $(DATA_SRC_SUBDIR)/map_group_count.h: $(MAPS_OUTDIR)/groups.stamp ;
+$(call checkstamp,$(MAPS_OUTDIR)/groups.stamp,$(MAPS_OUTDIR)/connections.inc $(MAPS_OUTDIR)/groups.inc $(MAPS_OUTDIR)/events.inc $(MAPS_OUTDIR)/headers.inc $(INCLUDECONSTS_OUTDIR)/map_groups.h $(DATA_SRC_SUBDIR)/map_group_count.h)
 
-$(LAYOUTS_OUTDIR)/layouts.inc $(LAYOUTS_OUTDIR)/layouts_table.inc $(INCLUDECONSTS_OUTDIR)/layouts.h: $(LAYOUTS_DIR)/layouts.json
+$(LAYOUTS_OUTDIR)/layouts.stamp: $(LAYOUTS_DIR)/layouts.json
 	$(MAPJSON) layouts firered $< $(LAYOUTS_OUTDIR) $(INCLUDECONSTS_OUTDIR)
+	@touch $@
+
+$(LAYOUTS_OUTDIR)/layouts.inc $(LAYOUTS_OUTDIR)/layouts_table.inc $(INCLUDECONSTS_OUTDIR)/layouts.h: $(LAYOUTS_OUTDIR)/layouts.stamp ;
+$(call checkstamp,$(LAYOUTS_OUTDIR)/layouts.stamp,$(LAYOUTS_OUTDIR)/layouts.inc $(LAYOUTS_OUTDIR)/layouts_table.inc $(INCLUDECONSTS_OUTDIR)/layouts.h)
@@ -1,5 +1,6 @@
 #include "gba/gba.h"
 #include "gba/flash_internal.h"
+#include "config/save.h"
 
 static const char AgbLibFlashVersion[] = "FLASH1M_V103";
 
@@ -45,6 +46,11 @@ u16 IdentifyFlash(void)
     gFlashMaxTime = (*setupInfo)->maxTime;
     gFlash = &(*setupInfo)->type;
 
+#if SAVE_FLASH_SIMULATOR
+    if (result == 0)
+        UseSimulatedFlash(*setupInfo);
+#endif
+
     return result;
 }
 
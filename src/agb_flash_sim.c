@@ -0,0 +1,105 @@
+#include "global.h"
+#include "gba/flash_internal.h"
+#include "agb_flash.h"
+
+#if SAVE_FLASH_SIMULATOR
+
+// The simulator sits between the save code and the chip's driver. The data
+// still goes to the cartridge (or the emulator's copy of it), as there is no
+// room in RAM for all 128 KiB, but every program and erase is counted and
+// charged the time it would take on the chip being modeled.
+
+// Approximate typical times, in microseconds. The maxTime tables only bound
+// how long the driver waits before giving up on an operation.
+struct FlashTiming
+{
+    u32 programByte;
+    u32 eraseSector;
+    u32 eraseChip;
+};
+
+static const struct FlashTiming sFlashTiming_MX29L010 =
+{
+    .programByte = 20,
+    .eraseSector = 25000,
+    .eraseChip = 500000,
+};
+
+static const struct FlashTiming sFlashTiming_LE26FV10N1TS =
+{
+    .programByte = 30,
+    .eraseSector = 10000,
+    .eraseChip = 100000,
+};
+
+static const struct FlashSetupInfo *sFlashSimChip;
+static const struct FlashTiming *sFlashSimTiming;
+static struct SimulatedFlashStats sFlashSimStats;
+
+static u16 ProgramFlashByte_Sim(u16 sectorNum, u32 offset, u8 data)
+{
+    sFlashSimStats.bytesProgrammed++;
+    sFlashSimStats.elapsedMicros += sFlashSimTiming->programByte;
+    return sFlashSimChip->programFlashByte(sectorNum, offset, data);
+}
+
+// Programming a sector erases it first.
+static u16 ProgramFlashSector_Sim(u16 sectorNum, u8 *src)
+{
+    sFlashSimStats.sectorsErased++;
+    sFlashSimStats.sectorsProgrammed++;
+    sFlashSimStats.bytesProgrammed += gFlash->sector.size;
+    sFlashSimStats.elapsedMicros += sFlashSimTiming->eraseSector + gFlash->sector.size * sFlashSimTiming->programByte;
+    return sFlashSimChip->programFlashSector(sectorNum, src);
+}
+
+static u16 EraseFlashChip_Sim(void)
+{
+    sFlashSimStats.chipErases++;
+    sFlashSimStats.elapsedMicros += sFlashSimTiming->eraseChip;
+    return sFlashSimChip->eraseFlashChip();
+}
+
+static u16 EraseFlashSector_Sim(u16 sectorNum)
+{
+    sFlashSimStats.sectorsErased++;
+    sFlashSimStats.elapsedMicros += sFlashSimTiming->eraseSector;
+    return sFlashSimChip->eraseFlashSector(sectorNum);
+}
+
+void UseSimulatedFlash(const struct FlashSetupInfo *chip)
+{
+    sFlashSimChip = chip;
+    SetSimulatedFlashTiming(chip);
+    ResetSimulatedFlashStats();
+
+    ProgramFlashByte = ProgramFlashByte_Sim;
+    ProgramFlashSector = ProgramFlashSector_Sim;
+    EraseFlashChip = EraseFlashChip_Sim;
+    EraseFlashSector = EraseFlashSector_Sim;
+}
+
+// Models the timings of another chip, without changing the driver in use.
+// NULL goes back to the timings of the chip in use.
+void SetSimulatedFlashTiming(const struct FlashSetupInfo *chip)
+{
+    if (chip == NULL)
+        chip = sFlashSimChip;
+
+    if (chip == &LE26FV10N1TS)
+        sFlashSimTiming = &sFlashTiming_LE26FV10N1TS;
+    else
+        sFlashSimTiming = &sFlashTiming_MX29L010;
+}
+
+void ResetSimulatedFlashStats(void)
+{
+    sFlashSimStats = (struct SimulatedFlashStats){0};
+}
+
+const struct SimulatedFlashStats *GetSimulatedFlashStats(void)
+{
+    return &sFlashSimStats;
+}
+
+#endif // SAVE_FLASH_SIMULATOR
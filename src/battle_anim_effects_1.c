@@ -5357,6 +5357,7 @@ static void AnimProtect_Step(struct Sprite *sprite)
         }
 
         gPlttBufferFaded[sprite->data[2] + 7] = savedPal;
+        MarkPaletteRangeDirty(sprite->data[2] + 1, 7);
     }
 
     if (sprite->data[7] > 6 && sprite->data[0] >0 && ++sprite->data[6] > 1)
@@ -6428,6 +6429,7 @@ static void AnimTask_MoonlightEndFade_Step(u8 taskId)
 
             bitmask = 1;
             r3 = 0;
+            MarkPalettesDirty(task->data[3] & 0xFFFF);
             for (i = 0; i <= 15; i++)
             {
                 if (task->data[3] & bitmask)
@@ -6903,6 +6905,7 @@ void AnimTask_MusicNotesRainbowBlend(u8 taskId)
         index = OBJ_PLTT_ID(index);
         for (i = 1; i < ARRAY_COUNT(gParticlesColorBlendTable[0]); i++)
             gPlttBufferFaded[index + i] = gParticlesColorBlendTable[0][i];
+        MarkPaletteRangeDirty(index, 16);
     }
 
     for (j = 1; j < ARRAY_COUNT(gParticlesColorBlendTable); j++)
@@ -6913,6 +6916,7 @@ void AnimTask_MusicNotesRainbowBlend(u8 taskId)
             index = OBJ_PLTT_ID(index);
             for (i = 1; i < ARRAY_COUNT(gParticlesColorBlendTable[0]); i++)
                 gPlttBufferFaded[index + i] = gParticlesColorBlendTable[j][i];
+            MarkPaletteRangeDirty(index, 16);
         }
     }
     DestroyAnimVisualTask(taskId);
@@ -1531,6 +1531,7 @@ static void SetPsychicBackground_Step(u8 taskId)
 
         gPlttBufferFaded[BG_PLTT_ID(paletteIndex) + 1] = lastColor;
         gTasks[taskId].data[5] = 0;
+        MarkPaletteRangeDirty(BG_PLTT_ID(paletteIndex) + 1, 11);
     }
 
     if ((u16)gBattleAnimArgs[7] == 0xFFFF)
@@ -1555,6 +1556,7 @@ static void FadeScreenToWhite_Step(u8 taskId)
         for (i = 10; i > 0; i--)
             gPlttBufferFaded[BG_PLTT_ID(paletteIndex) + i + 1] = gPlttBufferFaded[BG_PLTT_ID(paletteIndex) + i];
         gPlttBufferFaded[BG_PLTT_ID(paletteIndex) + 1] = lastColor;
+        MarkPaletteRangeDirty(BG_PLTT_ID(paletteIndex) + 1, 11);
 
         lastColor = gPlttBufferUnfaded[BG_PLTT_ID(paletteIndex) + 11];
         for (i = 10; i > 0; i--)
@@ -418,6 +418,7 @@ static void AnimTask_AnimateGustTornadoPalette_Step(u8 taskId)
         } while (i > 0);
 
         gPlttBufferFaded[base + OBJ_PLTT_OFFSET + 1] = temp;
+        MarkPaletteRangeDirty(base + OBJ_PLTT_OFFSET + 1, 8);
     }
 
     if (--gTasks[taskId].data[0] == 0)
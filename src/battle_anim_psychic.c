@@ -657,6 +657,7 @@ static void AnimDefensiveWall_Step3(struct Sprite *sprite)
             gPlttBufferFaded[startOffset + i] = gPlttBufferFaded[startOffset + i - 1];
 
         gPlttBufferFaded[startOffset + 1] = color;
+        MarkPaletteRangeDirty(startOffset + 1, 8);
 
         if (++sprite->data[2] == 16)
             sprite->callback = AnimDefensiveWall_Step4;
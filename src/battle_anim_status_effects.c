@@ -475,6 +475,7 @@ static void AnimTask_FrozenIceCube_Step2(u8 taskId)
             gPlttBufferFaded[OBJ_PLTT_ID(palIndex) + 13] = gPlttBufferFaded[OBJ_PLTT_ID(palIndex) + 14];
             gPlttBufferFaded[OBJ_PLTT_ID(palIndex) + 14] = gPlttBufferFaded[OBJ_PLTT_ID(palIndex) + 15];
             gPlttBufferFaded[OBJ_PLTT_ID(palIndex) + 15] = temp;
+            MarkPaletteRangeDirty(OBJ_PLTT_ID(palIndex) + 13, 3);
 
             gTasks[taskId].data[2] = 0;
             gTasks[taskId].data[3]++;
@@ -701,6 +701,7 @@ static void SetPalettesToColor(u32 selectedPalettes, u16 color)
 {
     u16 i;
 
+    MarkPalettesDirty(selectedPalettes);
     for (i = 0; i < 32; i++)
     {
         if (selectedPalettes & 1)
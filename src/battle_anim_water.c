@@ -815,6 +815,7 @@ static void AnimTask_RotateAuroraRingColors_Step(u8 taskId)
         for (i = 1; i < 8; i++)
             gPlttBufferFaded[palIndex + i - 1] = gPlttBufferFaded[palIndex + i];
         gPlttBufferFaded[palIndex + 7] = rgbBuffer;
+        MarkPaletteRangeDirty(palIndex, 8);
     }
     if (++gTasks[taskId].data[11] == gTasks[taskId].data[0])
         DestroyAnimVisualTask(taskId);
@@ -1105,6 +1106,7 @@ static void AnimTask_CreateSurfWave_Step1(u8 taskId)
             gPlttBufferFaded[BG_PLTT_ID(animBg.paletteId) + 1 + i] = gPlttBufferFaded[BG_PLTT_ID(animBg.paletteId) + 1 + i - 1]; // 1 + i - 1 is needed to match for some bizarre reason
         }
         gPlttBufferFaded[BG_PLTT_ID(animBg.paletteId) + 1] = rgbBuffer;
+        MarkPaletteRangeDirty(BG_PLTT_ID(animBg.paletteId) + 1, 7);
         gTasks[taskId].data[5] = 0;
     }
     if (++gTasks[taskId].data[6] > 1)
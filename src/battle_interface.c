@@ -2971,6 +2971,7 @@ void ArrowsChangeColorLastBallCycle(bool32 showArrows)
         pltOutline->g = defaultPlttOutline->g;
         pltOutline->b = defaultPlttOutline->b;
     }
+    MarkPaletteRangeDirty(paletteNum + 8, 2);
 #endif
 }
 
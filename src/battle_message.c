@@ -4039,6 +4039,7 @@ void SetPpNumbersPaletteInMoveSelection(u32 battler)
 
     CpuCopy16(&gPlttBufferUnfaded[BG_PLTT_ID(5) + 12], &gPlttBufferFaded[BG_PLTT_ID(5) + 12], PLTT_SIZEOF(1));
     CpuCopy16(&gPlttBufferUnfaded[BG_PLTT_ID(5) + 11], &gPlttBufferFaded[BG_PLTT_ID(5) + 11], PLTT_SIZEOF(1));
+    MarkPaletteRangeDirty(BG_PLTT_ID(5) + 11, 2);
 }
 
 u8 GetCurrentPpToMaxPpState(u8 currentPp, u8 maxPp)
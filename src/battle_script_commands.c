@@ -15728,6 +15728,7 @@ static void Cmd_displaydexinfo(void)
             struct Pokemon *mon = &gEnemyParty[gBattlerPartyIndexes[GetCatchingBattler()]];
             CreateMonPicSprite(species, GetMonData(mon, MON_DATA_IS_SHINY), GetMonData(mon, MON_DATA_PERSONALITY), TRUE, 120, 64, 0, 0xFFFF);
             CpuFill32(0, gPlttBufferFaded, BG_PLTT_SIZE);
+            MarkPalettesDirty(PALETTES_BG);
             BeginNormalPaletteFade(0x1FFFF, 0, 16, 0, RGB_BLACK);
             ShowBg(0);
             ShowBg(3);
@@ -57,6 +57,12 @@ struct BerryPouchStruct_203F370
     u16 listMenuScrollOffset;
 };
 
+// Everything the pouch allocates while it is open comes from one scene arena,
+// which is released as a whole when it closes.
+#define BERRY_POUCH_ARENA_SIZE (ARENA_ALLOC_SIZE(sizeof(struct BerryPouchStruct_203F36C))                              \
+                              + ARENA_ALLOC_SIZE((LAST_BERRY_INDEX - FIRST_BERRY_INDEX) * sizeof(struct ListMenuItem)) \
+                              + ARENA_ALLOC_SIZE(BAG_BERRIES_COUNT * 27))
+
 enum
 {
     BP_ACTION_USE = 0,
@@ -70,6 +76,7 @@ static EWRAM_DATA struct BerryPouchStruct_203F36C *sResources = NULL;
 static EWRAM_DATA struct BerryPouchStruct_203F370 sStaticCnt = {};
 static EWRAM_DATA struct ListMenuItem *sListMenuItems = NULL;
 static EWRAM_DATA u8 * sListMenuStrbuf = NULL;
+static EWRAM_DATA struct Arena *sArena = NULL;
 static EWRAM_DATA const u8 * sContextMenuOptions = NULL;
 static EWRAM_DATA u8 sContextMenuNumOptions = 0;
 static ALIGNED(4) EWRAM_DATA u8 sVariableWindowIds[14] = {};
@@ -424,13 +431,14 @@ void InitBerryPouch(u8 type, void (*savedCallback)(void), u8 allowSelect)
 {
     u8 i;
 
-    sResources = Alloc(sizeof(struct BerryPouchStruct_203F36C));
-    if (sResources == NULL)
+    sArena = ArenaCreate(BERRY_POUCH_ARENA_SIZE);
+    if (sArena == NULL)
     {
         SetMainCallback2(savedCallback);
     }
     else
     {
+        sResources = ArenaAlloc(sArena, sizeof(struct BerryPouchStruct_203F36C));
         if (type != BERRYPOUCH_NA)
             sStaticCnt.type = type;
         if (allowSelect != 0xFF)
@@ -649,10 +657,10 @@ static bool8 BerryPouchLoadGfx(void)
 
 static bool8 AllocateListMenuBuffers(void)
 {
-    sListMenuItems = Alloc((LAST_BERRY_INDEX - FIRST_BERRY_INDEX) * sizeof(struct ListMenuItem));
+    sListMenuItems = ArenaAlloc(sArena, (LAST_BERRY_INDEX - FIRST_BERRY_INDEX) * sizeof(struct ListMenuItem));
     if (sListMenuItems == NULL)
         return FALSE;
-    sListMenuStrbuf = Alloc(sResources->listMenuNumItems * 27);
+    sListMenuStrbuf = ArenaAlloc(sArena, sResources->listMenuNumItems * 27);
     if (sListMenuStrbuf == NULL)
         return FALSE;
     return TRUE;
@@ -857,12 +865,9 @@ static void UpdateListMenuScrollOffset(void)
 
 static void BerryPouch_DestroyResources(void)
 {
-    if (sResources != NULL)
-        Free(sResources);
-    if (sListMenuItems != NULL)
-        Free(sListMenuItems);
-    if (sListMenuStrbuf != NULL)
-        Free(sListMenuStrbuf);
+    if (sArena != NULL)
+        ArenaDestroy(sArena);
+    sArena = NULL;
     FreeAllWindowBuffers();
 }
 
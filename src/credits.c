@@ -805,6 +805,7 @@ static bool32 DoOverworldMapScrollScene(u8 whichMon)
         Menu_LoadStdPalAt(BG_PLTT_ID(15));
         gPlttBufferUnfaded[BG_PLTT_ID(15) + 15] = RGB_BLACK;
         gPlttBufferFaded[BG_PLTT_ID(15) + 15] = RGB_BLACK;
+        MarkPaletteRangeDirty(BG_PLTT_ID(15) + 15, 1);
         return TRUE;
     default:
         return FALSE;
@@ -829,6 +830,7 @@ static s32 RollCredits(void)
         Menu_LoadStdPalAt(BG_PLTT_ID(15));
         gPlttBufferUnfaded[BG_PLTT_ID(15) + 15] = RGB_BLACK;
         gPlttBufferFaded[BG_PLTT_ID(15) + 15] = RGB_BLACK;
+        MarkPaletteRangeDirty(BG_PLTT_ID(15) + 15, 1);
         sCreditsMgr->mainseqno = CREDITSSCENE_OPEN_WIN0;
         return 0;
     case CREDITSSCENE_OPEN_WIN0:
@@ -1 +1,746 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from src/data/trainers.party
+//
 
+extern const struct TrainerMon gTrainerParty_TRAINER_AQUA_LEADER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AQUA_GRUNT_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AQUA_GRUNT_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_AROMA_LADY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_RUIN_MANIAC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_INTERVIEWER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_TUBER_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_TUBER_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_COOLTRAINER_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_COOLTRAINER_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HEX_MANIAC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_LADY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_BEAUTY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RICH_BOY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_POKEMANIAC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_SWIMMER_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_BLACK_BELT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GUITARIST[];
+extern const struct TrainerMon gTrainerParty_TRAINER_KINDLER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_CAMPER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_MANIAC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_PSYCHIC_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_PSYCHIC_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_GENTLEMAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_SIDNEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_PHOEBE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_ROXANNE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_BRAWLY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_TATE_LIZA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCHOOL_KID_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCHOOL_KID_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SR_AND_JR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEFAN_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEFAN_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_EXPERT_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_EXPERT_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_YOUNGSTER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_CHAMPION[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_FISHERMAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CYCLING_TRIATHLETE_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CYCLING_TRIATHLETE_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUNNING_TRIATHLETE_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUNNING_TRIATHLETE_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMING_TRIATHLETE_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMING_TRIATHLETE_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_DRAGON_TAMER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_BIRD_KEEPER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_NINJA_BOY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BATTLE_GIRL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PARASOL_LADY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_SWIMMER_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_PICNICKER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_TWINS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_SAILOR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BOARDER_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BOARDER_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COLLECTOR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_WALLY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BRENDAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BRENDAN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BRENDAN_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAY_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_PKMN_BREEDER_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_PKMN_BREEDER_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_PKMN_RANGER_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_PKMN_RANGER_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAGMA_LEADER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAGMA_GRUNT_M[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAMGA_GRUNT_F[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_LASS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_BUG_CATCHER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_HIKER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_YOUNG_COUPLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_OLD_COUPLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RS_SIS_AND_BRO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AQUA_ADMIN_MATT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AQUA_ADMIN_SHELLY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAGMA_ADMIN_TABITHA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_MAGMA_ADMIN_COURTNEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_WATTSON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_FLANNERY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_NORMAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_WINONA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_WALLACE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_GLACIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_DRAKE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_BEN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_CALVIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_JOSH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_TIMMY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_JOEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_DAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_CHAD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_TYLER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_EDDIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_DILLON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_YASU[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_DAVE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_BEN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_RICK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_DOUG[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_SAMMY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_COLTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_GREG[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_JAMES[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_KENT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_ROBBY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_CALE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_KEIGO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_ELIJAH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_BRENT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_CONNER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_JANICE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_SALLY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_ROBIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_CRISSY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_MIRIAM[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_IRIS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_RELI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_ALI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_HALEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_ANN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_DAWN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_PAIGE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_ANDREA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_MEGAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_JULIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_KAY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_LISA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_EDMOND[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_TREVOR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_LEONARD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_DUNCAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_HUEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_DYLAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_PHILLIP[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SAILOR_DWAYNE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_LIAM[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_SHANE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_ETHAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_RICKY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_JEFF[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_CHRIS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_DREW[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_DIANA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_NANCY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ISABELLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_KELSEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ALICIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_CAITLIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_HEIDI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_CAROL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_SOFIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_MARTHA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_TINA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_HANNAH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_MARK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_HERMAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_COOPER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_STEVE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_WINSTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_DAWSON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_ASHTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_JOVAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_MIGUEL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_AIDAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_GLENN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_LESLIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_1[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_ERIK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_AVERY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_DEREK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_ZAC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_MARCOS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_FRANKLIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_NOB[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_WAYNE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_ALAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_BRICE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_CLARK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_TRENT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_DUDLEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_ALLEN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_ERIC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_LENNY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_OLIVER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_LUCAS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_JARED[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_MALIK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_ERNEST[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_ALEX[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_LAO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_1[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_HIDEO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_RUBEN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_BILLY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_NIKOLAS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_JAXON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_WILLIAM[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_LUKAS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_ISAAC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_GERALD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_1[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_QUINN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_RAMON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_DUSTY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_ARNIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_SIMON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BURGLAR_LEWIS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ENGINEER_BAILY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ENGINEER_BRAXTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ENGINEER_BERNIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_DALE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_BARNY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_NED[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_CHIP[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_HANK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_ELLIOT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_RONALD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_CLAUDE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_WADE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_NOLAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_ANDREW[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_LUIS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_RICHARD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_REECE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_MATTHEW[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_DOUGLAS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_DAVID[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_TONY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_AXLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_BARRY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_DEAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_DARRIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_SPENCER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_JACK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_JEROME[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_ROLAND[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_KOJI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_LUKE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_CAMRON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_RAUL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_ISAIAH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_ZEEK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_JAMAL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_COREY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_CHASE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_HUGO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_JASPER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_DIRK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_DARIAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_STAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_1[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_RICH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_BRIDGET[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_TAMIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_LORI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_LOLA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_SHEILA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_TIFFANY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_NORA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_MELISSA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_GRACE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_OLIVIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_LAUREN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_ANYA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_ALICE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_CONNIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_SHIRLEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_JOHAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_TYRON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_CAMERON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_PRESTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ROCKER_RANDALL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ROCKER_LUCA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_DALTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_NELSON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_KIRK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_SHAWN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_GREGORY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_EDWARD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_KAYDEN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_NATE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_PHIL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_EDGAR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_JASON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_COLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_VINCENT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_JOHN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_SEBASTIAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_PERRY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_ROBERT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_DONALD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_BENNY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_EDWIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_CHESTER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_WILTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_RAMIRO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_JACOB[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_ROGER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_REED[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_KEITH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_CARTER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_MITCH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_BECK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_MARLON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_KOICHI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_MIKE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_HIDEKI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_AARON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_HITOSHI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_ATSUSHI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_KIYO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_TAKASHI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_DAISUKE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_OAKS_LAB_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_OAKS_LAB_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_OAKS_LAB_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_ROUTE22_EARLY_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_ROUTE22_EARLY_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_ROUTE22_EARLY_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_CERULEAN_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_CERULEAN_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_CERULEAN_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_TED[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_CONNOR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_JERRY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_JOSE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_RODNEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_BEAU[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_TAYLOR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_JOSHUA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_PARKER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_ED[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_TRAVIS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_BRAYDON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_IVAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BOSS_GIOVANNI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BOSS_GIOVANNI_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_GIOVANNI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_5[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_6[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_7[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_8[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_9[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_10[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_11[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_12[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_13[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_14[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_15[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_16[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_17[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_18[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_19[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_20[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_21[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_22[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_23[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_24[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_25[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_26[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_27[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_28[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_29[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_30[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_31[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_32[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_33[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_34[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_35[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_36[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_37[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_38[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_39[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_40[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_41[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_SAMUEL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_GEORGE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_COLBY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_PAUL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_ROLANDO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_GILBERT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_OWEN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_BERKE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_YUJI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_WARREN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_MARY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_CAROLINE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_ALEXA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_SHANNON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_NAOMI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_BROOKE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_AUSTINA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_JULIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_LORELEI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_BRUNO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_AGATHA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_LANCE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_BROCK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_MISTY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_LT_SURGE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_ERIKA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_KOGA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_BLAINE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LEADER_SABRINA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_THOMAS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_ARTHUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_TUCKER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_NORTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_WALTER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_SS_ANNE_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_SS_ANNE_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_SS_ANNE_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_POKEMON_TOWER_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_POKEMON_TOWER_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_POKEMON_TOWER_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_SILPH_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_SILPH_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_SILPH_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_ROUTE22_LATE_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_ROUTE22_LATE_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RIVAL_ROUTE22_LATE_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHAMPION_FIRST_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHAMPION_FIRST_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHAMPION_FIRST_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_PATRICIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_CARLY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_HOPE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_PAULA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_LAUREL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_JODY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_TAMMY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_RUTH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_KARINA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_JANAE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_ANGELICA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_EMILIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_JENNIFER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_1[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_5[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_6[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_7[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_8[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_AMANDA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_STACY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHANNELER_TASHA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_JEREMY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ALMA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_SUSIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_VALERIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_GWEN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_VIRGIL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_FLINT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_MISSY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_IRENE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_DANA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ARIANA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_LEAH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_JUSTIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_YAZMIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_KINDRA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_BECKY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_CELIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_BROOKS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_LAMAR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TWINS_ELI_ANNE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOL_COUPLE_RAY_TYRA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNG_COUPLE_GIA_JES[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TWINS_KIRI_JAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNG_COUPLE_LEA_JED[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SIS_AND_BRO_LIA_LUC[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SIS_AND_BRO_LIL_IAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_5[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_6[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_7[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_8[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_BEN_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_BEN_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_CHAD_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_RELI_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_RELI_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_TIMMY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_TIMMY_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_TIMMY_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_CHAD_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_JANICE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_JANICE_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_CHAD_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_FRANKLIN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_PROF_PROF_OAK[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PLAYER_BRENDAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PLAYER_MAY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PLAYER_RED[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PLAYER_LEAF[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_42[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_JACLYN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_SHARON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TUBER_AMIRA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_BREEDER_ALIZE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_NICOLAS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_MADELINE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AROMA_LADY_NIKKI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_STANLY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LADY_JACKI[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PAINTER_DAISY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_GOON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_GOON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_GOON_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_ANTHONY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_CHARLIE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TWINS_ELI_ANNE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_JOHNSON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_RICARDO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_JAREN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_43[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_44[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_45[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_46[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_47[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_48[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_ADMIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_ADMIN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SCIENTIST_GIDEON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_AMARA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_MARIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_ABIGAIL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_FINN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_GARRETT[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_TOMMY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_TANYA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_SHEA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_HUGH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_BRYCE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_CLAIRE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_KIN_MIK_KIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AROMA_LADY_VIOLET[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TUBER_ALEXIS[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TWINS_JOY_MEG[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_TISHA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PAINTER_CELINA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PAINTER_RAYNA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LADY_GILLIAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_DESTIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_TOBY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_49[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_50[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_51[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_MILO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_CHAZ[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_HAROLD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_TYLOR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_MYMO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_NICOLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SIS_AND_BRO_AVA_GEB[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AROMA_LADY_ROSE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_SAMIR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_DENISE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TWINS_MIU_MIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_EARL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_FOSTER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_LARRY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_DARYL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_HECTOR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_DARIO[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_RODETTE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_AROMA_LADY_MIAH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNG_COUPLE_EVE_JON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_MASON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_CYNDY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_JOCELYN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_EVAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_MARK_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_LOGAN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_JACKSON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_BETH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_KATELYN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_LEROY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_MICHELLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOL_COUPLE_LEX_NYA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_BRANDON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_BENJAMIN[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PAINTER_EDNA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GENTLEMAN_CLIFFORD[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LADY_SELPHY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_LAWSON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_LAURA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_BREEDER_BETHANY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_BREEDER_ALLISON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_GARRET[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_JONAH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_VANCE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_NASH[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_CORDELL[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_DALIA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_JOANA[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_RILEY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_MARCY[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_LAYTON[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_KELSEY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_KELSEY_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_KELSEY_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_RICKY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_RICKY_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_RICKY_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_JEFF_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_JEFF_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_JEFF_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ISABELLE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ISABELLE_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ISABELLE_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_YASU_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_YASU_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ENGINEER_BERNIE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_DARIAN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_CHRIS_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_CHRIS_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CAMPER_CHRIS_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ALICIA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ALICIA_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_ALICIA_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_JEREMY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_MARK_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_HERMAN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_HERMAN_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_TRENT_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_MEGAN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_LASS_MEGAN_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SUPER_NERD_GLENN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_GAMER_RICH_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_JAREN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_ELLIOT_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ROCKER_LUCA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_SHEILA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_ROBERT_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_ROBERT_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_SUSIE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_SUSIE_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_SUSIE_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_LUKAS_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_BENNY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_BENNY_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_MARLON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_MARLON_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BEAUTY_GRACE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_CHESTER_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_CHESTER_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_BECKY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_BECKY_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_BECKY_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_RUBEN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_CAMRON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIKER_JAXON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_ISAIAH_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_COREY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_JACOB_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_JACOB_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_ALICE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_DARRIN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_MISSY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PICNICKER_MISSY_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_FISHERMAN_WADE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_JACK_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SIS_AND_BRO_LIL_IAN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SIS_AND_BRO_LIL_IAN_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_FINN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_SHARON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_SHARON_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_TANYA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_TANYA_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_SHEA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_SHEA_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_HUGH_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BLACK_BELT_HUGH_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_KIN_MIK_KIA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_KIN_MIK_KIA_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TUBER_AMIRA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TWINS_JOY_MEG_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PAINTER_RAYNA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNGSTER_DESTIN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_BREEDER_ALIZE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNG_COUPLE_GIA_JES_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_YOUNG_COUPLE_GIA_JES_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_MILO_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_CHAZ_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BIRD_KEEPER_HAROLD_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_NICOLE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_JACLYN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_SAMIR_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_HIKER_EARL_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_RUIN_MANIAC_LARRY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_POKEMANIAC_HECTOR_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_DARIO_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PSYCHIC_RODETTE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_JUGGLER_MASON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_NICOLAS_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_MADELINE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CRUSH_GIRL_CYNDY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_TAMER_EVAN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_JACKSON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_PKMN_RANGER_KATELYN_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_LEROY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOLTRAINER_MICHELLE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_COOL_COUPLE_LEX_NYA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_COLTON_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_COLTON_3[];
+extern const struct TrainerMon gTrainerParty_TRAINER_BUG_CATCHER_COLTON_4[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_MATTHEW_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_MALE_TONY_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_SWIMMER_FEMALE_MELISSA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_LORELEI_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_BRUNO_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_AGATHA_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_ELITE_FOUR_LANCE_2[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHAMPION_REMATCH_SQUIRTLE[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHAMPION_REMATCH_BULBASAUR[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CHAMPION_REMATCH_CHARMANDER[];
+extern const struct TrainerMon gTrainerParty_TRAINER_CUE_BALL_PAXTON[];
@@ -40,20 +40,7 @@
 #line 16
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 18
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 20
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 19
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AQUA_LEADER,
     },
 #line 22
     [TRAINER_AQUA_GRUNT_M] =
@@ -70,20 +57,7 @@
 #line 29
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 31
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 33
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 32
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AQUA_GRUNT_M,
     },
 #line 35
     [TRAINER_AQUA_GRUNT_F] =
@@ -100,20 +74,7 @@
 #line 42
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 44
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 46
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 45
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AQUA_GRUNT_F,
     },
 #line 48
     [TRAINER_RS_AROMA_LADY] =
@@ -130,20 +91,7 @@
 #line 55
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 57
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 59
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 58
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_AROMA_LADY,
     },
 #line 61
     [TRAINER_RS_RUIN_MANIAC] =
@@ -160,20 +108,7 @@
 #line 68
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 70
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 72
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 71
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_RUIN_MANIAC,
     },
 #line 74
     [TRAINER_INTERVIEWER] =
@@ -190,20 +125,7 @@
 #line 81
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 83
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 85
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 84
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_INTERVIEWER,
     },
 #line 87
     [TRAINER_RS_TUBER_F] =
@@ -220,20 +142,7 @@
 #line 94
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 96
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 98
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 97
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_TUBER_F,
     },
 #line 100
     [TRAINER_RS_TUBER_M] =
@@ -250,20 +159,7 @@
 #line 107
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 109
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 111
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 110
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_TUBER_M,
     },
 #line 113
     [TRAINER_RS_COOLTRAINER_M] =
@@ -280,20 +176,7 @@
 #line 120
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 122
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 124
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 123
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_COOLTRAINER_M,
     },
 #line 126
     [TRAINER_RS_COOLTRAINER_F] =
@@ -310,20 +193,7 @@
 #line 133
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 135
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 137
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 136
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_COOLTRAINER_F,
     },
 #line 139
     [TRAINER_HEX_MANIAC] =
@@ -340,20 +210,7 @@
 #line 146
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 148
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 150
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 149
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HEX_MANIAC,
     },
 #line 152
     [TRAINER_RS_LADY] =
@@ -370,20 +227,7 @@
 #line 159
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 161
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 163
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 162
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_LADY,
     },
 #line 165
     [TRAINER_RS_BEAUTY] =
@@ -400,20 +244,7 @@
 #line 172
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 174
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 176
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 175
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_BEAUTY,
     },
 #line 178
     [TRAINER_RICH_BOY] =
@@ -430,20 +261,7 @@
 #line 185
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 187
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 189
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 188
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RICH_BOY,
     },
 #line 191
     [TRAINER_RS_POKEMANIAC] =
@@ -460,20 +278,7 @@
 #line 198
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 200
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 202
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 201
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_POKEMANIAC,
     },
 #line 204
     [TRAINER_RS_SWIMMER_M] =
@@ -490,20 +295,7 @@
 #line 211
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 213
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 215
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 214
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_SWIMMER_M,
     },
 #line 217
     [TRAINER_RS_BLACK_BELT] =
@@ -520,20 +312,7 @@
 #line 224
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 226
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 228
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 227
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_BLACK_BELT,
     },
 #line 230
     [TRAINER_GUITARIST] =
@@ -550,20 +329,7 @@
 #line 237
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 239
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 241
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 240
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GUITARIST,
     },
 #line 243
     [TRAINER_KINDLER] =
@@ -580,20 +346,7 @@
 #line 250
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 252
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 254
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 253
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_KINDLER,
     },
 #line 256
     [TRAINER_RS_CAMPER] =
@@ -610,20 +363,7 @@
 #line 263
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 265
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 267
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 266
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_CAMPER,
     },
 #line 269
     [TRAINER_BUG_MANIAC] =
@@ -640,20 +380,7 @@
 #line 276
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 278
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 280
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 279
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_MANIAC,
     },
 #line 282
     [TRAINER_RS_PSYCHIC_M] =
@@ -670,20 +397,7 @@
 #line 289
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 291
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 293
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 292
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_PSYCHIC_M,
     },
 #line 295
     [TRAINER_RS_PSYCHIC_F] =
@@ -700,20 +414,7 @@
 #line 302
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 304
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 306
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 305
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_PSYCHIC_F,
     },
 #line 308
     [TRAINER_RS_GENTLEMAN] =
@@ -730,20 +431,7 @@
 #line 315
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 317
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 319
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 318
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_GENTLEMAN,
     },
 #line 321
     [TRAINER_ELITE_FOUR_SIDNEY] =
@@ -762,20 +450,7 @@
 #line 328
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 330
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 332
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 331
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_SIDNEY,
     },
 #line 334
     [TRAINER_ELITE_FOUR_PHOEBE] =
@@ -794,20 +469,7 @@
 #line 341
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 343
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 345
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 344
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_PHOEBE,
     },
 #line 347
     [TRAINER_LEADER_ROXANNE] =
@@ -826,20 +488,7 @@
 #line 354
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 356
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 358
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 357
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_ROXANNE,
     },
 #line 360
     [TRAINER_LEADER_BRAWLY] =
@@ -858,20 +507,7 @@
 #line 367
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 369
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 371
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 370
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_BRAWLY,
     },
 #line 373
     [TRAINER_LEADER_TATE_LIZA] =
@@ -890,20 +526,7 @@
 #line 380
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 382
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 384
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 383
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_TATE_LIZA,
     },
 #line 386
     [TRAINER_SCHOOL_KID_M] =
@@ -920,20 +543,7 @@
 #line 393
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 395
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 397
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 396
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCHOOL_KID_M,
     },
 #line 399
     [TRAINER_SCHOOL_KID_F] =
@@ -950,20 +560,7 @@
 #line 406
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 408
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 410
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 409
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCHOOL_KID_F,
     },
 #line 412
     [TRAINER_SR_AND_JR] =
@@ -980,20 +577,7 @@
 #line 419
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 421
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 423
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 422
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SR_AND_JR,
     },
 #line 425
     [TRAINER_POKEFAN_M] =
@@ -1010,20 +594,7 @@
 #line 432
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 434
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 436
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 435
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEFAN_M,
     },
 #line 438
     [TRAINER_POKEFAN_F] =
@@ -1040,20 +611,7 @@
 #line 445
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 447
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 449
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 448
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEFAN_F,
     },
 #line 451
     [TRAINER_EXPERT_M] =
@@ -1070,20 +628,7 @@
 #line 458
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 460
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 462
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 461
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_EXPERT_M,
     },
 #line 464
     [TRAINER_EXPERT_F] =
@@ -1100,20 +645,7 @@
 #line 471
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 473
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 475
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 474
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_EXPERT_F,
     },
 #line 477
     [TRAINER_RS_YOUNGSTER] =
@@ -1130,20 +662,7 @@
 #line 484
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 486
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 488
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 487
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_YOUNGSTER,
     },
 #line 490
     [TRAINER_RS_CHAMPION] =
@@ -1160,20 +679,7 @@
 #line 497
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 499
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 501
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 500
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_CHAMPION,
     },
 #line 503
     [TRAINER_RS_FISHERMAN] =
@@ -1190,20 +696,7 @@
 #line 510
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 512
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 514
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 513
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_FISHERMAN,
     },
 #line 516
     [TRAINER_CYCLING_TRIATHLETE_M] =
@@ -1220,20 +713,7 @@
 #line 523
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 525
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 527
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 526
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CYCLING_TRIATHLETE_M,
     },
 #line 529
     [TRAINER_CYCLING_TRIATHLETE_F] =
@@ -1250,20 +730,7 @@
 #line 536
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 538
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 540
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 539
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CYCLING_TRIATHLETE_F,
     },
 #line 542
     [TRAINER_RUNNING_TRIATHLETE_M] =
@@ -1280,20 +747,7 @@
 #line 549
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 551
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 553
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 552
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUNNING_TRIATHLETE_M,
     },
 #line 555
     [TRAINER_RUNNING_TRIATHLETE_F] =
@@ -1310,20 +764,7 @@
 #line 562
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 564
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 566
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 565
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUNNING_TRIATHLETE_F,
     },
 #line 568
     [TRAINER_SWIMMING_TRIATHLETE_M] =
@@ -1340,20 +781,7 @@
 #line 575
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 577
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 579
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 578
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMING_TRIATHLETE_M,
     },
 #line 581
     [TRAINER_SWIMMING_TRIATHLETE_F] =
@@ -1370,20 +798,7 @@
 #line 588
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 590
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 592
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 591
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMING_TRIATHLETE_F,
     },
 #line 594
     [TRAINER_DRAGON_TAMER] =
@@ -1400,20 +815,7 @@
 #line 601
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 603
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 605
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 604
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_DRAGON_TAMER,
     },
 #line 607
     [TRAINER_RS_BIRD_KEEPER] =
@@ -1430,20 +832,7 @@
 #line 614
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 616
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 618
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 617
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_BIRD_KEEPER,
     },
 #line 620
     [TRAINER_NINJA_BOY] =
@@ -1460,20 +849,7 @@
 #line 627
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 629
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 631
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 630
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_NINJA_BOY,
     },
 #line 633
     [TRAINER_BATTLE_GIRL] =
@@ -1490,20 +866,7 @@
 #line 640
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 642
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 644
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 643
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BATTLE_GIRL,
     },
 #line 646
     [TRAINER_PARASOL_LADY] =
@@ -1520,20 +883,7 @@
 #line 653
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 655
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 657
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 656
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PARASOL_LADY,
     },
 #line 659
     [TRAINER_RS_SWIMMER_F] =
@@ -1550,20 +900,7 @@
 #line 666
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 668
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 670
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 669
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_SWIMMER_F,
     },
 #line 672
     [TRAINER_RS_PICNICKER] =
@@ -1580,20 +917,7 @@
 #line 679
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 681
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 683
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 682
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_PICNICKER,
     },
 #line 685
     [TRAINER_RS_TWINS] =
@@ -1610,20 +934,7 @@
 #line 692
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 694
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 696
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 695
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_TWINS,
     },
 #line 698
     [TRAINER_RS_SAILOR] =
@@ -1640,20 +951,7 @@
 #line 705
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 707
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 709
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 708
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_SAILOR,
     },
 #line 711
     [TRAINER_BOARDER_M] =
@@ -1670,20 +968,7 @@
 #line 718
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 720
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 722
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 721
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BOARDER_M,
     },
 #line 724
     [TRAINER_BOARDER_F] =
@@ -1700,20 +985,7 @@
 #line 731
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 733
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 735
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 734
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BOARDER_F,
     },
 #line 737
     [TRAINER_COLLECTOR] =
@@ -1730,20 +1002,7 @@
 #line 744
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 746
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 748
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 747
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_COLLECTOR,
     },
 #line 750
     [TRAINER_WALLY] =
@@ -1760,20 +1019,7 @@
 #line 757
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 759
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 761
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 760
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_WALLY,
     },
 #line 763
     [TRAINER_BRENDAN] =
@@ -1790,20 +1036,7 @@
 #line 770
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 772
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 774
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 773
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BRENDAN,
     },
 #line 776
     [TRAINER_BRENDAN_2] =
@@ -1820,20 +1053,7 @@
 #line 783
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 785
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 787
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 786
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BRENDAN_2,
     },
 #line 789
     [TRAINER_BRENDAN_3] =
@@ -1850,20 +1070,7 @@
 #line 796
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 798
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 800
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 799
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BRENDAN_3,
     },
 #line 802
     [TRAINER_MAY] =
@@ -1880,20 +1087,7 @@
 #line 809
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 811
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 813
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 812
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAY,
     },
 #line 815
     [TRAINER_MAY_2] =
@@ -1910,20 +1104,7 @@
 #line 822
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 824
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 826
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 825
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAY_2,
     },
 #line 828
     [TRAINER_MAY_3] =
@@ -1940,20 +1121,7 @@
 #line 835
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 837
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 839
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 838
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAY_3,
     },
 #line 841
     [TRAINER_RS_PKMN_BREEDER_M] =
@@ -1970,20 +1138,7 @@
 #line 848
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 850
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 852
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 851
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_PKMN_BREEDER_M,
     },
 #line 854
     [TRAINER_RS_PKMN_BREEDER_F] =
@@ -2000,20 +1155,7 @@
 #line 861
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 863
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 865
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 864
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_PKMN_BREEDER_F,
     },
 #line 867
     [TRAINER_RS_PKMN_RANGER_M] =
@@ -2030,20 +1172,7 @@
 #line 874
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 876
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 878
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 877
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_PKMN_RANGER_M,
     },
 #line 880
     [TRAINER_RS_PKMN_RANGER_F] =
@@ -2060,20 +1189,7 @@
 #line 887
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 889
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 891
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 890
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_PKMN_RANGER_F,
     },
 #line 893
     [TRAINER_MAGMA_LEADER] =
@@ -2090,20 +1206,7 @@
 #line 900
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 902
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 904
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 903
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAGMA_LEADER,
     },
 #line 906
     [TRAINER_MAGMA_GRUNT_M] =
@@ -2120,20 +1223,7 @@
 #line 913
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 915
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 917
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 916
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAGMA_GRUNT_M,
     },
 #line 919
     [TRAINER_MAMGA_GRUNT_F] =
@@ -2150,20 +1240,7 @@
 #line 926
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 928
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 930
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 929
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAMGA_GRUNT_F,
     },
 #line 932
     [TRAINER_RS_LASS] =
@@ -2180,20 +1257,7 @@
 #line 939
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 941
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 943
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 942
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_LASS,
     },
 #line 945
     [TRAINER_RS_BUG_CATCHER] =
@@ -2210,20 +1274,7 @@
 #line 952
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 954
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 956
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 955
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_BUG_CATCHER,
     },
 #line 958
     [TRAINER_RS_HIKER] =
@@ -2240,20 +1291,7 @@
 #line 965
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 967
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 969
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 968
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_HIKER,
     },
 #line 971
     [TRAINER_RS_YOUNG_COUPLE] =
@@ -2270,31 +1308,7 @@
 #line 978
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 980
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 982
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 981
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 984
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 986
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 985
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_YOUNG_COUPLE,
     },
 #line 988
     [TRAINER_OLD_COUPLE] =
@@ -2311,20 +1325,7 @@
 #line 995
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 997
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 999
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 998
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_OLD_COUPLE,
     },
 #line 1001
     [TRAINER_RS_SIS_AND_BRO] =
@@ -2341,20 +1342,7 @@
 #line 1008
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1010
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1012
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1011
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RS_SIS_AND_BRO,
     },
 #line 1014
     [TRAINER_AQUA_ADMIN_MATT] =
@@ -2373,20 +1361,7 @@
 #line 1021
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1023
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1025
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1024
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AQUA_ADMIN_MATT,
     },
 #line 1027
     [TRAINER_AQUA_ADMIN_SHELLY] =
@@ -2405,20 +1380,7 @@
 #line 1034
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1036
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1038
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1037
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AQUA_ADMIN_SHELLY,
     },
 #line 1040
     [TRAINER_MAGMA_ADMIN_TABITHA] =
@@ -2437,20 +1399,7 @@
 #line 1047
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1049
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1051
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1050
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAGMA_ADMIN_TABITHA,
     },
 #line 1053
     [TRAINER_MAGMA_ADMIN_COURTNEY] =
@@ -2469,20 +1418,7 @@
 #line 1060
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1062
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1064
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1063
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_MAGMA_ADMIN_COURTNEY,
     },
 #line 1066
     [TRAINER_LEADER_WATTSON] =
@@ -2501,20 +1437,7 @@
 #line 1073
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1075
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1077
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1076
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_WATTSON,
     },
 #line 1079
     [TRAINER_LEADER_FLANNERY] =
@@ -2533,20 +1456,7 @@
 #line 1086
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1088
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1090
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1089
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_FLANNERY,
     },
 #line 1092
     [TRAINER_LEADER_NORMAN] =
@@ -2565,20 +1475,7 @@
 #line 1099
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1101
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1103
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1102
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_NORMAN,
     },
 #line 1105
     [TRAINER_LEADER_WINONA] =
@@ -2597,20 +1494,7 @@
 #line 1112
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1114
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1116
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1115
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_WINONA,
     },
 #line 1118
     [TRAINER_LEADER_WALLACE] =
@@ -2629,20 +1513,7 @@
 #line 1125
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1127
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1129
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1128
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_WALLACE,
     },
 #line 1131
     [TRAINER_ELITE_FOUR_GLACIA] =
@@ -2661,20 +1532,7 @@
 #line 1138
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1140
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1142
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1141
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_GLACIA,
     },
 #line 1144
     [TRAINER_ELITE_FOUR_DRAKE] =
@@ -2693,20 +1551,7 @@
 #line 1151
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1153
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1155
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1154
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_DRAKE,
     },
 #line 1157
     [TRAINER_YOUNGSTER_BEN] =
@@ -2725,31 +1570,7 @@
 #line 1164
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1166
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1168
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1167
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1170
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1172
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1171
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_BEN,
     },
 #line 1174
     [TRAINER_YOUNGSTER_CALVIN] =
@@ -2768,20 +1589,7 @@
 #line 1181
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1183
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1185
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1184
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_CALVIN,
     },
 #line 1187
     [TRAINER_YOUNGSTER_JOSH] =
@@ -2800,42 +1608,7 @@
 #line 1194
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1196
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1198
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1197
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1200
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1202
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1201
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1204
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1206
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1205
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_JOSH,
     },
 #line 1208
     [TRAINER_YOUNGSTER_TIMMY] =
@@ -2854,31 +1627,7 @@
 #line 1215
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1217
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1219
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1218
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1221
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1223
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1222
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_TIMMY,
     },
 #line 1225
     [TRAINER_YOUNGSTER_JOEY] =
@@ -2897,31 +1646,7 @@
 #line 1232
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1234
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1236
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1235
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1238
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1240
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1239
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_JOEY,
     },
 #line 1242
     [TRAINER_YOUNGSTER_DAN] =
@@ -2940,20 +1665,7 @@
 #line 1249
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1251
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1253
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1252
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_DAN,
     },
 #line 1255
     [TRAINER_YOUNGSTER_CHAD] =
@@ -2972,31 +1684,7 @@
 #line 1262
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1264
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1266
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1265
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1268
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1270
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1269
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_CHAD,
     },
 #line 1272
     [TRAINER_YOUNGSTER_TYLER] =
@@ -3015,20 +1703,7 @@
 #line 1279
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1281
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1283
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1282
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_TYLER,
     },
 #line 1285
     [TRAINER_YOUNGSTER_EDDIE] =
@@ -3047,20 +1722,7 @@
 #line 1292
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1294
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1296
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1295
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_EDDIE,
     },
 #line 1298
     [TRAINER_YOUNGSTER_DILLON] =
@@ -3079,31 +1741,7 @@
 #line 1305
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1307
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1309
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1308
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1311
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1313
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1312
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_DILLON,
     },
 #line 1315
     [TRAINER_YOUNGSTER_YASU] =
@@ -3122,42 +1760,7 @@
 #line 1322
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1324
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1326
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1325
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1328
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1330
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1329
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1332
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1334
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1333
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_YASU,
     },
 #line 1336
     [TRAINER_YOUNGSTER_DAVE] =
@@ -3176,31 +1779,7 @@
 #line 1343
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1345
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1347
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1346
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1349
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1351
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1350
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_DAVE,
     },
 #line 1353
     [TRAINER_YOUNGSTER_BEN_2] =
@@ -3219,31 +1798,7 @@
 #line 1360
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1362
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1364
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 1363
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1366
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1368
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 1367
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_BEN_2,
     },
 #line 1370
     [TRAINER_BUG_CATCHER_RICK] =
@@ -3262,31 +1817,7 @@
 #line 1377
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1379
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1381
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1380
-            .lvl = 6,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1383
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1385
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1384
-            .lvl = 6,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_RICK,
     },
 #line 1387
     [TRAINER_BUG_CATCHER_DOUG] =
@@ -3305,42 +1836,7 @@
 #line 1394
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1396
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1398
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1397
-            .lvl = 7,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1400
-            .species = SPECIES_KAKUNA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1402
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1401
-            .lvl = 7,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1404
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1406
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1405
-            .lvl = 7,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_DOUG,
     },
 #line 1408
     [TRAINER_BUG_CATCHER_SAMMY] =
@@ -3359,20 +1855,7 @@
 #line 1415
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1417
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1419
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1418
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_SAMMY,
     },
 #line 1421
     [TRAINER_BUG_CATCHER_COLTON] =
@@ -3391,42 +1874,7 @@
 #line 1428
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1430
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1432
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1431
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1434
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1436
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1435
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1438
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1440
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1439
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_COLTON,
     },
 #line 1442
     [TRAINER_BUG_CATCHER_GREG] =
@@ -3445,53 +1893,7 @@
 #line 1449
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1451
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1453
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1452
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1455
-            .species = SPECIES_KAKUNA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1457
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1456
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1459
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1461
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1460
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1463
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1465
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1464
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_GREG,
     },
 #line 1467
     [TRAINER_BUG_CATCHER_JAMES] =
@@ -3510,31 +1912,7 @@
 #line 1474
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1476
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1478
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1477
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1480
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1482
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1481
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_JAMES,
     },
 #line 1484
     [TRAINER_BUG_CATCHER_KENT] =
@@ -3553,31 +1931,7 @@
 #line 1491
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1493
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1495
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1494
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1497
-            .species = SPECIES_KAKUNA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1499
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1498
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_KENT,
     },
 #line 1501
     [TRAINER_BUG_CATCHER_ROBBY] =
@@ -3596,42 +1950,7 @@
 #line 1508
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1510
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1512
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1511
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1514
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1516
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1515
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1518
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1520
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1519
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_ROBBY,
     },
 #line 1522
     [TRAINER_BUG_CATCHER_CALE] =
@@ -3650,53 +1969,7 @@
 #line 1529
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1531
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1533
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1532
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1535
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1537
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1536
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1539
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1541
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1540
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1543
-            .species = SPECIES_KAKUNA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1545
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1544
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_CALE,
     },
 #line 1547
     [TRAINER_BUG_CATCHER_KEIGO] =
@@ -3715,42 +1988,7 @@
 #line 1554
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1556
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1558
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1557
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1560
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1562
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1561
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1564
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1566
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1565
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_KEIGO,
     },
 #line 1568
     [TRAINER_BUG_CATCHER_ELIJAH] =
@@ -3769,20 +2007,7 @@
 #line 1575
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1577
-            .species = SPECIES_BUTTERFREE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1579
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1578
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_ELIJAH,
     },
 #line 1581
     [TRAINER_BUG_CATCHER_2] =
@@ -3799,42 +2024,7 @@
 #line 1588
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1590
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1592
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1591
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1594
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1596
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1595
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1598
-            .species = SPECIES_VENONAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1600
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1599
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_2,
     },
 #line 1602
     [TRAINER_BUG_CATCHER_BRENT] =
@@ -3853,31 +2043,7 @@
 #line 1609
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1611
-            .species = SPECIES_BEEDRILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1613
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1612
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1615
-            .species = SPECIES_BEEDRILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1617
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1616
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_BRENT,
     },
 #line 1619
     [TRAINER_BUG_CATCHER_CONNER] =
@@ -3896,42 +2062,7 @@
 #line 1626
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1628
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1630
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1629
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1632
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1634
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1633
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1636
-            .species = SPECIES_VENONAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1638
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1637
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_CONNER,
     },
 #line 1640
     [TRAINER_LASS_JANICE] =
@@ -3950,31 +2081,7 @@
 #line 1647
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1649
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1651
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1650
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1653
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1655
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1654
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_JANICE,
     },
 #line 1657
     [TRAINER_LASS_SALLY] =
@@ -3993,31 +2100,7 @@
 #line 1664
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1666
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1668
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1667
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1670
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1672
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1671
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_SALLY,
     },
 #line 1674
     [TRAINER_LASS_ROBIN] =
@@ -4036,20 +2119,7 @@
 #line 1681
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1683
-            .species = SPECIES_JIGGLYPUFF,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1685
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1684
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_ROBIN,
     },
 #line 1687
     [TRAINER_LASS_CRISSY] =
@@ -4068,42 +2138,7 @@
 #line 1694
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1696
-            .species = SPECIES_PARAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1698
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1697
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1700
-            .species = SPECIES_PARAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1702
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1701
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1704
-            .species = SPECIES_PARASECT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1706
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1705
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_CRISSY,
     },
 #line 1708
     [TRAINER_LASS_MIRIAM] =
@@ -4122,31 +2157,7 @@
 #line 1715
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1717
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1719
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1718
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1721
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1723
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1722
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_MIRIAM,
     },
 #line 1725
     [TRAINER_LASS_IRIS] =
@@ -4165,20 +2176,7 @@
 #line 1732
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1734
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1736
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1735
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_IRIS,
     },
 #line 1738
     [TRAINER_LASS_RELI] =
@@ -4197,31 +2195,7 @@
 #line 1745
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1747
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1749
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1748
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1751
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1753
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1752
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_RELI,
     },
 #line 1755
     [TRAINER_LASS_ALI] =
@@ -4240,42 +2214,7 @@
 #line 1762
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1764
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1766
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1765
-            .lvl = 12,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1768
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1770
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1769
-            .lvl = 12,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1772
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1774
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1773
-            .lvl = 12,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_ALI,
     },
 #line 1776
     [TRAINER_LASS_2] =
@@ -4292,31 +2231,7 @@
 #line 1783
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1785
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1787
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1786
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1789
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1791
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1790
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_2,
     },
 #line 1793
     [TRAINER_LASS_HALEY] =
@@ -4335,42 +2250,7 @@
 #line 1800
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1802
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1804
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1803
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1806
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1808
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1807
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1810
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1812
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1811
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_HALEY,
     },
 #line 1814
     [TRAINER_LASS_ANN] =
@@ -4389,31 +2269,7 @@
 #line 1821
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1823
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1825
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1824
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1827
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1829
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1828
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_ANN,
     },
 #line 1831
     [TRAINER_LASS_DAWN] =
@@ -4432,31 +2288,7 @@
 #line 1838
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1840
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1842
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1841
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1844
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1846
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1845
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_DAWN,
     },
 #line 1848
     [TRAINER_LASS_PAIGE] =
@@ -4475,31 +2307,7 @@
 #line 1855
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1857
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1859
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1858
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1861
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1863
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1862
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_PAIGE,
     },
 #line 1865
     [TRAINER_LASS_ANDREA] =
@@ -4518,42 +2326,7 @@
 #line 1872
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1874
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1876
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1875
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1878
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1880
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1879
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1882
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1884
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1883
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_ANDREA,
     },
 #line 1886
     [TRAINER_LASS_MEGAN] =
@@ -4572,64 +2345,7 @@
 #line 1893
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1895
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1897
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1896
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1899
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1901
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1900
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1903
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1905
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1904
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1907
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1909
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1908
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1911
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1913
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1912
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_MEGAN,
     },
 #line 1915
     [TRAINER_LASS_JULIA] =
@@ -4648,31 +2364,7 @@
 #line 1922
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1924
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1926
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1925
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1928
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1930
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1929
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_JULIA,
     },
 #line 1932
     [TRAINER_LASS_KAY] =
@@ -4691,31 +2383,7 @@
 #line 1939
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1941
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1943
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1942
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1945
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1947
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1946
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_KAY,
     },
 #line 1949
     [TRAINER_LASS_LISA] =
@@ -4734,31 +2402,7 @@
 #line 1956
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1958
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1960
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1959
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1962
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1964
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1963
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_LISA,
     },
 #line 1966
     [TRAINER_SAILOR_EDMOND] =
@@ -4777,31 +2421,7 @@
 #line 1973
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1975
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1977
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1976
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1979
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1981
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1980
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_EDMOND,
     },
 #line 1983
     [TRAINER_SAILOR_TREVOR] =
@@ -4820,31 +2440,7 @@
 #line 1990
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 1992
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1994
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1993
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 1996
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 1998
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 1997
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_TREVOR,
     },
 #line 2000
     [TRAINER_SAILOR_LEONARD] =
@@ -4863,20 +2459,7 @@
 #line 2007
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2009
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2011
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2010
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_LEONARD,
     },
 #line 2013
     [TRAINER_SAILOR_DUNCAN] =
@@ -4895,42 +2478,7 @@
 #line 2020
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2022
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2024
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2023
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2026
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2028
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2027
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2030
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2032
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2031
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_DUNCAN,
     },
 #line 2034
     [TRAINER_SAILOR_HUEY] =
@@ -4949,31 +2497,7 @@
 #line 2041
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2043
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2045
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2044
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2047
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2049
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2048
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_HUEY,
     },
 #line 2051
     [TRAINER_SAILOR_DYLAN] =
@@ -4992,42 +2516,7 @@
 #line 2058
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2060
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2062
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2061
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2064
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2066
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2065
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2068
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2070
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2069
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_DYLAN,
     },
 #line 2072
     [TRAINER_SAILOR_PHILLIP] =
@@ -5046,20 +2535,7 @@
 #line 2079
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2081
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2083
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2082
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_PHILLIP,
     },
 #line 2085
     [TRAINER_SAILOR_DWAYNE] =
@@ -5078,31 +2554,7 @@
 #line 2092
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2094
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2096
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2095
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2098
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2100
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2099
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SAILOR_DWAYNE,
     },
 #line 2102
     [TRAINER_CAMPER_LIAM] =
@@ -5121,42 +2573,7 @@
 #line 2109
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2111
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2113
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2112
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2114
-                MOVE_TACKLE,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 2117
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2119
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2118
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2120
-                MOVE_SCRATCH,
-                MOVE_DEFENSE_CURL,
-                MOVE_SAND_ATTACK,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_LIAM,
     },
 #line 2124
     [TRAINER_CAMPER_SHANE] =
@@ -5175,31 +2592,7 @@
 #line 2131
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2133
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2135
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2134
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2137
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2139
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2138
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_SHANE,
     },
 #line 2141
     [TRAINER_CAMPER_ETHAN] =
@@ -5218,20 +2611,7 @@
 #line 2148
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2150
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2152
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2151
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_ETHAN,
     },
 #line 2154
     [TRAINER_CAMPER_RICKY] =
@@ -5250,20 +2630,7 @@
 #line 2161
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2163
-            .species = SPECIES_SQUIRTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2165
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2164
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_RICKY,
     },
 #line 2167
     [TRAINER_CAMPER_JEFF] =
@@ -5282,31 +2649,7 @@
 #line 2174
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2176
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2178
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2177
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2180
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2182
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2181
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_JEFF,
     },
 #line 2184
     [TRAINER_CAMPER_2] =
@@ -5322,21 +2665,8 @@
         .doubleBattle = FALSE,
 #line 2191
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
-        .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2193
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2195
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2194
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .partySize = 1,
+        .party = gTrainerParty_TRAINER_CAMPER_2,
     },
 #line 2197
     [TRAINER_CAMPER_CHRIS] =
@@ -5355,31 +2685,7 @@
 #line 2204
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2206
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2208
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2207
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2210
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2212
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2211
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_CHRIS,
     },
 #line 2214
     [TRAINER_CAMPER_DREW] =
@@ -5398,53 +2704,7 @@
 #line 2221
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2223
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2225
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2224
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2227
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2229
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2228
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2231
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2233
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2232
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2235
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2237
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2236
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_DREW,
     },
 #line 2239
     [TRAINER_PICNICKER_DIANA] =
@@ -5463,20 +2723,7 @@
 #line 2246
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2248
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2250
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2249
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_DIANA,
     },
 #line 2252
     [TRAINER_PICNICKER_NANCY] =
@@ -5495,31 +2742,7 @@
 #line 2259
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2261
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2263
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2262
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2265
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2267
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2266
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_NANCY,
     },
 #line 2269
     [TRAINER_PICNICKER_ISABELLE] =
@@ -5538,42 +2761,7 @@
 #line 2276
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2278
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2280
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2279
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2282
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2284
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2283
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2286
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2288
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2287
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ISABELLE,
     },
 #line 2290
     [TRAINER_PICNICKER_KELSEY] =
@@ -5592,31 +2780,7 @@
 #line 2297
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2299
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2301
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2300
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2303
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2305
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2304
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_KELSEY,
     },
 #line 2307
     [TRAINER_PICNICKER_ALICIA] =
@@ -5635,53 +2799,7 @@
 #line 2314
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2316
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2318
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2317
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2320
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2322
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2321
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2324
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2326
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2325
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2328
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2330
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2329
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ALICIA,
     },
 #line 2332
     [TRAINER_PICNICKER_CAITLIN] =
@@ -5700,20 +2818,7 @@
 #line 2339
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2341
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2343
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2342
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_CAITLIN,
     },
 #line 2345
     [TRAINER_PICNICKER_HEIDI] =
@@ -5732,31 +2837,7 @@
 #line 2352
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2354
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2356
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2355
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2358
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2360
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2359
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_HEIDI,
     },
 #line 2362
     [TRAINER_PICNICKER_CAROL] =
@@ -5775,31 +2856,7 @@
 #line 2369
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2371
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2373
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2372
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2375
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2377
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2376
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_CAROL,
     },
 #line 2379
     [TRAINER_PICNICKER_SOFIA] =
@@ -5818,42 +2875,7 @@
 #line 2386
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2388
-            .species = SPECIES_JIGGLYPUFF,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2390
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2389
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2392
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2394
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2393
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2396
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2398
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2397
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_SOFIA,
     },
 #line 2400
     [TRAINER_PICNICKER_MARTHA] =
@@ -5872,31 +2894,7 @@
 #line 2407
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2409
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2411
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2410
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2413
-            .species = SPECIES_BULBASAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2415
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2414
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_MARTHA,
     },
 #line 2417
     [TRAINER_PICNICKER_TINA] =
@@ -5915,31 +2913,7 @@
 #line 2424
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2426
-            .species = SPECIES_BULBASAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2428
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2427
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2430
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2432
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2431
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_TINA,
     },
 #line 2434
     [TRAINER_PICNICKER_HANNAH] =
@@ -5958,64 +2932,7 @@
 #line 2441
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2443
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2445
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2444
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2447
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2449
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2448
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2451
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2453
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2452
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2455
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2457
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2456
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2459
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2461
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2460
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_HANNAH,
     },
 #line 2463
     [TRAINER_POKEMANIAC_MARK] =
@@ -6034,31 +2951,7 @@
 #line 2470
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2472
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2474
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2473
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2476
-            .species = SPECIES_LICKITUNG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2478
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2477
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_MARK,
     },
 #line 2480
     [TRAINER_POKEMANIAC_HERMAN] =
@@ -6077,31 +2970,7 @@
 #line 2487
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2489
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2491
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2490
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2493
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2495
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2494
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_HERMAN,
     },
 #line 2497
     [TRAINER_POKEMANIAC_COOPER] =
@@ -6120,42 +2989,7 @@
 #line 2504
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2506
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2508
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2507
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2510
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2512
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2511
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2514
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2516
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2515
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_COOPER,
     },
 #line 2518
     [TRAINER_POKEMANIAC_STEVE] =
@@ -6174,31 +3008,7 @@
 #line 2525
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2527
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2529
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2528
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2531
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2533
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2532
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_STEVE,
     },
 #line 2535
     [TRAINER_POKEMANIAC_WINSTON] =
@@ -6217,20 +3027,7 @@
 #line 2542
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2544
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2546
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2545
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_WINSTON,
     },
 #line 2548
     [TRAINER_POKEMANIAC_DAWSON] =
@@ -6249,42 +3046,7 @@
 #line 2555
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2557
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2559
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2558
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2561
-            .species = SPECIES_LAPRAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2563
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2562
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2565
-            .species = SPECIES_LICKITUNG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2567
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2566
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_DAWSON,
     },
 #line 2569
     [TRAINER_POKEMANIAC_ASHTON] =
@@ -6303,31 +3065,7 @@
 #line 2576
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2578
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2580
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2579
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2582
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2584
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 2583
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_ASHTON,
     },
 #line 2586
     [TRAINER_SUPER_NERD_JOVAN] =
@@ -6346,31 +3084,7 @@
 #line 2593
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2595
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2597
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2596
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2599
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2601
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2600
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_JOVAN,
     },
 #line 2603
     [TRAINER_SUPER_NERD_MIGUEL] =
@@ -6389,42 +3103,7 @@
 #line 2610
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2612
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2614
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2613
-            .lvl = 12,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2616
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2618
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2617
-            .lvl = 12,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2620
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2622
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2621
-            .lvl = 12,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_MIGUEL,
     },
 #line 2624
     [TRAINER_SUPER_NERD_AIDAN] =
@@ -6443,81 +3122,7 @@
 #line 2631
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2633
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2635
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2634
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2636
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_TACKLE,
-                MOVE_CHARGE,
-            },
-            },
-            {
-#line 2641
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2643
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2642
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2644
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-                MOVE_POISON_GAS,
-            },
-            },
-            {
-#line 2649
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2651
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2650
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2652
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_TACKLE,
-                MOVE_CHARGE,
-            },
-            },
-            {
-#line 2657
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2659
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2658
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2660
-                MOVE_SONIC_BOOM,
-                MOVE_SUPERSONIC,
-                MOVE_THUNDER_SHOCK,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_AIDAN,
     },
 #line 2665
     [TRAINER_SUPER_NERD_GLENN] =
@@ -6536,42 +3141,7 @@
 #line 2672
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2674
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2676
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2675
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2678
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2680
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2679
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2682
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2684
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2683
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_GLENN,
     },
 #line 2686
     [TRAINER_SUPER_NERD_LESLIE] =
@@ -6590,27 +3160,7 @@
 #line 2693
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2695
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2697
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2696
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2698
-                MOVE_SLUDGE,
-                MOVE_SMOKESCREEN,
-                MOVE_SMOG,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_LESLIE,
     },
 #line 2703
     [TRAINER_SUPER_NERD_1] =
@@ -6627,42 +3177,7 @@
 #line 2710
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2712
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2714
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2713
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2716
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2718
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2717
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2720
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2722
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2721
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_1,
     },
 #line 2724
     [TRAINER_SUPER_NERD_2] =
@@ -6679,53 +3194,7 @@
 #line 2731
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2733
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2735
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2734
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2737
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2739
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2738
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2741
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2743
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2742
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2745
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2747
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2746
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_2,
     },
 #line 2749
     [TRAINER_SUPER_NERD_3] =
@@ -6742,31 +3211,7 @@
 #line 2756
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2758
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2760
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2759
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2762
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2764
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2763
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_3,
     },
 #line 2766
     [TRAINER_SUPER_NERD_ERIK] =
@@ -6785,42 +3230,7 @@
 #line 2773
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2775
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2777
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2776
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2779
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2781
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2780
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2783
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2785
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2784
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_ERIK,
     },
 #line 2787
     [TRAINER_SUPER_NERD_AVERY] =
@@ -6839,53 +3249,7 @@
 #line 2794
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2796
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2798
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2797
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2800
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2802
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2801
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2804
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2806
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2805
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2808
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2810
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2809
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_AVERY,
     },
 #line 2812
     [TRAINER_SUPER_NERD_DEREK] =
@@ -6904,20 +3268,7 @@
 #line 2819
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2821
-            .species = SPECIES_RAPIDASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2823
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2822
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_DEREK,
     },
 #line 2825
     [TRAINER_SUPER_NERD_ZAC] =
@@ -6936,31 +3287,7 @@
 #line 2832
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2834
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2836
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2835
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2838
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2840
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2839
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_ZAC,
     },
 #line 2842
     [TRAINER_HIKER_MARCOS] =
@@ -6979,42 +3306,7 @@
 #line 2849
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2851
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2853
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2852
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2855
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2857
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2856
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2859
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2861
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2860
-            .lvl = 10,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_MARCOS,
     },
 #line 2863
     [TRAINER_HIKER_FRANKLIN] =
@@ -7033,31 +3325,7 @@
 #line 2870
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2872
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2874
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2873
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2876
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2878
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2877
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_FRANKLIN,
     },
 #line 2880
     [TRAINER_HIKER_NOB] =
@@ -7076,53 +3344,7 @@
 #line 2887
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2889
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2891
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2890
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2893
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2895
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2894
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2897
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2899
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2898
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2901
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2903
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2902
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_NOB,
     },
 #line 2905
     [TRAINER_HIKER_WAYNE] =
@@ -7141,20 +3363,7 @@
 #line 2912
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2914
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2916
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2915
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_WAYNE,
     },
 #line 2918
     [TRAINER_HIKER_ALAN] =
@@ -7173,45 +3382,7 @@
 #line 2925
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2927
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2929
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2928
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2930
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 2935
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2937
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2936
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2938
-                MOVE_HARDEN,
-                MOVE_ROCK_THROW,
-                MOVE_BIND,
-                MOVE_SCREECH,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_ALAN,
     },
 #line 2943
     [TRAINER_HIKER_BRICE] =
@@ -7230,42 +3401,7 @@
 #line 2950
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2952
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2954
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2953
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2956
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2958
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2957
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 2960
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2962
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2961
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_BRICE,
     },
 #line 2964
     [TRAINER_HIKER_CLARK] =
@@ -7284,45 +3420,7 @@
 #line 2971
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2973
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2975
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2974
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2976
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 2981
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 2983
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2982
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 2984
-                MOVE_HARDEN,
-                MOVE_ROCK_THROW,
-                MOVE_BIND,
-                MOVE_SCREECH,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_CLARK,
     },
 #line 2989
     [TRAINER_HIKER_TRENT] =
@@ -7341,31 +3439,7 @@
 #line 2996
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 2998
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3000
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 2999
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3002
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3004
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3003
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_TRENT,
     },
 #line 3006
     [TRAINER_HIKER_DUDLEY] =
@@ -7384,63 +3458,7 @@
 #line 3013
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3015
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3017
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3016
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3018
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 3023
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3025
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3024
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3026
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 3031
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3033
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3032
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3034
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_DUDLEY,
     },
 #line 3039
     [TRAINER_HIKER_ALLEN] =
@@ -7459,27 +3477,7 @@
 #line 3046
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3048
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3050
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3049
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3051
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_ALLEN,
     },
 #line 3056
     [TRAINER_HIKER_ERIC] =
@@ -7498,31 +3496,7 @@
 #line 3063
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3065
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3067
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3066
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3069
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3071
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3070
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_ERIC,
     },
 #line 3073
     [TRAINER_HIKER_LENNY] =
@@ -7541,53 +3515,7 @@
 #line 3080
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3082
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3084
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3083
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3086
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3088
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3087
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3090
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3092
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3091
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3094
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3096
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3095
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_LENNY,
     },
 #line 3098
     [TRAINER_HIKER_OLIVER] =
@@ -7606,42 +3534,7 @@
 #line 3105
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3107
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3109
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3108
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3111
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3113
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3112
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3115
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3117
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3116
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_OLIVER,
     },
 #line 3119
     [TRAINER_HIKER_LUCAS] =
@@ -7660,45 +3553,7 @@
 #line 3126
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3128
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3130
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3129
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3131
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 3136
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3138
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3137
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3139
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_LUCAS,
     },
 #line 3144
     [TRAINER_BIKER_JARED] =
@@ -7717,63 +3572,7 @@
 #line 3151
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3153
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3155
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3154
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3156
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_POISON_GAS,
-            },
-            },
-            {
-#line 3161
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3163
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3162
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3164
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3169
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3171
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3170
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3172
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_JARED,
     },
 #line 3177
     [TRAINER_BIKER_MALIK] =
@@ -7792,45 +3591,7 @@
 #line 3184
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3186
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3188
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3187
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3189
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3194
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3196
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3195
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3197
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_MALIK,
     },
 #line 3202
     [TRAINER_BIKER_ERNEST] =
@@ -7849,99 +3610,7 @@
 #line 3209
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3211
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3213
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3212
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3214
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3219
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3221
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3220
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3222
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3227
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3229
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3228
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3230
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3235
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3237
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3236
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3238
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3243
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3245
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3244
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3246
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-                MOVE_POUND,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_ERNEST,
     },
 #line 3251
     [TRAINER_BIKER_ALEX] =
@@ -7960,63 +3629,7 @@
 #line 3258
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3260
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3262
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3261
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3263
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3268
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3270
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3269
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3271
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 3276
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3278
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3277
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3279
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_ALEX,
     },
 #line 3284
     [TRAINER_BIKER_LAO] =
@@ -8035,45 +3648,7 @@
 #line 3291
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3293
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3295
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3294
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3296
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 3301
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3303
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3302
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3304
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_LAO,
     },
 #line 3309
     [TRAINER_BIKER_1] =
@@ -8090,20 +3665,7 @@
 #line 3316
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3318
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3320
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3319
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_1,
     },
 #line 3322
     [TRAINER_BIKER_HIDEO] =
@@ -8122,20 +3684,7 @@
 #line 3329
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3331
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3333
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3332
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_HIDEO,
     },
 #line 3335
     [TRAINER_BIKER_RUBEN] =
@@ -8154,63 +3703,7 @@
 #line 3342
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3344
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3346
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3345
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3347
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3352
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3354
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3353
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3355
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3360
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3362
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3361
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3363
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_RUBEN,
     },
 #line 3368
     [TRAINER_BIKER_BILLY] =
@@ -8229,20 +3722,7 @@
 #line 3375
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3377
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3379
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3378
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_BILLY,
     },
 #line 3381
     [TRAINER_BIKER_NIKOLAS] =
@@ -8261,45 +3741,7 @@
 #line 3388
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3390
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3392
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3391
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3393
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_CHARGE,
-            },
-            },
-            {
-#line 3398
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3400
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3399
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3401
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_CHARGE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_NIKOLAS,
     },
 #line 3406
     [TRAINER_BIKER_JAXON] =
@@ -8318,45 +3760,7 @@
 #line 3413
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3415
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3417
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3416
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3418
-                MOVE_SLUDGE,
-                MOVE_SMOKESCREEN,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3423
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3425
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3424
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3426
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_JAXON,
     },
 #line 3431
     [TRAINER_BIKER_WILLIAM] =
@@ -8375,99 +3779,7 @@
 #line 3438
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3440
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3442
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3441
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3443
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3448
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3450
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3449
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3451
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3456
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3458
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3457
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3459
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3464
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3466
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3465
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3467
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3472
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3474
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3473
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3475
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SELF_DESTRUCT,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_WILLIAM,
     },
 #line 3480
     [TRAINER_BIKER_LUKAS] =
@@ -8486,81 +3798,7 @@
 #line 3487
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3489
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3491
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3490
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3492
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3497
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3499
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3498
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3500
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3505
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3507
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3506
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3508
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 3513
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3515
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3514
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3516
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_LUKAS,
     },
 #line 3521
     [TRAINER_BIKER_ISAAC] =
@@ -8579,63 +3817,7 @@
 #line 3528
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3530
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3532
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3531
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3533
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 3538
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3540
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3539
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3541
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 3546
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3548
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3547
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3549
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_ISAAC,
     },
 #line 3554
     [TRAINER_BIKER_GERALD] =
@@ -8654,45 +3836,7 @@
 #line 3561
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3563
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3565
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3564
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3566
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 3571
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3573
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3572
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 3574
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_GERALD,
     },
 #line 3579
     [TRAINER_BURGLAR_1] =
@@ -8709,31 +3853,7 @@
 #line 3586
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3588
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3590
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3589
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3592
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3594
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3593
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_1,
     },
 #line 3596
     [TRAINER_BURGLAR_2] =
@@ -8750,20 +3870,7 @@
 #line 3603
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3605
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3607
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3606
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_2,
     },
 #line 3609
     [TRAINER_BURGLAR_3] =
@@ -8780,42 +3887,7 @@
 #line 3616
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3618
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3620
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3619
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3622
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3624
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3623
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3626
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3628
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3627
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_3,
     },
 #line 3630
     [TRAINER_BURGLAR_QUINN] =
@@ -8834,42 +3906,7 @@
 #line 3637
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3639
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3641
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3640
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3643
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3645
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3644
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3647
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3649
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3648
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_QUINN,
     },
 #line 3651
     [TRAINER_BURGLAR_RAMON] =
@@ -8888,20 +3925,7 @@
 #line 3658
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3660
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3662
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3661
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_RAMON,
     },
 #line 3664
     [TRAINER_BURGLAR_DUSTY] =
@@ -8920,31 +3944,7 @@
 #line 3671
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3673
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3675
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3674
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3677
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3679
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3678
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_DUSTY,
     },
 #line 3681
     [TRAINER_BURGLAR_ARNIE] =
@@ -8963,31 +3963,7 @@
 #line 3688
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3690
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3692
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3691
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3694
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3696
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3695
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_ARNIE,
     },
 #line 3698
     [TRAINER_BURGLAR_4] =
@@ -9004,31 +3980,7 @@
 #line 3705
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3707
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3709
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3708
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3711
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3713
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3712
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_4,
     },
 #line 3715
     [TRAINER_BURGLAR_SIMON] =
@@ -9047,20 +3999,7 @@
 #line 3722
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3724
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3726
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3725
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_SIMON,
     },
 #line 3728
     [TRAINER_BURGLAR_LEWIS] =
@@ -9079,31 +4018,7 @@
 #line 3735
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3737
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3739
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3738
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3741
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3743
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3742
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BURGLAR_LEWIS,
     },
 #line 3745
     [TRAINER_ENGINEER_BAILY] =
@@ -9122,31 +4037,7 @@
 #line 3752
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3754
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3756
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3755
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3758
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3760
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3759
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ENGINEER_BAILY,
     },
 #line 3762
     [TRAINER_ENGINEER_BRAXTON] =
@@ -9165,20 +4056,7 @@
 #line 3769
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3771
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3773
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3772
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ENGINEER_BRAXTON,
     },
 #line 3775
     [TRAINER_ENGINEER_BERNIE] =
@@ -9197,42 +4075,7 @@
 #line 3782
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3784
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3786
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3785
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3788
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3790
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3789
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3792
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3794
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3793
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ENGINEER_BERNIE,
     },
 #line 3796
     [TRAINER_FISHERMAN_DALE] =
@@ -9251,42 +4094,7 @@
 #line 3803
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3805
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3807
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3806
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3809
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3811
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3810
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3813
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3815
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3814
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_DALE,
     },
 #line 3817
     [TRAINER_FISHERMAN_BARNY] =
@@ -9305,42 +4113,7 @@
 #line 3824
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3826
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3828
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3827
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3830
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3832
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3831
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3834
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3836
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3835
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_BARNY,
     },
 #line 3838
     [TRAINER_FISHERMAN_NED] =
@@ -9359,42 +4132,7 @@
 #line 3845
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3847
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3849
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3848
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3851
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3853
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3852
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3855
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3857
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3856
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_NED,
     },
 #line 3859
     [TRAINER_FISHERMAN_CHIP] =
@@ -9413,31 +4151,7 @@
 #line 3866
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3868
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3870
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3869
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3872
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3874
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3873
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_CHIP,
     },
 #line 3876
     [TRAINER_FISHERMAN_HANK] =
@@ -9456,20 +4170,7 @@
 #line 3883
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3885
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3887
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3886
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_HANK,
     },
 #line 3889
     [TRAINER_FISHERMAN_ELLIOT] =
@@ -9488,53 +4189,7 @@
 #line 3896
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3898
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3900
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3899
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3902
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3904
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3903
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3906
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3908
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3907
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3910
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3912
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3911
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_ELLIOT,
     },
 #line 3914
     [TRAINER_FISHERMAN_RONALD] =
@@ -9553,53 +4208,7 @@
 #line 3921
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3923
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3925
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3924
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3927
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3929
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3928
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3931
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3933
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3932
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3935
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3937
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3936
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_RONALD,
     },
 #line 3939
     [TRAINER_FISHERMAN_CLAUDE] =
@@ -9618,31 +4227,7 @@
 #line 3946
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3948
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3950
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3949
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3952
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3954
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3953
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_CLAUDE,
     },
 #line 3956
     [TRAINER_FISHERMAN_WADE] =
@@ -9661,75 +4246,7 @@
 #line 3963
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3965
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3967
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3966
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3969
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3971
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3970
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3973
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3975
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3974
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3977
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3979
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3978
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3981
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3983
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3982
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 3985
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 3987
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3986
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_WADE,
     },
 #line 3989
     [TRAINER_FISHERMAN_NOLAN] =
@@ -9748,31 +4265,7 @@
 #line 3996
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 3998
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4000
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 3999
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4002
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4004
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4003
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_NOLAN,
     },
 #line 4006
     [TRAINER_FISHERMAN_ANDREW] =
@@ -9791,31 +4284,7 @@
 #line 4013
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4015
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4017
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4016
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4019
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4021
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4020
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_ANDREW,
     },
 #line 4023
     [TRAINER_SWIMMER_MALE_LUIS] =
@@ -9834,31 +4303,7 @@
 #line 4030
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4032
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4034
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4033
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4036
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4038
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4037
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_LUIS,
     },
 #line 4040
     [TRAINER_SWIMMER_MALE_RICHARD] =
@@ -9877,31 +4322,7 @@
 #line 4047
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4049
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4051
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4050
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4053
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4055
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4054
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_RICHARD,
     },
 #line 4057
     [TRAINER_SWIMMER_MALE_REECE] =
@@ -9920,42 +4341,7 @@
 #line 4064
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4066
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4068
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4067
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4070
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4072
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4071
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4074
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4076
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4075
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_REECE,
     },
 #line 4078
     [TRAINER_SWIMMER_MALE_MATTHEW] =
@@ -9974,31 +4360,7 @@
 #line 4085
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4087
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4089
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4088
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4091
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4093
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4092
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_MATTHEW,
     },
 #line 4095
     [TRAINER_SWIMMER_MALE_DOUGLAS] =
@@ -10017,53 +4379,7 @@
 #line 4102
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4104
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4106
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4105
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4108
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4110
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4109
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4112
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4114
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4113
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4116
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4118
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4117
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_DOUGLAS,
     },
 #line 4120
     [TRAINER_SWIMMER_MALE_DAVID] =
@@ -10082,42 +4398,7 @@
 #line 4127
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4129
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4131
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4130
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4133
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4135
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4134
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4137
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4139
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4138
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_DAVID,
     },
 #line 4141
     [TRAINER_SWIMMER_MALE_TONY] =
@@ -10136,31 +4417,7 @@
 #line 4148
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4150
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4152
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4151
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4154
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4156
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4155
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_TONY,
     },
 #line 4158
     [TRAINER_SWIMMER_MALE_AXLE] =
@@ -10179,64 +4436,7 @@
 #line 4165
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4167
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4169
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4168
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4171
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4173
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4172
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4175
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4177
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4176
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4179
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4181
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4180
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4183
-            .species = SPECIES_TENTACRUEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4185
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4184
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_AXLE,
     },
 #line 4187
     [TRAINER_SWIMMER_MALE_BARRY] =
@@ -10255,31 +4455,7 @@
 #line 4194
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4196
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4198
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4197
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4200
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4202
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4201
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_BARRY,
     },
 #line 4204
     [TRAINER_SWIMMER_MALE_DEAN] =
@@ -10298,20 +4474,7 @@
 #line 4211
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4213
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4215
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4214
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_DEAN,
     },
 #line 4217
     [TRAINER_SWIMMER_MALE_DARRIN] =
@@ -10330,53 +4493,7 @@
 #line 4224
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4226
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4228
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4227
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4230
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4232
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4231
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4234
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4236
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4235
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4238
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4240
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4239
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_DARRIN,
     },
 #line 4242
     [TRAINER_SWIMMER_MALE_SPENCER] =
@@ -10395,31 +4512,7 @@
 #line 4249
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4251
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4253
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4252
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4255
-            .species = SPECIES_TENTACRUEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4257
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4256
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_SPENCER,
     },
 #line 4259
     [TRAINER_SWIMMER_MALE_JACK] =
@@ -10438,20 +4531,7 @@
 #line 4266
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4268
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4270
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4269
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_JACK,
     },
 #line 4272
     [TRAINER_SWIMMER_MALE_JEROME] =
@@ -10470,31 +4550,7 @@
 #line 4279
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4281
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4283
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4282
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4285
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4287
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4286
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_JEROME,
     },
 #line 4289
     [TRAINER_SWIMMER_MALE_ROLAND] =
@@ -10513,42 +4569,7 @@
 #line 4296
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4298
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4300
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4299
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4302
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4304
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4303
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4306
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4308
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4307
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_ROLAND,
     },
 #line 4310
     [TRAINER_CUE_BALL_KOJI] =
@@ -10567,42 +4588,7 @@
 #line 4317
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4319
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4321
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4320
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4323
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4325
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4324
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4327
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4329
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4328
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_KOJI,
     },
 #line 4331
     [TRAINER_CUE_BALL_LUKE] =
@@ -10621,31 +4607,7 @@
 #line 4338
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4340
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4342
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4341
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4344
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4346
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4345
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_LUKE,
     },
 #line 4348
     [TRAINER_CUE_BALL_CAMRON] =
@@ -10664,31 +4626,7 @@
 #line 4355
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4357
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4359
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4358
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4361
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4363
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4362
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_CAMRON,
     },
 #line 4365
     [TRAINER_CUE_BALL_RAUL] =
@@ -10707,31 +4645,7 @@
 #line 4372
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4374
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4376
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4375
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4378
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4380
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4379
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_RAUL,
     },
 #line 4382
     [TRAINER_CUE_BALL_ISAIAH] =
@@ -10750,31 +4664,7 @@
 #line 4389
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4391
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4393
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4392
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4395
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4397
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4396
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_ISAIAH,
     },
 #line 4399
     [TRAINER_CUE_BALL_ZEEK] =
@@ -10793,20 +4683,7 @@
 #line 4406
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4408
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4410
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4409
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_ZEEK,
     },
 #line 4412
     [TRAINER_CUE_BALL_JAMAL] =
@@ -10825,53 +4702,7 @@
 #line 4419
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4421
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4423
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4422
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4425
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4427
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4426
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4429
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4431
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4430
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4433
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4435
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4434
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_JAMAL,
     },
 #line 4437
     [TRAINER_CUE_BALL_COREY] =
@@ -10890,31 +4721,7 @@
 #line 4444
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4446
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4448
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4447
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4450
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4452
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4451
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_COREY,
     },
 #line 4454
     [TRAINER_CUE_BALL_CHASE] =
@@ -10933,42 +4740,7 @@
 #line 4461
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4463
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4465
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4464
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4467
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4469
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4468
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4471
-            .species = SPECIES_TENTACRUEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4473
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4472
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_CHASE,
     },
 #line 4475
     [TRAINER_GAMER_HUGO] =
@@ -10987,31 +4759,7 @@
 #line 4482
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4484
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4486
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4485
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4488
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4490
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4489
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_HUGO,
     },
 #line 4492
     [TRAINER_GAMER_JASPER] =
@@ -11030,31 +4778,7 @@
 #line 4499
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4501
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4503
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4502
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4505
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4507
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4506
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_JASPER,
     },
 #line 4509
     [TRAINER_GAMER_DIRK] =
@@ -11073,31 +4797,7 @@
 #line 4516
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4518
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4520
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4519
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4522
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4524
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4523
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_DIRK,
     },
 #line 4526
     [TRAINER_GAMER_DARIAN] =
@@ -11116,31 +4816,7 @@
 #line 4533
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4535
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4537
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4536
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4539
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4541
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4540
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_DARIAN,
     },
 #line 4543
     [TRAINER_GAMER_STAN] =
@@ -11159,42 +4835,7 @@
 #line 4550
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4552
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4554
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4553
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4556
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4558
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4557
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4560
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4562
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4561
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_STAN,
     },
 #line 4564
     [TRAINER_GAMER_1] =
@@ -11211,20 +4852,7 @@
 #line 4571
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4573
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4575
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4574
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_1,
     },
 #line 4577
     [TRAINER_GAMER_RICH] =
@@ -11243,31 +4871,7 @@
 #line 4584
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4586
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4588
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4587
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4590
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4592
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4591
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_RICH,
     },
 #line 4594
     [TRAINER_BEAUTY_BRIDGET] =
@@ -11286,53 +4890,7 @@
 #line 4601
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4603
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4605
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4604
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4607
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4609
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4608
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4611
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4613
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4612
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4615
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4617
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4616
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_BRIDGET,
     },
 #line 4619
     [TRAINER_BEAUTY_TAMIA] =
@@ -11351,31 +4909,7 @@
 #line 4626
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4628
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4630
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4629
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4632
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4634
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4633
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_TAMIA,
     },
 #line 4636
     [TRAINER_BEAUTY_LORI] =
@@ -11394,20 +4928,7 @@
 #line 4643
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4645
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4647
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4646
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_LORI,
     },
 #line 4649
     [TRAINER_BEAUTY_LOLA] =
@@ -11426,42 +4947,7 @@
 #line 4656
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4658
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4660
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4659
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4662
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4664
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4663
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4666
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4668
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4667
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_LOLA,
     },
 #line 4670
     [TRAINER_BEAUTY_SHEILA] =
@@ -11480,31 +4966,7 @@
 #line 4677
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4679
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4681
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4680
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4683
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4685
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4684
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_SHEILA,
     },
 #line 4687
     [TRAINER_SWIMMER_FEMALE_TIFFANY] =
@@ -11523,20 +4985,7 @@
 #line 4694
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4696
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4698
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4697
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_TIFFANY,
     },
 #line 4700
     [TRAINER_SWIMMER_FEMALE_NORA] =
@@ -11555,42 +5004,7 @@
 #line 4707
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4709
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4711
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4710
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4713
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4715
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4714
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4717
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4719
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4718
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_NORA,
     },
 #line 4721
     [TRAINER_SWIMMER_FEMALE_MELISSA] =
@@ -11609,31 +5023,7 @@
 #line 4728
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4730
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4732
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4731
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4734
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4736
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4735
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_MELISSA,
     },
 #line 4738
     [TRAINER_BEAUTY_GRACE] =
@@ -11652,31 +5042,7 @@
 #line 4745
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4747
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4749
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4748
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4751
-            .species = SPECIES_WIGGLYTUFF,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4753
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4752
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_GRACE,
     },
 #line 4755
     [TRAINER_BEAUTY_OLIVIA] =
@@ -11695,31 +5061,7 @@
 #line 4762
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4764
-            .species = SPECIES_BULBASAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4766
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4765
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4768
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4770
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4769
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_OLIVIA,
     },
 #line 4772
     [TRAINER_BEAUTY_LAUREN] =
@@ -11738,42 +5080,7 @@
 #line 4779
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4781
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4783
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4782
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4785
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4787
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4786
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4789
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4791
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4790
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_LAUREN,
     },
 #line 4793
     [TRAINER_SWIMMER_FEMALE_ANYA] =
@@ -11792,64 +5099,7 @@
 #line 4800
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4802
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4804
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4803
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4806
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4808
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4807
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4810
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4812
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4811
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4814
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4816
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4815
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4818
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4820
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4819
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_ANYA,
     },
 #line 4822
     [TRAINER_SWIMMER_FEMALE_ALICE] =
@@ -11868,31 +5118,7 @@
 #line 4829
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4831
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4833
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4832
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4835
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4837
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4836
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_ALICE,
     },
 #line 4839
     [TRAINER_SWIMMER_FEMALE_CONNIE] =
@@ -11911,42 +5137,7 @@
 #line 4846
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4848
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4850
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4849
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4852
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4854
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4853
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4856
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4858
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4857
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_CONNIE,
     },
 #line 4860
     [TRAINER_SWIMMER_FEMALE_SHIRLEY] =
@@ -11965,42 +5156,7 @@
 #line 4867
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4869
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4871
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4870
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4873
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4875
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4874
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4877
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4879
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4878
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_SHIRLEY,
     },
 #line 4881
     [TRAINER_PSYCHIC_JOHAN] =
@@ -12019,53 +5175,7 @@
 #line 4888
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4890
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4892
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4891
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4894
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4896
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4895
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4898
-            .species = SPECIES_MR_MIME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4900
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4899
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4902
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4904
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4903
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_JOHAN,
     },
 #line 4906
     [TRAINER_PSYCHIC_TYRON] =
@@ -12084,31 +5194,7 @@
 #line 4913
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4915
-            .species = SPECIES_MR_MIME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4917
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4916
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4919
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4921
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4920
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_TYRON,
     },
 #line 4923
     [TRAINER_PSYCHIC_CAMERON] =
@@ -12127,42 +5213,7 @@
 #line 4930
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4932
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4934
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4933
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4936
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4938
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4937
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4940
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4942
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4941
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_CAMERON,
     },
 #line 4944
     [TRAINER_PSYCHIC_PRESTON] =
@@ -12181,20 +5232,7 @@
 #line 4951
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4953
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4955
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 4954
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_PRESTON,
     },
 #line 4957
     [TRAINER_ROCKER_RANDALL] =
@@ -12213,42 +5251,7 @@
 #line 4964
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4966
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4968
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4967
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4970
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4972
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4971
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4974
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4976
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4975
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ROCKER_RANDALL,
     },
 #line 4978
     [TRAINER_ROCKER_LUCA] =
@@ -12267,31 +5270,7 @@
 #line 4985
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 4987
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4989
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4988
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 4991
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 4993
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 4992
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ROCKER_LUCA,
     },
 #line 4995
     [TRAINER_JUGGLER_DALTON] =
@@ -12310,31 +5289,7 @@
 #line 5002
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5004
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5006
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5005
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5008
-            .species = SPECIES_MR_MIME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5010
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5009
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_DALTON,
     },
 #line 5012
     [TRAINER_JUGGLER_NELSON] =
@@ -12353,53 +5308,7 @@
 #line 5019
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5021
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5023
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5022
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5025
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5027
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5026
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5029
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5031
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5030
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5033
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5035
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5034
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_NELSON,
     },
 #line 5037
     [TRAINER_JUGGLER_KIRK] =
@@ -12418,53 +5327,7 @@
 #line 5044
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5046
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5048
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5047
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5050
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5052
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5051
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5054
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5056
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5055
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5058
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5060
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5059
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_KIRK,
     },
 #line 5062
     [TRAINER_JUGGLER_SHAWN] =
@@ -12483,31 +5346,7 @@
 #line 5069
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5071
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5073
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5072
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5075
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5077
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5076
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_SHAWN,
     },
 #line 5079
     [TRAINER_JUGGLER_GREGORY] =
@@ -12526,27 +5365,7 @@
 #line 5086
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5088
-            .species = SPECIES_MR_MIME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5090
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5089
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5091
-                MOVE_PSYCHIC,
-                MOVE_ROLE_PLAY,
-                MOVE_DOUBLE_SLAP,
-                MOVE_ENCORE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_GREGORY,
     },
 #line 5096
     [TRAINER_JUGGLER_EDWARD] =
@@ -12565,81 +5384,7 @@
 #line 5103
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5105
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5107
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5106
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5108
-                MOVE_SWIFT,
-                MOVE_LIGHT_SCREEN,
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-            },
-            },
-            {
-#line 5113
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5115
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5114
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5116
-                MOVE_SWIFT,
-                MOVE_LIGHT_SCREEN,
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-            },
-            },
-            {
-#line 5121
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5123
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5122
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5124
-                MOVE_SWIFT,
-                MOVE_SPARK,
-                MOVE_SELF_DESTRUCT,
-                MOVE_SONIC_BOOM,
-            },
-            },
-            {
-#line 5129
-            .species = SPECIES_MR_MIME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5131
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5130
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5132
-                MOVE_PSYCHIC,
-                MOVE_ROLE_PLAY,
-                MOVE_REFLECT,
-                MOVE_ENCORE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_EDWARD,
     },
 #line 5137
     [TRAINER_JUGGLER_KAYDEN] =
@@ -12658,20 +5403,7 @@
 #line 5144
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5146
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5148
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5147
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_KAYDEN,
     },
 #line 5150
     [TRAINER_JUGGLER_NATE] =
@@ -12690,31 +5422,7 @@
 #line 5157
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5159
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5161
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5160
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5163
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5165
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5164
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_NATE,
     },
 #line 5167
     [TRAINER_TAMER_PHIL] =
@@ -12733,31 +5441,7 @@
 #line 5174
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5176
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5178
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5177
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5180
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5182
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5181
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_PHIL,
     },
 #line 5184
     [TRAINER_TAMER_EDGAR] =
@@ -12776,42 +5460,7 @@
 #line 5191
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5193
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5195
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5194
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5197
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5199
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5198
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5201
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5203
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5202
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_EDGAR,
     },
 #line 5205
     [TRAINER_TAMER_JASON] =
@@ -12830,20 +5479,7 @@
 #line 5212
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5214
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5216
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5215
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_JASON,
     },
 #line 5218
     [TRAINER_TAMER_COLE] =
@@ -12862,31 +5498,7 @@
 #line 5225
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5227
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5229
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5228
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5231
-            .species = SPECIES_TAUROS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5233
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5232
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_COLE,
     },
 #line 5235
     [TRAINER_TAMER_VINCENT] =
@@ -12905,31 +5517,7 @@
 #line 5242
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5244
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5246
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5245
-            .lvl = 44,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5248
-            .species = SPECIES_GOLDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5250
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5249
-            .lvl = 44,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_VINCENT,
     },
 #line 5252
     [TRAINER_TAMER_JOHN] =
@@ -12948,53 +5536,7 @@
 #line 5259
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5261
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5263
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5262
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5265
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5267
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5266
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5269
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5271
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5270
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5273
-            .species = SPECIES_TAUROS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5275
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 5274
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_JOHN,
     },
 #line 5277
     [TRAINER_BIRD_KEEPER_SEBASTIAN] =
@@ -13013,31 +5555,7 @@
 #line 5284
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5286
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5288
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5287
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5290
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5292
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5291
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_SEBASTIAN,
     },
 #line 5294
     [TRAINER_BIRD_KEEPER_PERRY] =
@@ -13056,64 +5574,7 @@
 #line 5301
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5303
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5305
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5304
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5307
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5309
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5308
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5311
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5313
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5312
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5315
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5317
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5316
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5319
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5321
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5320
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_PERRY,
     },
 #line 5323
     [TRAINER_BIRD_KEEPER_ROBERT] =
@@ -13132,53 +5593,7 @@
 #line 5330
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5332
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5334
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5333
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5336
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5338
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5337
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5340
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5342
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5341
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5344
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5346
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5345
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_ROBERT,
     },
 #line 5348
     [TRAINER_BIRD_KEEPER_DONALD] =
@@ -13197,20 +5612,7 @@
 #line 5355
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5357
-            .species = SPECIES_FARFETCHD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5359
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5358
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_DONALD,
     },
 #line 5361
     [TRAINER_BIRD_KEEPER_BENNY] =
@@ -13229,31 +5631,7 @@
 #line 5368
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5370
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5372
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5371
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5374
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5376
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5375
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_BENNY,
     },
 #line 5378
     [TRAINER_BIRD_KEEPER_EDWIN] =
@@ -13272,53 +5650,7 @@
 #line 5385
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5387
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5389
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5388
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5391
-            .species = SPECIES_FARFETCHD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5393
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5392
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5395
-            .species = SPECIES_DODUO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5397
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5396
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5399
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5401
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5400
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_EDWIN,
     },
 #line 5403
     [TRAINER_BIRD_KEEPER_CHESTER] =
@@ -13337,42 +5669,7 @@
 #line 5410
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5412
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5414
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5413
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5416
-            .species = SPECIES_DODUO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5418
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5417
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5420
-            .species = SPECIES_DODUO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5422
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5421
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_CHESTER,
     },
 #line 5424
     [TRAINER_BIRD_KEEPER_WILTON] =
@@ -13391,31 +5688,7 @@
 #line 5431
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5433
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5435
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5434
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5437
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5439
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5438
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_WILTON,
     },
 #line 5441
     [TRAINER_BIRD_KEEPER_RAMIRO] =
@@ -13434,20 +5707,7 @@
 #line 5448
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5450
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5452
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5451
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_RAMIRO,
     },
 #line 5454
     [TRAINER_BIRD_KEEPER_JACOB] =
@@ -13466,53 +5726,7 @@
 #line 5461
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5463
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5465
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5464
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5467
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5469
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5468
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5471
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5473
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5472
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5475
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5477
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5476
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_JACOB,
     },
 #line 5479
     [TRAINER_BIRD_KEEPER_ROGER] =
@@ -13531,42 +5745,7 @@
 #line 5486
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5488
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5490
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5489
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5492
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5494
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5493
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5496
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5498
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5497
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_ROGER,
     },
 #line 5500
     [TRAINER_BIRD_KEEPER_REED] =
@@ -13585,53 +5764,7 @@
 #line 5507
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5509
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5511
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5510
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5513
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5515
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5514
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5517
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5519
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5518
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5521
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5523
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5522
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_REED,
     },
 #line 5525
     [TRAINER_BIRD_KEEPER_KEITH] =
@@ -13650,31 +5783,7 @@
 #line 5532
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5534
-            .species = SPECIES_FARFETCHD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5536
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5535
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5538
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5540
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5539
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_KEITH,
     },
 #line 5542
     [TRAINER_BIRD_KEEPER_CARTER] =
@@ -13693,42 +5802,7 @@
 #line 5549
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5551
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5553
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5552
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5555
-            .species = SPECIES_DODUO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5557
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5556
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5559
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5561
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5560
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_CARTER,
     },
 #line 5563
     [TRAINER_BIRD_KEEPER_MITCH] =
@@ -13747,53 +5821,7 @@
 #line 5570
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5572
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5574
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5573
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5576
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5578
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5577
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5580
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5582
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5581
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5584
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5586
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5585
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_MITCH,
     },
 #line 5588
     [TRAINER_BIRD_KEEPER_BECK] =
@@ -13812,31 +5840,7 @@
 #line 5595
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5597
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5599
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5598
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5601
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5603
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5602
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_BECK,
     },
 #line 5605
     [TRAINER_BIRD_KEEPER_MARLON] =
@@ -13855,42 +5859,7 @@
 #line 5612
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5614
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5616
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5615
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5618
-            .species = SPECIES_DODUO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5620
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5619
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5622
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5624
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5623
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_MARLON,
     },
 #line 5626
     [TRAINER_BLACK_BELT_KOICHI] =
@@ -13908,36 +5877,8 @@
         .doubleBattle = FALSE,
 #line 5633
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
-        .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5635
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5635
-            .heldItem = ITEM_BLACK_BELT,
-#line 5637
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5636
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5639
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5639
-            .heldItem = ITEM_BLACK_BELT,
-#line 5641
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5640
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .partySize = 2,
+        .party = gTrainerParty_TRAINER_BLACK_BELT_KOICHI,
     },
 #line 5643
     [TRAINER_BLACK_BELT_MIKE] =
@@ -13956,48 +5897,7 @@
 #line 5650
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5652
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5652
-            .heldItem = ITEM_BLACK_BELT,
-#line 5654
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5653
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5656
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5656
-            .heldItem = ITEM_BLACK_BELT,
-#line 5658
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5657
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5660
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5660
-            .heldItem = ITEM_BLACK_BELT,
-#line 5662
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5661
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_MIKE,
     },
 #line 5664
     [TRAINER_BLACK_BELT_HIDEKI] =
@@ -14016,35 +5916,7 @@
 #line 5671
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5673
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5673
-            .heldItem = ITEM_BLACK_BELT,
-#line 5675
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5674
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5677
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5677
-            .heldItem = ITEM_BLACK_BELT,
-#line 5679
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5678
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_HIDEKI,
     },
 #line 5681
     [TRAINER_BLACK_BELT_AARON] =
@@ -14063,22 +5935,7 @@
 #line 5688
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5690
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5690
-            .heldItem = ITEM_BLACK_BELT,
-#line 5692
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5691
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_AARON,
     },
 #line 5694
     [TRAINER_BLACK_BELT_HITOSHI] =
@@ -14097,48 +5954,7 @@
 #line 5701
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5703
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5703
-            .heldItem = ITEM_BLACK_BELT,
-#line 5705
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5704
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5707
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5707
-            .heldItem = ITEM_BLACK_BELT,
-#line 5709
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5708
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5711
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5711
-            .heldItem = ITEM_BLACK_BELT,
-#line 5713
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5712
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_HITOSHI,
     },
 #line 5715
     [TRAINER_BLACK_BELT_ATSUSHI] =
@@ -14157,35 +5973,7 @@
 #line 5722
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5724
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5724
-            .heldItem = ITEM_BLACK_BELT,
-#line 5726
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5725
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5728
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5728
-            .heldItem = ITEM_BLACK_BELT,
-#line 5730
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5729
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_ATSUSHI,
     },
 #line 5732
     [TRAINER_BLACK_BELT_KIYO] =
@@ -14204,22 +5992,7 @@
 #line 5739
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5741
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5741
-            .heldItem = ITEM_BLACK_BELT,
-#line 5743
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5742
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_KIYO,
     },
 #line 5745
     [TRAINER_BLACK_BELT_TAKASHI] =
@@ -14238,48 +6011,7 @@
 #line 5752
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5754
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5754
-            .heldItem = ITEM_BLACK_BELT,
-#line 5756
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5755
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5758
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5758
-            .heldItem = ITEM_BLACK_BELT,
-#line 5760
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5759
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5762
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5762
-            .heldItem = ITEM_BLACK_BELT,
-#line 5764
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5763
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_TAKASHI,
     },
 #line 5766
     [TRAINER_BLACK_BELT_DAISUKE] =
@@ -14298,48 +6030,7 @@
 #line 5773
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5775
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5775
-            .heldItem = ITEM_BLACK_BELT,
-#line 5777
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5776
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5779
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5779
-            .heldItem = ITEM_BLACK_BELT,
-#line 5781
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5780
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 5783
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5783
-            .heldItem = ITEM_BLACK_BELT,
-#line 5785
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5784
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_DAISUKE,
     },
 #line 5787
     [TRAINER_RIVAL_OAKS_LAB_SQUIRTLE] =
@@ -14358,25 +6049,7 @@
 #line 5794
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5796
-            .species = SPECIES_SQUIRTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5798
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5797
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5799
-                MOVE_TACKLE,
-                MOVE_TAIL_WHIP,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_OAKS_LAB_SQUIRTLE,
     },
 #line 5802
     [TRAINER_RIVAL_OAKS_LAB_BULBASAUR] =
@@ -14395,25 +6068,7 @@
 #line 5809
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5811
-            .species = SPECIES_BULBASAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5813
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5812
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5814
-                MOVE_TACKLE,
-                MOVE_GROWL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_OAKS_LAB_BULBASAUR,
     },
 #line 5817
     [TRAINER_RIVAL_OAKS_LAB_CHARMANDER] =
@@ -14432,25 +6087,7 @@
 #line 5824
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5826
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5828
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 5827
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5829
-                MOVE_SCRATCH,
-                MOVE_GROWL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_OAKS_LAB_CHARMANDER,
     },
 #line 5832
     [TRAINER_RIVAL_ROUTE22_EARLY_SQUIRTLE] =
@@ -14469,41 +6106,7 @@
 #line 5839
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5841
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5843
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5842
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5844
-                MOVE_TACKLE,
-                MOVE_SAND_ATTACK,
-            },
-            },
-            {
-#line 5847
-            .species = SPECIES_SQUIRTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5849
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5848
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5850
-                MOVE_TACKLE,
-                MOVE_TAIL_WHIP,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_ROUTE22_EARLY_SQUIRTLE,
     },
 #line 5853
     [TRAINER_RIVAL_ROUTE22_EARLY_BULBASAUR] =
@@ -14522,41 +6125,7 @@
 #line 5860
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5862
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5864
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5863
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5865
-                MOVE_TACKLE,
-                MOVE_SAND_ATTACK,
-            },
-            },
-            {
-#line 5868
-            .species = SPECIES_BULBASAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5870
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5869
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5871
-                MOVE_TACKLE,
-                MOVE_GROWL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_ROUTE22_EARLY_BULBASAUR,
     },
 #line 5874
     [TRAINER_RIVAL_ROUTE22_EARLY_CHARMANDER] =
@@ -14575,41 +6144,7 @@
 #line 5881
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5883
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5885
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5884
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5886
-                MOVE_TACKLE,
-                MOVE_SAND_ATTACK,
-            },
-            },
-            {
-#line 5889
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5891
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5890
-            .lvl = 9,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5892
-                MOVE_SCRATCH,
-                MOVE_GROWL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_ROUTE22_EARLY_CHARMANDER,
     },
 #line 5895
     [TRAINER_RIVAL_CERULEAN_SQUIRTLE] =
@@ -14628,77 +6163,7 @@
 #line 5902
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5904
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5906
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5905
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5907
-                MOVE_TACKLE,
-                MOVE_SAND_ATTACK,
-                MOVE_GUST,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 5912
-            .species = SPECIES_ABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5914
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5913
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5915
-                MOVE_TELEPORT,
-            },
-            },
-            {
-#line 5917
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5919
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5918
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5920
-                MOVE_TACKLE,
-                MOVE_TAIL_WHIP,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 5924
-            .species = SPECIES_SQUIRTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5926
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5925
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5927
-                MOVE_TACKLE,
-                MOVE_TAIL_WHIP,
-                MOVE_WITHDRAW,
-                MOVE_WATER_GUN,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_CERULEAN_SQUIRTLE,
     },
 #line 5932
     [TRAINER_RIVAL_CERULEAN_BULBASAUR] =
@@ -14717,77 +6182,7 @@
 #line 5939
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5941
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5943
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5942
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5944
-                MOVE_TACKLE,
-                MOVE_SAND_ATTACK,
-                MOVE_GUST,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 5949
-            .species = SPECIES_ABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5951
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5950
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5952
-                MOVE_TELEPORT,
-            },
-            },
-            {
-#line 5954
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5956
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5955
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5957
-                MOVE_TACKLE,
-                MOVE_TAIL_WHIP,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 5961
-            .species = SPECIES_BULBASAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5963
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5962
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5964
-                MOVE_SLEEP_POWDER,
-                MOVE_POISON_POWDER,
-                MOVE_VINE_WHIP,
-                MOVE_LEECH_SEED,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_CERULEAN_BULBASAUR,
     },
 #line 5969
     [TRAINER_RIVAL_CERULEAN_CHARMANDER] =
@@ -14806,77 +6201,7 @@
 #line 5976
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 5978
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5980
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5979
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5981
-                MOVE_TACKLE,
-                MOVE_SAND_ATTACK,
-                MOVE_GUST,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 5986
-            .species = SPECIES_ABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5988
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5987
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5989
-                MOVE_TELEPORT,
-            },
-            },
-            {
-#line 5991
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 5993
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 5992
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 5994
-                MOVE_TACKLE,
-                MOVE_TAIL_WHIP,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 5998
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6000
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 5999
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6001
-                MOVE_METAL_CLAW,
-                MOVE_EMBER,
-                MOVE_GROWL,
-                MOVE_SCRATCH,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_CERULEAN_CHARMANDER,
     },
 #line 6006
     [TRAINER_SCIENTIST_TED] =
@@ -14895,31 +6220,7 @@
 #line 6013
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6015
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6017
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6016
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6019
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6021
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6020
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_TED,
     },
 #line 6023
     [TRAINER_SCIENTIST_CONNOR] =
@@ -14938,81 +6239,7 @@
 #line 6030
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6032
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6034
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6033
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6035
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 6040
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6042
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6041
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6043
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 6048
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6050
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6049
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6051
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-            {
-#line 6056
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6058
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6057
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6059
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_CONNOR,
     },
 #line 6064
     [TRAINER_SCIENTIST_JERRY] =
@@ -15031,42 +6258,7 @@
 #line 6071
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6073
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6075
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6074
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6077
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6079
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6078
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6081
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6083
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6082
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_JERRY,
     },
 #line 6085
     [TRAINER_SCIENTIST_JOSE] =
@@ -15085,45 +6277,7 @@
 #line 6092
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6094
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6096
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6095
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6097
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 6102
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6104
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6103
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6105
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_JOSE,
     },
 #line 6110
     [TRAINER_SCIENTIST_RODNEY] =
@@ -15142,20 +6296,7 @@
 #line 6117
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6119
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6121
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6120
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_RODNEY,
     },
 #line 6123
     [TRAINER_SCIENTIST_BEAU] =
@@ -15174,81 +6315,7 @@
 #line 6130
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6132
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6134
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6133
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6135
-                MOVE_SPARK,
-                MOVE_THUNDER_WAVE,
-                MOVE_SONIC_BOOM,
-                MOVE_SUPERSONIC,
-            },
-            },
-            {
-#line 6140
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6142
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6141
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6143
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 6148
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6150
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6149
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6151
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 6156
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6158
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6157
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6159
-                MOVE_SPARK,
-                MOVE_THUNDER_WAVE,
-                MOVE_SONIC_BOOM,
-                MOVE_SUPERSONIC,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_BEAU,
     },
 #line 6164
     [TRAINER_SCIENTIST_TAYLOR] =
@@ -15267,99 +6334,7 @@
 #line 6171
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6173
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6175
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6174
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6176
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 6181
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6183
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6182
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6184
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 6189
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6191
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6190
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6192
-                MOVE_THUNDER_WAVE,
-                MOVE_SONIC_BOOM,
-                MOVE_SUPERSONIC,
-                MOVE_THUNDER_SHOCK,
-            },
-            },
-            {
-#line 6197
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6199
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6198
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6200
-                MOVE_THUNDER_WAVE,
-                MOVE_SONIC_BOOM,
-                MOVE_SUPERSONIC,
-                MOVE_THUNDER_SHOCK,
-            },
-            },
-            {
-#line 6205
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6207
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6206
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6208
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_TAYLOR,
     },
 #line 6213
     [TRAINER_SCIENTIST_JOSHUA] =
@@ -15378,31 +6353,7 @@
 #line 6220
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6222
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6224
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6223
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6226
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6228
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6227
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_JOSHUA,
     },
 #line 6230
     [TRAINER_SCIENTIST_PARKER] =
@@ -15421,31 +6372,7 @@
 #line 6237
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6239
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6241
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6240
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6243
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6245
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6244
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_PARKER,
     },
 #line 6247
     [TRAINER_SCIENTIST_ED] =
@@ -15464,63 +6391,7 @@
 #line 6254
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6256
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6258
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6257
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6259
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 6264
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6266
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6265
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6267
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_TACKLE,
-                MOVE_SMOG,
-            },
-            },
-            {
-#line 6272
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6274
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6273
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6275
-                MOVE_SPARK,
-                MOVE_THUNDER_WAVE,
-                MOVE_SONIC_BOOM,
-                MOVE_SUPERSONIC,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_ED,
     },
 #line 6280
     [TRAINER_SCIENTIST_TRAVIS] =
@@ -15539,31 +6410,7 @@
 #line 6287
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6289
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6291
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6290
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6293
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6295
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6294
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_TRAVIS,
     },
 #line 6297
     [TRAINER_SCIENTIST_BRAYDON] =
@@ -15582,42 +6429,7 @@
 #line 6304
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6306
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6308
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6307
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6310
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6312
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6311
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6314
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6316
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6315
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_BRAYDON,
     },
 #line 6318
     [TRAINER_SCIENTIST_IVAN] =
@@ -15636,31 +6448,7 @@
 #line 6325
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6327
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6329
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6328
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6331
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6333
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6332
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_IVAN,
     },
 #line 6335
     [TRAINER_BOSS_GIOVANNI] =
@@ -15679,42 +6467,7 @@
 #line 6342
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6344
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6346
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 6345
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6348
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6350
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 6349
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6352
-            .species = SPECIES_KANGASKHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6354
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 6353
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BOSS_GIOVANNI,
     },
 #line 6356
     [TRAINER_BOSS_GIOVANNI_2] =
@@ -15733,53 +6486,7 @@
 #line 6363
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6365
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6367
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 6366
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6369
-            .species = SPECIES_KANGASKHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6371
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 6370
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6373
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6375
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 6374
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6377
-            .species = SPECIES_NIDOQUEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6379
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 6378
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BOSS_GIOVANNI_2,
     },
 #line 6381
     [TRAINER_LEADER_GIOVANNI] =
@@ -15800,99 +6507,7 @@
 #line 6389
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6391
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6393
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6392
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6394
-                MOVE_TAKE_DOWN,
-                MOVE_ROCK_BLAST,
-                MOVE_SCARY_FACE,
-                MOVE_EARTHQUAKE,
-            },
-            },
-            {
-#line 6399
-            .species = SPECIES_DUGTRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6401
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6400
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6402
-                MOVE_SLASH,
-                MOVE_SAND_TOMB,
-                MOVE_MUD_SLAP,
-                MOVE_EARTHQUAKE,
-            },
-            },
-            {
-#line 6407
-            .species = SPECIES_NIDOQUEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6409
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6408
-            .lvl = 44,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6410
-                MOVE_BODY_SLAM,
-                MOVE_DOUBLE_KICK,
-                MOVE_POISON_STING,
-                MOVE_EARTHQUAKE,
-            },
-            },
-            {
-#line 6415
-            .species = SPECIES_NIDOKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6417
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6416
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6418
-                MOVE_THRASH,
-                MOVE_DOUBLE_KICK,
-                MOVE_POISON_STING,
-                MOVE_EARTHQUAKE,
-            },
-            },
-            {
-#line 6423
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6425
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6424
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6426
-                MOVE_TAKE_DOWN,
-                MOVE_ROCK_BLAST,
-                MOVE_SCARY_FACE,
-                MOVE_EARTHQUAKE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_GIOVANNI,
     },
 #line 6431
     [TRAINER_TEAM_ROCKET_GRUNT] =
@@ -15911,31 +6526,7 @@
 #line 6438
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6440
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6442
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6441
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6444
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6446
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6445
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT,
     },
 #line 6448
     [TRAINER_TEAM_ROCKET_GRUNT_2] =
@@ -15954,42 +6545,7 @@
 #line 6455
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6457
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6459
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6458
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6461
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6463
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6462
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6465
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6467
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6466
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_2,
     },
 #line 6469
     [TRAINER_TEAM_ROCKET_GRUNT_3] =
@@ -16008,31 +6564,7 @@
 #line 6476
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6478
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6480
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6479
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6482
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6484
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6483
-            .lvl = 11,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_3,
     },
 #line 6486
     [TRAINER_TEAM_ROCKET_GRUNT_4] =
@@ -16051,31 +6583,7 @@
 #line 6493
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6495
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6497
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6496
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6499
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6501
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6500
-            .lvl = 13,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_4,
     },
 #line 6503
     [TRAINER_TEAM_ROCKET_GRUNT_5] =
@@ -16094,31 +6602,7 @@
 #line 6510
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6512
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6514
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6513
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6516
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6518
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6517
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_5,
     },
 #line 6520
     [TRAINER_TEAM_ROCKET_GRUNT_6] =
@@ -16137,31 +6621,7 @@
 #line 6527
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6529
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6531
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6530
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6533
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6535
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6534
-            .lvl = 15,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_6,
     },
 #line 6537
     [TRAINER_TEAM_ROCKET_GRUNT_7] =
@@ -16180,31 +6640,7 @@
 #line 6544
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6546
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6548
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6547
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6550
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6552
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6551
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_7,
     },
 #line 6554
     [TRAINER_TEAM_ROCKET_GRUNT_8] =
@@ -16223,31 +6659,7 @@
 #line 6561
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6563
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6565
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6564
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6567
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6569
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6568
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_8,
     },
 #line 6571
     [TRAINER_TEAM_ROCKET_GRUNT_9] =
@@ -16266,31 +6678,7 @@
 #line 6578
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6580
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6582
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6581
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6584
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6586
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6585
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_9,
     },
 #line 6588
     [TRAINER_TEAM_ROCKET_GRUNT_10] =
@@ -16309,61 +6697,7 @@
 #line 6595
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6597
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6599
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6598
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6600
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-                MOVE_HARDEN,
-            },
-            },
-            {
-#line 6605
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6607
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6606
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6608
-                MOVE_SMOG,
-                MOVE_TACKLE,
-                MOVE_POISON_GAS,
-            },
-            },
-            {
-#line 6612
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6614
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6613
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6615
-                MOVE_SMOG,
-                MOVE_TACKLE,
-                MOVE_POISON_GAS,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_10,
     },
 #line 6619
     [TRAINER_TEAM_ROCKET_GRUNT_11] =
@@ -16382,53 +6716,7 @@
 #line 6626
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6628
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6630
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6629
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6632
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6634
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6633
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6636
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6638
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6637
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6640
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6642
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6641
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_11,
     },
 #line 6644
     [TRAINER_TEAM_ROCKET_GRUNT_12] =
@@ -16447,45 +6735,7 @@
 #line 6651
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6653
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6655
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6654
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6656
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-                MOVE_HARDEN,
-            },
-            },
-            {
-#line 6661
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6663
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6662
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6664
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-                MOVE_POISON_GAS,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_12,
     },
 #line 6669
     [TRAINER_TEAM_ROCKET_GRUNT_13] =
@@ -16504,98 +6754,7 @@
 #line 6676
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6678
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6680
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6679
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6681
-                MOVE_BITE,
-                MOVE_ASTONISH,
-                MOVE_SUPERSONIC,
-                MOVE_LEECH_LIFE,
-            },
-            },
-            {
-#line 6686
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6688
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6687
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6689
-                MOVE_SMOG,
-                MOVE_TACKLE,
-                MOVE_POISON_GAS,
-            },
-            },
-            {
-#line 6693
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6695
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6694
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6696
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-                MOVE_HARDEN,
-                MOVE_POUND,
-            },
-            },
-            {
-#line 6701
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6703
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6702
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6704
-                MOVE_BITE,
-                MOVE_ASTONISH,
-                MOVE_SUPERSONIC,
-                MOVE_LEECH_LIFE,
-            },
-            },
-            {
-#line 6709
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6711
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6710
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 6712
-                MOVE_HYPER_FANG,
-                MOVE_QUICK_ATTACK,
-                MOVE_TAIL_WHIP,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_13,
     },
 #line 6717
     [TRAINER_TEAM_ROCKET_GRUNT_14] =
@@ -16614,42 +6773,7 @@
 #line 6724
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6726
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6728
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6727
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6730
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6732
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6731
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6734
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6736
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6735
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_14,
     },
 #line 6738
     [TRAINER_TEAM_ROCKET_GRUNT_15] =
@@ -16668,31 +6792,7 @@
 #line 6745
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6747
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6749
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6748
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6751
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6753
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6752
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_15,
     },
 #line 6755
     [TRAINER_TEAM_ROCKET_GRUNT_16] =
@@ -16711,42 +6811,7 @@
 #line 6762
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6764
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6766
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6765
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6768
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6770
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6769
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6772
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6774
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6773
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_16,
     },
 #line 6776
     [TRAINER_TEAM_ROCKET_GRUNT_17] =
@@ -16765,42 +6830,7 @@
 #line 6783
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6785
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6787
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6786
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6789
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6791
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6790
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6793
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6795
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6794
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_17,
     },
 #line 6797
     [TRAINER_TEAM_ROCKET_GRUNT_18] =
@@ -16819,31 +6849,7 @@
 #line 6804
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6806
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6808
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6807
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6810
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6812
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6811
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_18,
     },
 #line 6814
     [TRAINER_TEAM_ROCKET_GRUNT_19] =
@@ -16862,42 +6868,7 @@
 #line 6821
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6823
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6825
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6824
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6827
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6829
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6828
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6831
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6833
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6832
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_19,
     },
 #line 6835
     [TRAINER_TEAM_ROCKET_GRUNT_20] =
@@ -16916,31 +6887,7 @@
 #line 6842
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6844
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6846
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6845
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6848
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6850
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6849
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_20,
     },
 #line 6852
     [TRAINER_TEAM_ROCKET_GRUNT_21] =
@@ -16959,53 +6906,7 @@
 #line 6859
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6861
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6863
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6862
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6865
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6867
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6866
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6869
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6871
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6870
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6873
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6875
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6874
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_21,
     },
 #line 6877
     [TRAINER_TEAM_ROCKET_GRUNT_22] =
@@ -17024,31 +6925,7 @@
 #line 6884
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6886
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6888
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6887
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6890
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6892
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6891
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_22,
     },
 #line 6894
     [TRAINER_TEAM_ROCKET_GRUNT_23] =
@@ -17067,31 +6944,7 @@
 #line 6901
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6903
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6905
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6904
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6907
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6909
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6908
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_23,
     },
 #line 6911
     [TRAINER_TEAM_ROCKET_GRUNT_24] =
@@ -17110,64 +6963,7 @@
 #line 6918
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6920
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6922
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6921
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6924
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6926
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6925
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6928
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6930
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6929
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6932
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6934
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6933
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6936
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6938
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6937
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_24,
     },
 #line 6940
     [TRAINER_TEAM_ROCKET_GRUNT_25] =
@@ -17186,42 +6982,7 @@
 #line 6947
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6949
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6951
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6950
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6953
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6955
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6954
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6957
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6959
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6958
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_25,
     },
 #line 6961
     [TRAINER_TEAM_ROCKET_GRUNT_26] =
@@ -17240,31 +7001,7 @@
 #line 6968
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6970
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6972
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6971
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6974
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6976
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6975
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_26,
     },
 #line 6978
     [TRAINER_TEAM_ROCKET_GRUNT_27] =
@@ -17283,42 +7020,7 @@
 #line 6985
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 6987
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6989
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6988
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6991
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6993
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6992
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 6995
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 6997
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 6996
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_27,
     },
 #line 6999
     [TRAINER_TEAM_ROCKET_GRUNT_28] =
@@ -17337,20 +7039,7 @@
 #line 7006
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7008
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7010
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7009
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_28,
     },
 #line 7012
     [TRAINER_TEAM_ROCKET_GRUNT_29] =
@@ -17369,20 +7058,7 @@
 #line 7019
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7021
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7023
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7022
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_29,
     },
 #line 7025
     [TRAINER_TEAM_ROCKET_GRUNT_30] =
@@ -17401,31 +7077,7 @@
 #line 7032
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7034
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7036
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7035
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7038
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7040
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7039
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_30,
     },
 #line 7042
     [TRAINER_TEAM_ROCKET_GRUNT_31] =
@@ -17444,42 +7096,7 @@
 #line 7049
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7051
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7053
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7052
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7055
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7057
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7056
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7059
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7061
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7060
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_31,
     },
 #line 7063
     [TRAINER_TEAM_ROCKET_GRUNT_32] =
@@ -17498,81 +7115,7 @@
 #line 7070
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7072
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7074
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7073
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7075
-                MOVE_SCARY_FACE,
-                MOVE_HYPER_FANG,
-                MOVE_QUICK_ATTACK,
-                MOVE_TAIL_WHIP,
-            },
-            },
-            {
-#line 7080
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7082
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7081
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7083
-                MOVE_GLARE,
-                MOVE_BITE,
-                MOVE_POISON_STING,
-                MOVE_LEER,
-            },
-            },
-            {
-#line 7088
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7090
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7089
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7091
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 7096
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7098
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7097
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7099
-                MOVE_WING_ATTACK,
-                MOVE_BITE,
-                MOVE_ASTONISH,
-                MOVE_SUPERSONIC,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_32,
     },
 #line 7104
     [TRAINER_TEAM_ROCKET_GRUNT_33] =
@@ -17591,31 +7134,7 @@
 #line 7111
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7113
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7115
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7114
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7117
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7119
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7118
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_33,
     },
 #line 7121
     [TRAINER_TEAM_ROCKET_GRUNT_34] =
@@ -17634,31 +7153,7 @@
 #line 7128
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7130
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7132
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7131
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7134
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7136
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7135
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_34,
     },
 #line 7138
     [TRAINER_TEAM_ROCKET_GRUNT_35] =
@@ -17677,53 +7172,7 @@
 #line 7145
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7147
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7149
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7148
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7151
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7153
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7152
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7155
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7157
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7156
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7159
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7161
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7160
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_35,
     },
 #line 7163
     [TRAINER_TEAM_ROCKET_GRUNT_36] =
@@ -17742,42 +7191,7 @@
 #line 7170
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7172
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7174
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7173
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7176
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7178
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7177
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7180
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7182
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7181
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_36,
     },
 #line 7184
     [TRAINER_TEAM_ROCKET_GRUNT_37] =
@@ -17796,42 +7210,7 @@
 #line 7191
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7193
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7195
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7194
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7197
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7199
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7198
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7201
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7203
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7202
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_37,
     },
 #line 7205
     [TRAINER_TEAM_ROCKET_GRUNT_38] =
@@ -17850,42 +7229,7 @@
 #line 7212
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7214
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7216
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7215
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7218
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7220
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7219
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7222
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7224
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7223
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_38,
     },
 #line 7226
     [TRAINER_TEAM_ROCKET_GRUNT_39] =
@@ -17904,20 +7248,7 @@
 #line 7233
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7235
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7237
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7236
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_39,
     },
 #line 7239
     [TRAINER_TEAM_ROCKET_GRUNT_40] =
@@ -17936,64 +7267,7 @@
 #line 7246
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7248
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7250
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7249
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7252
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7254
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7253
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7256
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7258
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7257
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7260
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7262
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7261
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7264
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7266
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7265
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_40,
     },
 #line 7268
     [TRAINER_TEAM_ROCKET_GRUNT_41] =
@@ -18012,42 +7286,7 @@
 #line 7275
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7277
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7279
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7278
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7281
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7283
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7282
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 7285
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7287
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 7286
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_41,
     },
 #line 7289
     [TRAINER_COOLTRAINER_SAMUEL] =
@@ -18068,99 +7307,7 @@
 #line 7297
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7299
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7301
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7300
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7302
-                MOVE_SLASH,
-                MOVE_SWIFT,
-                MOVE_SAND_ATTACK,
-                MOVE_POISON_STING,
-            },
-            },
-            {
-#line 7307
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7309
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7308
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7310
-                MOVE_SLASH,
-                MOVE_SWIFT,
-                MOVE_SAND_ATTACK,
-                MOVE_POISON_STING,
-            },
-            },
-            {
-#line 7315
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7317
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7316
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7318
-                MOVE_TAKE_DOWN,
-                MOVE_ROCK_BLAST,
-                MOVE_FURY_ATTACK,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 7323
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7325
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7324
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7326
-                MOVE_FURY_ATTACK,
-                MOVE_HORN_ATTACK,
-                MOVE_POISON_STING,
-                MOVE_DOUBLE_KICK,
-            },
-            },
-            {
-#line 7331
-            .species = SPECIES_NIDOKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7333
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7332
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7334
-                MOVE_THRASH,
-                MOVE_DOUBLE_KICK,
-                MOVE_POISON_STING,
-                MOVE_FOCUS_ENERGY,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_SAMUEL,
     },
 #line 7339
     [TRAINER_COOLTRAINER_GEORGE] =
@@ -18181,99 +7328,7 @@
 #line 7347
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7349
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7351
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7350
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7352
-                MOVE_EGG_BOMB,
-                MOVE_CONFUSION,
-                MOVE_STUN_SPORE,
-                MOVE_SLEEP_POWDER,
-            },
-            },
-            {
-#line 7357
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7359
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7358
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7360
-                MOVE_FURY_SWIPES,
-                MOVE_SWIFT,
-                MOVE_POISON_STING,
-                MOVE_SAND_ATTACK,
-            },
-            },
-            {
-#line 7365
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7367
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7366
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7368
-                MOVE_SPIKE_CANNON,
-                MOVE_SPIKES,
-                MOVE_AURORA_BEAM,
-                MOVE_SUPERSONIC,
-            },
-            },
-            {
-#line 7373
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7375
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7374
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7376
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_LIGHT_SCREEN,
-            },
-            },
-            {
-#line 7381
-            .species = SPECIES_ARCANINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7383
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7382
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7384
-                MOVE_FLAME_WHEEL,
-                MOVE_ROAR,
-                MOVE_BITE,
-                MOVE_TAKE_DOWN,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_GEORGE,
     },
 #line 7389
     [TRAINER_COOLTRAINER_COLBY] =
@@ -18294,99 +7349,7 @@
 #line 7397
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7399
-            .species = SPECIES_KINGLER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7401
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7400
-            .lvl = 41,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7402
-                MOVE_GUILLOTINE,
-                MOVE_STOMP,
-                MOVE_MUD_SHOT,
-                MOVE_BUBBLE,
-            },
-            },
-            {
-#line 7407
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7409
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7408
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7410
-                MOVE_BODY_SLAM,
-                MOVE_DOUBLE_SLAP,
-                MOVE_WATER_GUN,
-                MOVE_HYPNOSIS,
-            },
-            },
-            {
-#line 7415
-            .species = SPECIES_TENTACRUEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7417
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7416
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7418
-                MOVE_BARRIER,
-                MOVE_WRAP,
-                MOVE_BUBBLE_BEAM,
-                MOVE_ACID,
-            },
-            },
-            {
-#line 7423
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7425
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7424
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7426
-                MOVE_WATER_GUN,
-                MOVE_SMOKESCREEN,
-                MOVE_TWISTER,
-                MOVE_LEER,
-            },
-            },
-            {
-#line 7431
-            .species = SPECIES_BLASTOISE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7433
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7432
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7434
-                MOVE_WATER_GUN,
-                MOVE_BITE,
-                MOVE_RAPID_SPIN,
-                MOVE_RAIN_DANCE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_COLBY,
     },
 #line 7439
     [TRAINER_COOLTRAINER_PAUL] =
@@ -18407,99 +7370,7 @@
 #line 7447
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7449
-            .species = SPECIES_SLOWPOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7451
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7450
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7452
-                MOVE_HEADBUTT,
-                MOVE_CONFUSION,
-                MOVE_WATER_GUN,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 7457
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7459
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7458
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7460
-                MOVE_AURORA_BEAM,
-                MOVE_CLAMP,
-                MOVE_SUPERSONIC,
-                MOVE_LEER,
-            },
-            },
-            {
-#line 7465
-            .species = SPECIES_KINGLER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7467
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7466
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7468
-                MOVE_GUILLOTINE,
-                MOVE_STOMP,
-                MOVE_MUD_SHOT,
-                MOVE_BUBBLE,
-            },
-            },
-            {
-#line 7473
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7475
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7474
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7476
-                MOVE_BUBBLE_BEAM,
-                MOVE_SWIFT,
-                MOVE_RECOVER,
-                MOVE_RAPID_SPIN,
-            },
-            },
-            {
-#line 7481
-            .species = SPECIES_GOLDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7483
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7482
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7484
-                MOVE_CONFUSION,
-                MOVE_SCRATCH,
-                MOVE_SCREECH,
-                MOVE_DISABLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_PAUL,
     },
 #line 7489
     [TRAINER_COOLTRAINER_ROLANDO] =
@@ -18520,99 +7391,7 @@
 #line 7497
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7499
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7501
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7500
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7502
-                MOVE_SUPER_FANG,
-                MOVE_PURSUIT,
-                MOVE_SCARY_FACE,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 7507
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7509
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7508
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7510
-                MOVE_RAZOR_LEAF,
-                MOVE_SLEEP_POWDER,
-                MOVE_SWEET_SCENT,
-                MOVE_SYNTHESIS,
-            },
-            },
-            {
-#line 7515
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7517
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7516
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7518
-                MOVE_WATER_GUN,
-                MOVE_BITE,
-                MOVE_RAPID_SPIN,
-                MOVE_TAIL_WHIP,
-            },
-            },
-            {
-#line 7523
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7525
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7524
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7526
-                MOVE_FLAMETHROWER,
-                MOVE_SLASH,
-                MOVE_SMOKESCREEN,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 7531
-            .species = SPECIES_CHARIZARD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7533
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7532
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7534
-                MOVE_FLAMETHROWER,
-                MOVE_WING_ATTACK,
-                MOVE_SMOKESCREEN,
-                MOVE_SCARY_FACE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_ROLANDO,
     },
 #line 7539
     [TRAINER_COOLTRAINER_GILBERT] =
@@ -18633,99 +7412,7 @@
 #line 7547
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7549
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7551
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7550
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7552
-                MOVE_WING_ATTACK,
-                MOVE_FEATHER_DANCE,
-                MOVE_WHIRLWIND,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 7557
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7559
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7558
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7560
-                MOVE_DRILL_PECK,
-                MOVE_MIRROR_MOVE,
-                MOVE_PURSUIT,
-                MOVE_LEER,
-            },
-            },
-            {
-#line 7565
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7567
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7566
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7568
-                MOVE_PAY_DAY,
-                MOVE_FAINT_ATTACK,
-                MOVE_SCREECH,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 7573
-            .species = SPECIES_LICKITUNG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7575
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7574
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7576
-                MOVE_SLAM,
-                MOVE_DISABLE,
-                MOVE_WRAP,
-                MOVE_SUPERSONIC,
-            },
-            },
-            {
-#line 7581
-            .species = SPECIES_TAUROS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7583
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7582
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7584
-                MOVE_HORN_ATTACK,
-                MOVE_SCARY_FACE,
-                MOVE_SWAGGER,
-                MOVE_TAIL_WHIP,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_GILBERT,
     },
 #line 7589
     [TRAINER_COOLTRAINER_OWEN] =
@@ -18746,99 +7433,7 @@
 #line 7597
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7599
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7601
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7600
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7602
-                MOVE_SCRATCH,
-                MOVE_POISON_STING,
-                MOVE_DOUBLE_KICK,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 7607
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7609
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7608
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7610
-                MOVE_HORN_ATTACK,
-                MOVE_POISON_STING,
-                MOVE_DOUBLE_KICK,
-                MOVE_LEER,
-            },
-            },
-            {
-#line 7615
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7617
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7616
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7618
-                MOVE_SUPER_FANG,
-                MOVE_PURSUIT,
-                MOVE_SCARY_FACE,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 7623
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7625
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7624
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7626
-                MOVE_FURY_SWIPES,
-                MOVE_SWIFT,
-                MOVE_SLASH,
-                MOVE_POISON_STING,
-            },
-            },
-            {
-#line 7631
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7633
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7632
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7634
-                MOVE_ROCK_BLAST,
-                MOVE_SCARY_FACE,
-                MOVE_STOMP,
-                MOVE_TAIL_WHIP,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_OWEN,
     },
 #line 7639
     [TRAINER_COOLTRAINER_BERKE] =
@@ -18859,99 +7454,7 @@
 #line 7647
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7649
-            .species = SPECIES_SEEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7651
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7650
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7652
-                MOVE_TAKE_DOWN,
-                MOVE_AURORA_BEAM,
-                MOVE_ICY_WIND,
-                MOVE_GROWL,
-            },
-            },
-            {
-#line 7657
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7659
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7658
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7660
-                MOVE_ROCK_BLAST,
-                MOVE_MAGNITUDE,
-                MOVE_ROCK_THROW,
-                MOVE_MUD_SPORT,
-            },
-            },
-            {
-#line 7665
-            .species = SPECIES_KINGLER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7667
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7666
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7668
-                MOVE_GUILLOTINE,
-                MOVE_STOMP,
-                MOVE_MUD_SHOT,
-                MOVE_BUBBLE,
-            },
-            },
-            {
-#line 7673
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7675
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7674
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7676
-                MOVE_SLAM,
-                MOVE_SANDSTORM,
-                MOVE_DRAGON_BREATH,
-                MOVE_ROCK_THROW,
-            },
-            },
-            {
-#line 7681
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7683
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7682
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7684
-                MOVE_SPIKE_CANNON,
-                MOVE_AURORA_BEAM,
-                MOVE_SUPERSONIC,
-                MOVE_PROTECT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_BERKE,
     },
 #line 7689
     [TRAINER_COOLTRAINER_YUJI] =
@@ -18972,99 +7475,7 @@
 #line 7697
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7699
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7701
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7700
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7702
-                MOVE_SLASH,
-                MOVE_SWIFT,
-                MOVE_SAND_ATTACK,
-                MOVE_POISON_STING,
-            },
-            },
-            {
-#line 7707
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7709
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7708
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7710
-                MOVE_ROCK_BLAST,
-                MOVE_MAGNITUDE,
-                MOVE_MUD_SPORT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 7715
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7717
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7716
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7718
-                MOVE_DRAGON_BREATH,
-                MOVE_SANDSTORM,
-                MOVE_ROCK_THROW,
-                MOVE_BIND,
-            },
-            },
-            {
-#line 7723
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7725
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7724
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7726
-                MOVE_ROCK_BLAST,
-                MOVE_MAGNITUDE,
-                MOVE_ROLLOUT,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 7731
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7733
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7732
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7734
-                MOVE_BONEMERANG,
-                MOVE_HEADBUTT,
-                MOVE_LEER,
-                MOVE_GROWL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_YUJI,
     },
 #line 7739
     [TRAINER_COOLTRAINER_WARREN] =
@@ -19085,99 +7496,7 @@
 #line 7747
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7749
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7751
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7750
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7752
-                MOVE_BONEMERANG,
-                MOVE_HEADBUTT,
-                MOVE_LEER,
-                MOVE_GROWL,
-            },
-            },
-            {
-#line 7757
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7759
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7758
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7760
-                MOVE_BONEMERANG,
-                MOVE_HEADBUTT,
-                MOVE_LEER,
-                MOVE_GROWL,
-            },
-            },
-            {
-#line 7765
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7767
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7766
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7768
-                MOVE_TAKE_DOWN,
-                MOVE_ROCK_BLAST,
-                MOVE_FURY_ATTACK,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 7773
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7775
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7774
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7776
-                MOVE_FURY_SWIPES,
-                MOVE_BITE,
-                MOVE_POISON_STING,
-                MOVE_DOUBLE_KICK,
-            },
-            },
-            {
-#line 7781
-            .species = SPECIES_NIDOQUEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7783
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7782
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7784
-                MOVE_BODY_SLAM,
-                MOVE_BITE,
-                MOVE_POISON_STING,
-                MOVE_DOUBLE_KICK,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_WARREN,
     },
 #line 7789
     [TRAINER_COOLTRAINER_MARY] =
@@ -19198,99 +7517,7 @@
 #line 7797
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7799
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7801
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7800
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7802
-                MOVE_WRAP,
-                MOVE_STUN_SPORE,
-                MOVE_POISON_POWDER,
-                MOVE_GROWTH,
-            },
-            },
-            {
-#line 7807
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7809
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7808
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7810
-                MOVE_POISON_POWDER,
-                MOVE_STUN_SPORE,
-                MOVE_ABSORB,
-                MOVE_SWEET_SCENT,
-            },
-            },
-            {
-#line 7815
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7817
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7816
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7818
-                MOVE_VINE_WHIP,
-                MOVE_STUN_SPORE,
-                MOVE_POISON_POWDER,
-                MOVE_GROWTH,
-            },
-            },
-            {
-#line 7823
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7825
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7824
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7826
-                MOVE_ABSORB,
-                MOVE_STUN_SPORE,
-                MOVE_POISON_POWDER,
-                MOVE_SWEET_SCENT,
-            },
-            },
-            {
-#line 7831
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7833
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7832
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7834
-                MOVE_RAZOR_LEAF,
-                MOVE_SLEEP_POWDER,
-                MOVE_VINE_WHIP,
-                MOVE_LEECH_SEED,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_MARY,
     },
 #line 7839
     [TRAINER_COOLTRAINER_CAROLINE] =
@@ -19311,99 +7538,7 @@
 #line 7847
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7849
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7851
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7850
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7852
-                MOVE_RAZOR_LEAF,
-                MOVE_ACID,
-                MOVE_STUN_SPORE,
-                MOVE_POISON_POWDER,
-            },
-            },
-            {
-#line 7857
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7859
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7858
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7860
-                MOVE_RAZOR_LEAF,
-                MOVE_ACID,
-                MOVE_SLEEP_POWDER,
-                MOVE_POISON_POWDER,
-            },
-            },
-            {
-#line 7865
-            .species = SPECIES_VICTREEBEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7867
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7866
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7868
-                MOVE_RAZOR_LEAF,
-                MOVE_ACID,
-                MOVE_STUN_SPORE,
-                MOVE_SLEEP_POWDER,
-            },
-            },
-            {
-#line 7873
-            .species = SPECIES_PARAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7875
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7874
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7876
-                MOVE_GROWTH,
-                MOVE_SLASH,
-                MOVE_LEECH_LIFE,
-                MOVE_STUN_SPORE,
-            },
-            },
-            {
-#line 7881
-            .species = SPECIES_PARASECT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7883
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7882
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7884
-                MOVE_SPORE,
-                MOVE_SLASH,
-                MOVE_LEECH_LIFE,
-                MOVE_POISON_POWDER,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_CAROLINE,
     },
 #line 7889
     [TRAINER_COOLTRAINER_ALEXA] =
@@ -19424,99 +7559,7 @@
 #line 7897
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7899
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7901
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7900
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7902
-                MOVE_LIGHT_SCREEN,
-                MOVE_COSMIC_POWER,
-                MOVE_DOUBLE_SLAP,
-                MOVE_ENCORE,
-            },
-            },
-            {
-#line 7907
-            .species = SPECIES_JIGGLYPUFF,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7909
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7908
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7910
-                MOVE_SING,
-                MOVE_BODY_SLAM,
-                MOVE_ROLLOUT,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 7915
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7917
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7916
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7918
-                MOVE_PAY_DAY,
-                MOVE_FAINT_ATTACK,
-                MOVE_BITE,
-                MOVE_SCREECH,
-            },
-            },
-            {
-#line 7923
-            .species = SPECIES_DEWGONG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7925
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7924
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7926
-                MOVE_SHEER_COLD,
-                MOVE_TAKE_DOWN,
-                MOVE_REST,
-                MOVE_AURORA_BEAM,
-            },
-            },
-            {
-#line 7931
-            .species = SPECIES_CHANSEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7933
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7932
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7934
-                MOVE_SING,
-                MOVE_EGG_BOMB,
-                MOVE_SOFT_BOILED,
-                MOVE_MINIMIZE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_ALEXA,
     },
 #line 7939
     [TRAINER_COOLTRAINER_SHANNON] =
@@ -19537,99 +7580,7 @@
 #line 7947
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7949
-            .species = SPECIES_BEEDRILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7951
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7950
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7952
-                MOVE_PIN_MISSILE,
-                MOVE_TWINEEDLE,
-                MOVE_AGILITY,
-                MOVE_PURSUIT,
-            },
-            },
-            {
-#line 7957
-            .species = SPECIES_BUTTERFREE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7959
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7958
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7960
-                MOVE_SAFEGUARD,
-                MOVE_PSYBEAM,
-                MOVE_GUST,
-                MOVE_SUPERSONIC,
-            },
-            },
-            {
-#line 7965
-            .species = SPECIES_PARASECT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7967
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7966
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7968
-                MOVE_SPORE,
-                MOVE_LEECH_LIFE,
-                MOVE_SLASH,
-                MOVE_GROWTH,
-            },
-            },
-            {
-#line 7973
-            .species = SPECIES_VENONAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7975
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7974
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7976
-                MOVE_PSYBEAM,
-                MOVE_STUN_SPORE,
-                MOVE_LEECH_LIFE,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 7981
-            .species = SPECIES_VENOMOTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 7983
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 7982
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 7984
-                MOVE_PSYBEAM,
-                MOVE_GUST,
-                MOVE_SUPERSONIC,
-                MOVE_LEECH_LIFE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_SHANNON,
     },
 #line 7989
     [TRAINER_COOLTRAINER_NAOMI] =
@@ -19650,99 +7601,7 @@
 #line 7997
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 7999
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8001
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8000
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8002
-                MOVE_FURY_SWIPES,
-                MOVE_SCREECH,
-                MOVE_FAINT_ATTACK,
-                MOVE_PAY_DAY,
-            },
-            },
-            {
-#line 8007
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8009
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8008
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8010
-                MOVE_AGILITY,
-                MOVE_TAKE_DOWN,
-                MOVE_FIRE_SPIN,
-                MOVE_STOMP,
-            },
-            },
-            {
-#line 8015
-            .species = SPECIES_RAPIDASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8017
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8016
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8018
-                MOVE_FURY_ATTACK,
-                MOVE_FIRE_SPIN,
-                MOVE_STOMP,
-                MOVE_GROWL,
-            },
-            },
-            {
-#line 8023
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8025
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8024
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8026
-                MOVE_FLAMETHROWER,
-                MOVE_CONFUSE_RAY,
-                MOVE_QUICK_ATTACK,
-                MOVE_IMPRISON,
-            },
-            },
-            {
-#line 8031
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8033
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8032
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8034
-                MOVE_SAFEGUARD,
-                MOVE_WILL_O_WISP,
-                MOVE_CONFUSE_RAY,
-                MOVE_FIRE_SPIN,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_NAOMI,
     },
 #line 8039
     [TRAINER_COOLTRAINER_BROOKE] =
@@ -19763,99 +7622,7 @@
 #line 8047
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8049
-            .species = SPECIES_TANGELA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8051
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8050
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8052
-                MOVE_SLAM,
-                MOVE_BIND,
-                MOVE_MEGA_DRAIN,
-                MOVE_INGRAIN,
-            },
-            },
-            {
-#line 8057
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8059
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8058
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8060
-                MOVE_ACID,
-                MOVE_MOONLIGHT,
-                MOVE_SLEEP_POWDER,
-                MOVE_STUN_SPORE,
-            },
-            },
-            {
-#line 8065
-            .species = SPECIES_VILEPLUME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8067
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8066
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8068
-                MOVE_MEGA_DRAIN,
-                MOVE_ACID,
-                MOVE_STUN_SPORE,
-                MOVE_AROMATHERAPY,
-            },
-            },
-            {
-#line 8073
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8075
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8074
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8076
-                MOVE_RAZOR_LEAF,
-                MOVE_SWEET_SCENT,
-                MOVE_GROWL,
-                MOVE_LEECH_SEED,
-            },
-            },
-            {
-#line 8081
-            .species = SPECIES_VENUSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8083
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8082
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8084
-                MOVE_RAZOR_LEAF,
-                MOVE_GROWTH,
-                MOVE_SLEEP_POWDER,
-                MOVE_POISON_POWDER,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_BROOKE,
     },
 #line 8089
     [TRAINER_COOLTRAINER_AUSTINA] =
@@ -19876,99 +7643,7 @@
 #line 8097
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8099
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8101
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8100
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8102
-                MOVE_HORN_DRILL,
-                MOVE_ROCK_BLAST,
-                MOVE_SCARY_FACE,
-                MOVE_STOMP,
-            },
-            },
-            {
-#line 8107
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8109
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8108
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8110
-                MOVE_DOUBLE_KICK,
-                MOVE_FURY_SWIPES,
-                MOVE_BITE,
-                MOVE_FLATTER,
-            },
-            },
-            {
-#line 8115
-            .species = SPECIES_NIDOQUEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8117
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8116
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8118
-                MOVE_BODY_SLAM,
-                MOVE_DOUBLE_KICK,
-                MOVE_BITE,
-                MOVE_GROWL,
-            },
-            },
-            {
-#line 8123
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8125
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8124
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8126
-                MOVE_HORN_ATTACK,
-                MOVE_POISON_STING,
-                MOVE_FOCUS_ENERGY,
-                MOVE_LEER,
-            },
-            },
-            {
-#line 8131
-            .species = SPECIES_NIDOKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8133
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8132
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8134
-                MOVE_THRASH,
-                MOVE_DOUBLE_KICK,
-                MOVE_POISON_STING,
-                MOVE_PECK,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_AUSTINA,
     },
 #line 8139
     [TRAINER_COOLTRAINER_JULIE] =
@@ -19989,99 +7664,7 @@
 #line 8147
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8149
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8151
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8150
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8152
-                MOVE_FURY_SWIPES,
-                MOVE_BITE,
-                MOVE_SCREECH,
-                MOVE_FAINT_ATTACK,
-            },
-            },
-            {
-#line 8157
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8159
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8158
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8160
-                MOVE_FLAMETHROWER,
-                MOVE_WILL_O_WISP,
-                MOVE_CONFUSE_RAY,
-                MOVE_GRUDGE,
-            },
-            },
-            {
-#line 8165
-            .species = SPECIES_RAPIDASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8167
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8166
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8168
-                MOVE_FURY_ATTACK,
-                MOVE_FIRE_SPIN,
-                MOVE_TAKE_DOWN,
-                MOVE_AGILITY,
-            },
-            },
-            {
-#line 8173
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8175
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8174
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8176
-                MOVE_THUNDERBOLT,
-                MOVE_THUNDER_WAVE,
-                MOVE_DOUBLE_TEAM,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 8181
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8183
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8182
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8184
-                MOVE_THUNDER,
-                MOVE_THUNDER_WAVE,
-                MOVE_SLAM,
-                MOVE_DOUBLE_TEAM,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_JULIE,
     },
 #line 8189
     [TRAINER_ELITE_FOUR_LORELEI] =
@@ -20105,101 +7688,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_PURPLE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8200
-            .species = SPECIES_DEWGONG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8202
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8201
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8203
-                MOVE_ICE_BEAM,
-                MOVE_SURF,
-                MOVE_HAIL,
-                MOVE_SAFEGUARD,
-            },
-            },
-            {
-#line 8208
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8210
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8209
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8211
-                MOVE_SPIKES,
-                MOVE_PROTECT,
-                MOVE_HAIL,
-                MOVE_DIVE,
-            },
-            },
-            {
-#line 8216
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8218
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8217
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8219
-                MOVE_ICE_BEAM,
-                MOVE_SURF,
-                MOVE_AMNESIA,
-                MOVE_YAWN,
-            },
-            },
-            {
-#line 8224
-            .species = SPECIES_JYNX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8226
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8225
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8227
-                MOVE_ICE_PUNCH,
-                MOVE_DOUBLE_SLAP,
-                MOVE_LOVELY_KISS,
-                MOVE_ATTRACT,
-            },
-            },
-            {
-#line 8232
-            .species = SPECIES_LAPRAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8232
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 8234
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8233
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8235
-                MOVE_CONFUSE_RAY,
-                MOVE_ICE_BEAM,
-                MOVE_SURF,
-                MOVE_BODY_SLAM,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_LORELEI,
     },
 #line 8240
     [TRAINER_ELITE_FOUR_BRUNO] =
@@ -20223,101 +7712,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_GREEN,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8251
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8253
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8252
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8254
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_TOMB,
-                MOVE_IRON_TAIL,
-                MOVE_ROAR,
-            },
-            },
-            {
-#line 8259
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8261
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8260
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8262
-                MOVE_SKY_UPPERCUT,
-                MOVE_MACH_PUNCH,
-                MOVE_ROCK_TOMB,
-                MOVE_COUNTER,
-            },
-            },
-            {
-#line 8267
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8269
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8268
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8270
-                MOVE_MEGA_KICK,
-                MOVE_FORESIGHT,
-                MOVE_BRICK_BREAK,
-                MOVE_FACADE,
-            },
-            },
-            {
-#line 8275
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8277
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8276
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8278
-                MOVE_DOUBLE_EDGE,
-                MOVE_EARTHQUAKE,
-                MOVE_IRON_TAIL,
-                MOVE_SAND_TOMB,
-            },
-            },
-            {
-#line 8283
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8283
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 8285
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8284
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8286
-                MOVE_CROSS_CHOP,
-                MOVE_BULK_UP,
-                MOVE_SCARY_FACE,
-                MOVE_ROCK_TOMB,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_BRUNO,
     },
 #line 8291
     [TRAINER_ELITE_FOUR_AGATHA] =
@@ -20341,101 +7736,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_PINK,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8302
-            .species = SPECIES_GENGAR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8304
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8303
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8305
-                MOVE_SHADOW_PUNCH,
-                MOVE_CONFUSE_RAY,
-                MOVE_TOXIC,
-                MOVE_DOUBLE_TEAM,
-            },
-            },
-            {
-#line 8310
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8312
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8311
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8313
-                MOVE_CONFUSE_RAY,
-                MOVE_POISON_FANG,
-                MOVE_AIR_CUTTER,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 8318
-            .species = SPECIES_HAUNTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8320
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8319
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8321
-                MOVE_HYPNOSIS,
-                MOVE_DREAM_EATER,
-                MOVE_CURSE,
-                MOVE_MEAN_LOOK,
-            },
-            },
-            {
-#line 8326
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8328
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8327
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8329
-                MOVE_SLUDGE_BOMB,
-                MOVE_SCREECH,
-                MOVE_IRON_TAIL,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 8334
-            .species = SPECIES_GENGAR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8334
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 8336
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8335
-            .lvl = 58,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8337
-                MOVE_SHADOW_BALL,
-                MOVE_SLUDGE_BOMB,
-                MOVE_HYPNOSIS,
-                MOVE_NIGHTMARE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_AGATHA,
     },
 #line 8342
     [TRAINER_ELITE_FOUR_LANCE] =
@@ -20459,101 +7760,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_BLUE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8353
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8355
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8354
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8356
-                MOVE_HYPER_BEAM,
-                MOVE_DRAGON_RAGE,
-                MOVE_TWISTER,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 8361
-            .species = SPECIES_DRAGONAIR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8363
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8362
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8364
-                MOVE_HYPER_BEAM,
-                MOVE_SAFEGUARD,
-                MOVE_DRAGON_RAGE,
-                MOVE_OUTRAGE,
-            },
-            },
-            {
-#line 8369
-            .species = SPECIES_DRAGONAIR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8371
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8370
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8372
-                MOVE_HYPER_BEAM,
-                MOVE_SAFEGUARD,
-                MOVE_THUNDER_WAVE,
-                MOVE_OUTRAGE,
-            },
-            },
-            {
-#line 8377
-            .species = SPECIES_AERODACTYL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8379
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8378
-            .lvl = 58,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8380
-                MOVE_HYPER_BEAM,
-                MOVE_ANCIENT_POWER,
-                MOVE_WING_ATTACK,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 8385
-            .species = SPECIES_DRAGONITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8385
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 8387
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 8386
-            .lvl = 60,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8388
-                MOVE_HYPER_BEAM,
-                MOVE_SAFEGUARD,
-                MOVE_OUTRAGE,
-                MOVE_WING_ATTACK,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_LANCE,
     },
 #line 8393
     [TRAINER_LEADER_BROCK] =
@@ -20572,42 +7779,7 @@
 #line 8400
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8402
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8404
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8403
-            .lvl = 12,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8405
-                MOVE_TACKLE,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 8408
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8410
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8409
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8411
-                MOVE_TACKLE,
-                MOVE_BIND,
-                MOVE_ROCK_TOMB,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_BROCK,
     },
 #line 8415
     [TRAINER_LEADER_MISTY] =
@@ -20628,45 +7800,7 @@
 #line 8423
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8425
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8427
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8426
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8428
-                MOVE_TACKLE,
-                MOVE_HARDEN,
-                MOVE_RECOVER,
-                MOVE_WATER_PULSE,
-            },
-            },
-            {
-#line 8433
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8435
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8434
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8436
-                MOVE_SWIFT,
-                MOVE_RECOVER,
-                MOVE_RAPID_SPIN,
-                MOVE_WATER_PULSE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_MISTY,
     },
 #line 8441
     [TRAINER_LEADER_LT_SURGE] =
@@ -20687,63 +7821,7 @@
 #line 8449
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8451
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8453
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8452
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8454
-                MOVE_SONIC_BOOM,
-                MOVE_TACKLE,
-                MOVE_SCREECH,
-                MOVE_SHOCK_WAVE,
-            },
-            },
-            {
-#line 8459
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8461
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8460
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8462
-                MOVE_QUICK_ATTACK,
-                MOVE_THUNDER_WAVE,
-                MOVE_DOUBLE_TEAM,
-                MOVE_SHOCK_WAVE,
-            },
-            },
-            {
-#line 8467
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8469
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8468
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8470
-                MOVE_QUICK_ATTACK,
-                MOVE_THUNDER_WAVE,
-                MOVE_DOUBLE_TEAM,
-                MOVE_SHOCK_WAVE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_LT_SURGE,
     },
 #line 8475
     [TRAINER_LEADER_ERIKA] =
@@ -20764,63 +7842,7 @@
 #line 8483
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8485
-            .species = SPECIES_VICTREEBEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8487
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8486
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8488
-                MOVE_STUN_SPORE,
-                MOVE_ACID,
-                MOVE_POISON_POWDER,
-                MOVE_GIGA_DRAIN,
-            },
-            },
-            {
-#line 8493
-            .species = SPECIES_TANGELA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8495
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8494
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8496
-                MOVE_POISON_POWDER,
-                MOVE_CONSTRICT,
-                MOVE_INGRAIN,
-                MOVE_GIGA_DRAIN,
-            },
-            },
-            {
-#line 8501
-            .species = SPECIES_VILEPLUME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8503
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8502
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8504
-                MOVE_SLEEP_POWDER,
-                MOVE_ACID,
-                MOVE_STUN_SPORE,
-                MOVE_GIGA_DRAIN,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_ERIKA,
     },
 #line 8509
     [TRAINER_LEADER_KOGA] =
@@ -20841,81 +7863,7 @@
 #line 8517
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8519
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8521
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8520
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8522
-                MOVE_SELF_DESTRUCT,
-                MOVE_SLUDGE,
-                MOVE_SMOKESCREEN,
-                MOVE_TOXIC,
-            },
-            },
-            {
-#line 8527
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8529
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8528
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8530
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_ACID_ARMOR,
-                MOVE_TOXIC,
-            },
-            },
-            {
-#line 8535
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8537
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8536
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8538
-                MOVE_SELF_DESTRUCT,
-                MOVE_SLUDGE,
-                MOVE_SMOKESCREEN,
-                MOVE_TOXIC,
-            },
-            },
-            {
-#line 8543
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8545
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8544
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8546
-                MOVE_TACKLE,
-                MOVE_SLUDGE,
-                MOVE_SMOKESCREEN,
-                MOVE_TOXIC,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_KOGA,
     },
 #line 8551
     [TRAINER_LEADER_BLAINE] =
@@ -20936,81 +7884,7 @@
 #line 8559
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8561
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8563
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8562
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8564
-                MOVE_BITE,
-                MOVE_ROAR,
-                MOVE_TAKE_DOWN,
-                MOVE_FIRE_BLAST,
-            },
-            },
-            {
-#line 8569
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8571
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8570
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8572
-                MOVE_STOMP,
-                MOVE_BOUNCE,
-                MOVE_FIRE_SPIN,
-                MOVE_FIRE_BLAST,
-            },
-            },
-            {
-#line 8577
-            .species = SPECIES_RAPIDASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8579
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8578
-            .lvl = 42,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8580
-                MOVE_STOMP,
-                MOVE_BOUNCE,
-                MOVE_FIRE_SPIN,
-                MOVE_FIRE_BLAST,
-            },
-            },
-            {
-#line 8585
-            .species = SPECIES_ARCANINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8587
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8586
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8588
-                MOVE_BITE,
-                MOVE_ROAR,
-                MOVE_TAKE_DOWN,
-                MOVE_FIRE_BLAST,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_BLAINE,
     },
 #line 8593
     [TRAINER_LEADER_SABRINA] =
@@ -21031,81 +7905,7 @@
 #line 8601
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8603
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8605
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8604
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8606
-                MOVE_PSYBEAM,
-                MOVE_REFLECT,
-                MOVE_FUTURE_SIGHT,
-                MOVE_CALM_MIND,
-            },
-            },
-            {
-#line 8611
-            .species = SPECIES_MR_MIME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8613
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8612
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8614
-                MOVE_BARRIER,
-                MOVE_PSYBEAM,
-                MOVE_BATON_PASS,
-                MOVE_CALM_MIND,
-            },
-            },
-            {
-#line 8619
-            .species = SPECIES_VENOMOTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8621
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8620
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8622
-                MOVE_PSYBEAM,
-                MOVE_GUST,
-                MOVE_LEECH_LIFE,
-                MOVE_SUPERSONIC,
-            },
-            },
-            {
-#line 8627
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8629
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8628
-            .lvl = 43,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8630
-                MOVE_PSYCHIC,
-                MOVE_RECOVER,
-                MOVE_FUTURE_SIGHT,
-                MOVE_CALM_MIND,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LEADER_SABRINA,
     },
 #line 8635
     [TRAINER_GENTLEMAN_THOMAS] =
@@ -21124,31 +7924,7 @@
 #line 8642
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8644
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8646
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8645
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8648
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8650
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8649
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_THOMAS,
     },
 #line 8652
     [TRAINER_GENTLEMAN_ARTHUR] =
@@ -21167,31 +7943,7 @@
 #line 8659
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8661
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8663
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8662
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8665
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8667
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8666
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_ARTHUR,
     },
 #line 8669
     [TRAINER_GENTLEMAN_TUCKER] =
@@ -21210,20 +7962,7 @@
 #line 8676
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8678
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8680
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8679
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_TUCKER,
     },
 #line 8682
     [TRAINER_GENTLEMAN_NORTON] =
@@ -21242,20 +7981,7 @@
 #line 8689
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8691
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8693
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8692
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_NORTON,
     },
 #line 8695
     [TRAINER_GENTLEMAN_WALTER] =
@@ -21274,31 +8000,7 @@
 #line 8702
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8704
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8706
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8705
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8708
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8710
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 8709
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_WALTER,
     },
 #line 8712
     [TRAINER_RIVAL_SS_ANNE_SQUIRTLE] =
@@ -21317,53 +8019,7 @@
 #line 8719
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8721
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8723
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8722
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8725
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8727
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8726
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8729
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8731
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8730
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8733
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8735
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8734
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_SS_ANNE_SQUIRTLE,
     },
 #line 8737
     [TRAINER_RIVAL_SS_ANNE_BULBASAUR] =
@@ -21382,53 +8038,7 @@
 #line 8744
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8746
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8748
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8747
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8750
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8752
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8751
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8754
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8756
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8755
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8758
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8760
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8759
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_SS_ANNE_BULBASAUR,
     },
 #line 8762
     [TRAINER_RIVAL_SS_ANNE_CHARMANDER] =
@@ -21447,53 +8057,7 @@
 #line 8769
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8771
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8773
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8772
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8775
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8777
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8776
-            .lvl = 16,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8779
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8781
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 8780
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8783
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8785
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8784
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_SS_ANNE_CHARMANDER,
     },
 #line 8787
     [TRAINER_RIVAL_POKEMON_TOWER_SQUIRTLE] =
@@ -21512,64 +8076,7 @@
 #line 8794
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8796
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8798
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8797
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8800
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8802
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8801
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8804
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8806
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8805
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8808
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8810
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8809
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8812
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8814
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8813
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_POKEMON_TOWER_SQUIRTLE,
     },
 #line 8816
     [TRAINER_RIVAL_POKEMON_TOWER_BULBASAUR] =
@@ -21588,64 +8095,7 @@
 #line 8823
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8825
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8827
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8826
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8829
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8831
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8830
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8833
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8835
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8834
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8837
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8839
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8838
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8841
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8843
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8842
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_POKEMON_TOWER_BULBASAUR,
     },
 #line 8845
     [TRAINER_RIVAL_POKEMON_TOWER_CHARMANDER] =
@@ -21664,64 +8114,7 @@
 #line 8852
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8854
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8856
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8855
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8858
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8860
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8859
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8862
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8864
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8863
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8866
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8868
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8867
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8870
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8872
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8871
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_POKEMON_TOWER_CHARMANDER,
     },
 #line 8874
     [TRAINER_RIVAL_SILPH_SQUIRTLE] =
@@ -21740,64 +8133,7 @@
 #line 8881
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8883
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8885
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8884
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8887
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8889
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8888
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8891
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8893
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8892
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8895
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8897
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8896
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8899
-            .species = SPECIES_BLASTOISE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8901
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 8900
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_SILPH_SQUIRTLE,
     },
 #line 8903
     [TRAINER_RIVAL_SILPH_BULBASAUR] =
@@ -21816,64 +8152,7 @@
 #line 8910
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8912
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8914
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8913
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8916
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8918
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8917
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8920
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8922
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8921
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8924
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8926
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8925
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8928
-            .species = SPECIES_VENUSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8930
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 8929
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_SILPH_BULBASAUR,
     },
 #line 8932
     [TRAINER_RIVAL_SILPH_CHARMANDER] =
@@ -21892,64 +8171,7 @@
 #line 8939
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8941
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8943
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8942
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8945
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8947
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8946
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8949
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8951
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8950
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8953
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8955
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 8954
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 8957
-            .species = SPECIES_CHARIZARD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8959
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 8958
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_SILPH_CHARMANDER,
     },
 #line 8961
     [TRAINER_RIVAL_ROUTE22_LATE_SQUIRTLE] =
@@ -21968,117 +8190,7 @@
 #line 8968
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 8970
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8972
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 8971
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8973
-                MOVE_FEATHER_DANCE,
-                MOVE_WING_ATTACK,
-                MOVE_GUST,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 8978
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8980
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 8979
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8981
-                MOVE_TAKE_DOWN,
-                MOVE_HORN_DRILL,
-                MOVE_ROCK_BLAST,
-                MOVE_FURY_ATTACK,
-            },
-            },
-            {
-#line 8986
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8988
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 8987
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8989
-                MOVE_FLAME_WHEEL,
-                MOVE_TAKE_DOWN,
-                MOVE_LEER,
-                MOVE_AGILITY,
-            },
-            },
-            {
-#line 8994
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 8996
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 8995
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 8997
-                MOVE_SOLAR_BEAM,
-                MOVE_SLEEP_POWDER,
-                MOVE_POISON_POWDER,
-                MOVE_STUN_SPORE,
-            },
-            },
-            {
-#line 9002
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9004
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9003
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9005
-                MOVE_PSYCHIC,
-                MOVE_CALM_MIND,
-                MOVE_FUTURE_SIGHT,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 9010
-            .species = SPECIES_BLASTOISE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9012
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 9011
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9013
-                MOVE_WATER_GUN,
-                MOVE_RAIN_DANCE,
-                MOVE_BITE,
-                MOVE_RAPID_SPIN,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_ROUTE22_LATE_SQUIRTLE,
     },
 #line 9018
     [TRAINER_RIVAL_ROUTE22_LATE_BULBASAUR] =
@@ -22097,117 +8209,7 @@
 #line 9025
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9027
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9029
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9028
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9030
-                MOVE_FEATHER_DANCE,
-                MOVE_WING_ATTACK,
-                MOVE_GUST,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 9035
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9037
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9036
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9038
-                MOVE_TAKE_DOWN,
-                MOVE_HORN_DRILL,
-                MOVE_ROCK_BLAST,
-                MOVE_FURY_ATTACK,
-            },
-            },
-            {
-#line 9043
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9045
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9044
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9046
-                MOVE_HYDRO_PUMP,
-                MOVE_TWISTER,
-                MOVE_LEER,
-                MOVE_RAIN_DANCE,
-            },
-            },
-            {
-#line 9051
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9053
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9052
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9054
-                MOVE_FLAME_WHEEL,
-                MOVE_TAKE_DOWN,
-                MOVE_LEER,
-                MOVE_AGILITY,
-            },
-            },
-            {
-#line 9059
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9061
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9060
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9062
-                MOVE_PSYCHIC,
-                MOVE_CALM_MIND,
-                MOVE_FUTURE_SIGHT,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 9067
-            .species = SPECIES_VENUSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9069
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 9068
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9070
-                MOVE_RAZOR_LEAF,
-                MOVE_SWEET_SCENT,
-                MOVE_GROWTH,
-                MOVE_SYNTHESIS,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_ROUTE22_LATE_BULBASAUR,
     },
 #line 9075
     [TRAINER_RIVAL_ROUTE22_LATE_CHARMANDER] =
@@ -22226,117 +8228,7 @@
 #line 9082
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9084
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9086
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9085
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9087
-                MOVE_FEATHER_DANCE,
-                MOVE_WING_ATTACK,
-                MOVE_GUST,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-            {
-#line 9092
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9094
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9093
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9095
-                MOVE_TAKE_DOWN,
-                MOVE_HORN_DRILL,
-                MOVE_ROCK_BLAST,
-                MOVE_FURY_ATTACK,
-            },
-            },
-            {
-#line 9100
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9102
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9101
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9103
-                MOVE_SOLAR_BEAM,
-                MOVE_SLEEP_POWDER,
-                MOVE_POISON_POWDER,
-                MOVE_STUN_SPORE,
-            },
-            },
-            {
-#line 9108
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9110
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9109
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9111
-                MOVE_HYDRO_PUMP,
-                MOVE_TWISTER,
-                MOVE_LEER,
-                MOVE_RAIN_DANCE,
-            },
-            },
-            {
-#line 9116
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9118
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 9117
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9119
-                MOVE_PSYCHIC,
-                MOVE_CALM_MIND,
-                MOVE_FUTURE_SIGHT,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 9124
-            .species = SPECIES_CHARIZARD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9126
-            .iv = TRAINER_PARTY_IVS(30, 30, 30, 30, 30, 30),
-#line 9125
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9127
-                MOVE_FLAMETHROWER,
-                MOVE_WING_ATTACK,
-                MOVE_SLASH,
-                MOVE_SCARY_FACE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RIVAL_ROUTE22_LATE_CHARMANDER,
     },
 #line 9132
     [TRAINER_CHAMPION_FIRST_SQUIRTLE] =
@@ -22360,119 +8252,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_YELLOW,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9143
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9145
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9144
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9146
-                MOVE_AERIAL_ACE,
-                MOVE_FEATHER_DANCE,
-                MOVE_SAND_ATTACK,
-                MOVE_WHIRLWIND,
-            },
-            },
-            {
-#line 9151
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9153
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9152
-            .lvl = 57,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9154
-                MOVE_PSYCHIC,
-                MOVE_FUTURE_SIGHT,
-                MOVE_RECOVER,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 9159
-            .species = SPECIES_RHYDON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9161
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9160
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9162
-                MOVE_TAKE_DOWN,
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_TOMB,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 9167
-            .species = SPECIES_ARCANINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9169
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9168
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9170
-                MOVE_EXTREME_SPEED,
-                MOVE_FLAMETHROWER,
-                MOVE_ROAR,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 9175
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9177
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9176
-            .lvl = 61,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9178
-                MOVE_GIGA_DRAIN,
-                MOVE_EGG_BOMB,
-                MOVE_SLEEP_POWDER,
-                MOVE_LIGHT_SCREEN,
-            },
-            },
-            {
-#line 9183
-            .species = SPECIES_BLASTOISE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9183
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 9185
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9184
-            .lvl = 63,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9186
-                MOVE_HYDRO_PUMP,
-                MOVE_RAIN_DANCE,
-                MOVE_SKULL_BASH,
-                MOVE_BITE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHAMPION_FIRST_SQUIRTLE,
     },
 #line 9191
     [TRAINER_CHAMPION_FIRST_BULBASAUR] =
@@ -22496,119 +8276,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_YELLOW,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9202
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9204
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9203
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9205
-                MOVE_AERIAL_ACE,
-                MOVE_FEATHER_DANCE,
-                MOVE_SAND_ATTACK,
-                MOVE_WHIRLWIND,
-            },
-            },
-            {
-#line 9210
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9212
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9211
-            .lvl = 57,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9213
-                MOVE_PSYCHIC,
-                MOVE_FUTURE_SIGHT,
-                MOVE_RECOVER,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 9218
-            .species = SPECIES_RHYDON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9220
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9219
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9221
-                MOVE_TAKE_DOWN,
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_TOMB,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 9226
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9228
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9227
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9229
-                MOVE_HYDRO_PUMP,
-                MOVE_DRAGON_RAGE,
-                MOVE_BITE,
-                MOVE_THRASH,
-            },
-            },
-            {
-#line 9234
-            .species = SPECIES_ARCANINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9236
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9235
-            .lvl = 61,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9237
-                MOVE_EXTREME_SPEED,
-                MOVE_FLAMETHROWER,
-                MOVE_ROAR,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 9242
-            .species = SPECIES_VENUSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9242
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 9244
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9243
-            .lvl = 63,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9245
-                MOVE_SOLAR_BEAM,
-                MOVE_SYNTHESIS,
-                MOVE_SUNNY_DAY,
-                MOVE_GROWTH,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHAMPION_FIRST_BULBASAUR,
     },
 #line 9250
     [TRAINER_CHAMPION_FIRST_CHARMANDER] =
@@ -22632,119 +8300,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_YELLOW,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9261
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9263
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9262
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9264
-                MOVE_AERIAL_ACE,
-                MOVE_FEATHER_DANCE,
-                MOVE_SAND_ATTACK,
-                MOVE_WHIRLWIND,
-            },
-            },
-            {
-#line 9269
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9271
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9270
-            .lvl = 57,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9272
-                MOVE_PSYCHIC,
-                MOVE_FUTURE_SIGHT,
-                MOVE_RECOVER,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 9277
-            .species = SPECIES_RHYDON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9279
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9278
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9280
-                MOVE_TAKE_DOWN,
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_TOMB,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 9285
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9287
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9286
-            .lvl = 59,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9288
-                MOVE_GIGA_DRAIN,
-                MOVE_EGG_BOMB,
-                MOVE_SLEEP_POWDER,
-                MOVE_LIGHT_SCREEN,
-            },
-            },
-            {
-#line 9293
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9295
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9294
-            .lvl = 61,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9296
-                MOVE_HYDRO_PUMP,
-                MOVE_DRAGON_RAGE,
-                MOVE_BITE,
-                MOVE_THRASH,
-            },
-            },
-            {
-#line 9301
-            .species = SPECIES_CHARIZARD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9301
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 9303
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 9302
-            .lvl = 63,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9304
-                MOVE_FIRE_BLAST,
-                MOVE_AERIAL_ACE,
-                MOVE_SLASH,
-                MOVE_FIRE_SPIN,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHAMPION_FIRST_CHARMANDER,
     },
 #line 9309
     [TRAINER_CHANNELER_PATRICIA] =
@@ -22763,20 +8319,7 @@
 #line 9316
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9318
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9320
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9319
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_PATRICIA,
     },
 #line 9322
     [TRAINER_CHANNELER_CARLY] =
@@ -22795,20 +8338,7 @@
 #line 9329
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9331
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9333
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9332
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_CARLY,
     },
 #line 9335
     [TRAINER_CHANNELER_HOPE] =
@@ -22827,20 +8357,7 @@
 #line 9342
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9344
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9346
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9345
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_HOPE,
     },
 #line 9348
     [TRAINER_CHANNELER_PAULA] =
@@ -22859,20 +8376,7 @@
 #line 9355
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9357
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9359
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9358
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_PAULA,
     },
 #line 9361
     [TRAINER_CHANNELER_LAUREL] =
@@ -22891,31 +8395,7 @@
 #line 9368
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9370
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9372
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9371
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9374
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9376
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9375
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_LAUREL,
     },
 #line 9378
     [TRAINER_CHANNELER_JODY] =
@@ -22934,20 +8414,7 @@
 #line 9385
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9387
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9389
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9388
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_JODY,
     },
 #line 9391
     [TRAINER_CHANNELER_TAMMY] =
@@ -22966,20 +8433,7 @@
 #line 9398
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9400
-            .species = SPECIES_HAUNTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9402
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9401
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_TAMMY,
     },
 #line 9404
     [TRAINER_CHANNELER_RUTH] =
@@ -22998,20 +8452,7 @@
 #line 9411
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9413
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9415
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9414
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_RUTH,
     },
 #line 9417
     [TRAINER_CHANNELER_KARINA] =
@@ -23030,20 +8471,7 @@
 #line 9424
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9426
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9428
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9427
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_KARINA,
     },
 #line 9430
     [TRAINER_CHANNELER_JANAE] =
@@ -23062,20 +8490,7 @@
 #line 9437
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9439
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9441
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9440
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_JANAE,
     },
 #line 9443
     [TRAINER_CHANNELER_ANGELICA] =
@@ -23094,42 +8509,7 @@
 #line 9450
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9452
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9454
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9453
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9456
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9458
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9457
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9460
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9462
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9461
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_ANGELICA,
     },
 #line 9464
     [TRAINER_CHANNELER_EMILIA] =
@@ -23148,20 +8528,7 @@
 #line 9471
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9473
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9475
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9474
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_EMILIA,
     },
 #line 9477
     [TRAINER_CHANNELER_JENNIFER] =
@@ -23180,20 +8547,7 @@
 #line 9484
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9486
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9488
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9487
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_JENNIFER,
     },
 #line 9490
     [TRAINER_CHANNELER_1] =
@@ -23210,20 +8564,7 @@
 #line 9497
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9499
-            .species = SPECIES_HAUNTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9501
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9500
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_1,
     },
 #line 9503
     [TRAINER_CHANNELER_2] =
@@ -23240,20 +8581,7 @@
 #line 9510
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9512
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9514
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9513
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_2,
     },
 #line 9516
     [TRAINER_CHANNELER_3] =
@@ -23270,20 +8598,7 @@
 #line 9523
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9525
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9527
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9526
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_3,
     },
 #line 9529
     [TRAINER_CHANNELER_4] =
@@ -23300,20 +8615,7 @@
 #line 9536
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9538
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9540
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9539
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_4,
     },
 #line 9542
     [TRAINER_CHANNELER_5] =
@@ -23330,20 +8632,7 @@
 #line 9549
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9551
-            .species = SPECIES_HAUNTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9553
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9552
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_5,
     },
 #line 9555
     [TRAINER_CHANNELER_6] =
@@ -23360,42 +8649,7 @@
 #line 9562
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9564
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9566
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9565
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9568
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9570
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9569
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9572
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9574
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9573
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_6,
     },
 #line 9576
     [TRAINER_CHANNELER_7] =
@@ -23412,20 +8666,7 @@
 #line 9583
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9585
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9587
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9586
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_7,
     },
 #line 9589
     [TRAINER_CHANNELER_8] =
@@ -23442,20 +8683,7 @@
 #line 9596
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9598
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9600
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9599
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_8,
     },
 #line 9602
     [TRAINER_CHANNELER_AMANDA] =
@@ -23474,31 +8702,7 @@
 #line 9609
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9611
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9613
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9612
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9615
-            .species = SPECIES_HAUNTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9617
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9616
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_AMANDA,
     },
 #line 9619
     [TRAINER_CHANNELER_STACY] =
@@ -23517,20 +8721,7 @@
 #line 9626
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9628
-            .species = SPECIES_HAUNTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9630
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9629
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_STACY,
     },
 #line 9632
     [TRAINER_CHANNELER_TASHA] =
@@ -23549,42 +8740,7 @@
 #line 9639
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9641
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9643
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9642
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9645
-            .species = SPECIES_GASTLY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9647
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9646
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9649
-            .species = SPECIES_HAUNTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9651
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9650
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHANNELER_TASHA,
     },
 #line 9653
     [TRAINER_HIKER_JEREMY] =
@@ -23603,31 +8759,7 @@
 #line 9660
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9662
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9664
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9663
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9666
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9668
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9667
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_JEREMY,
     },
 #line 9670
     [TRAINER_PICNICKER_ALMA] =
@@ -23646,42 +8778,7 @@
 #line 9677
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9679
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9681
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9680
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9683
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9685
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9684
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9687
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9689
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9688
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ALMA,
     },
 #line 9691
     [TRAINER_PICNICKER_SUSIE] =
@@ -23700,64 +8797,7 @@
 #line 9698
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9700
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9702
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9701
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9704
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9706
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9705
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9708
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9710
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9709
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9712
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9714
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9713
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9716
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9718
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9717
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_SUSIE,
     },
 #line 9720
     [TRAINER_PICNICKER_VALERIE] =
@@ -23776,31 +8816,7 @@
 #line 9727
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9729
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9731
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9730
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9733
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9735
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9734
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_VALERIE,
     },
 #line 9737
     [TRAINER_PICNICKER_GWEN] =
@@ -23819,53 +8835,7 @@
 #line 9744
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9746
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9748
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9747
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9750
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9752
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9751
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9754
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9756
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9755
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9758
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9760
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9759
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_GWEN,
     },
 #line 9762
     [TRAINER_BIKER_VIRGIL] =
@@ -23884,63 +8854,7 @@
 #line 9769
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9771
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9773
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9772
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9774
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 9779
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9781
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9780
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9782
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 9787
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9789
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9788
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 9790
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_VIRGIL,
     },
 #line 9795
     [TRAINER_CAMPER_FLINT] =
@@ -23959,31 +8873,7 @@
 #line 9802
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9804
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9806
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9805
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9808
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9810
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9809
-            .lvl = 14,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_FLINT,
     },
 #line 9812
     [TRAINER_PICNICKER_MISSY] =
@@ -24002,31 +8892,7 @@
 #line 9819
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9821
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9823
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9822
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9825
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9827
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9826
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_MISSY,
     },
 #line 9829
     [TRAINER_PICNICKER_IRENE] =
@@ -24045,42 +8911,7 @@
 #line 9836
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9838
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9840
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9839
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9842
-            .species = SPECIES_HORSEA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9844
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9843
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9846
-            .species = SPECIES_SEEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9848
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9847
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_IRENE,
     },
 #line 9850
     [TRAINER_PICNICKER_DANA] =
@@ -24099,42 +8930,7 @@
 #line 9857
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9859
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9861
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9860
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9863
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9865
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9864
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9867
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9869
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9868
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_DANA,
     },
 #line 9871
     [TRAINER_PICNICKER_ARIANA] =
@@ -24153,53 +8949,7 @@
 #line 9878
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9880
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9882
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9881
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9884
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9886
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9885
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9888
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9890
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9889
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9892
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9894
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9893
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ARIANA,
     },
 #line 9896
     [TRAINER_PICNICKER_LEAH] =
@@ -24218,31 +8968,7 @@
 #line 9903
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9905
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9907
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9906
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9909
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9911
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9910
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_LEAH,
     },
 #line 9913
     [TRAINER_CAMPER_JUSTIN] =
@@ -24261,31 +8987,7 @@
 #line 9920
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9922
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9924
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9923
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9926
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9928
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9927
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_JUSTIN,
     },
 #line 9930
     [TRAINER_PICNICKER_YAZMIN] =
@@ -24304,42 +9006,7 @@
 #line 9937
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9939
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9941
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9940
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9943
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9945
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9944
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9947
-            .species = SPECIES_TANGELA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9949
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9948
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_YAZMIN,
     },
 #line 9951
     [TRAINER_PICNICKER_KINDRA] =
@@ -24358,42 +9025,7 @@
 #line 9958
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9960
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9962
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9961
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9964
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9966
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9965
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9968
-            .species = SPECIES_ODDISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9970
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9969
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_KINDRA,
     },
 #line 9972
     [TRAINER_PICNICKER_BECKY] =
@@ -24412,31 +9044,7 @@
 #line 9979
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9981
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9983
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9982
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 9985
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 9987
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9986
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_BECKY,
     },
 #line 9989
     [TRAINER_PICNICKER_CELIA] =
@@ -24455,20 +9063,7 @@
 #line 9996
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 9998
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10000
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 9999
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_CELIA,
     },
 #line 10002
     [TRAINER_GENTLEMAN_BROOKS] =
@@ -24487,20 +9082,7 @@
 #line 10009
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10011
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10013
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10012
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_BROOKS,
     },
 #line 10015
     [TRAINER_GENTLEMAN_LAMAR] =
@@ -24519,31 +9101,7 @@
 #line 10022
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10024
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10026
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10025
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10028
-            .species = SPECIES_PONYTA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10030
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10029
-            .lvl = 17,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_LAMAR,
     },
 #line 10032
     [TRAINER_TWINS_ELI_ANNE] =
@@ -24562,31 +9120,7 @@
 #line 10039
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10041
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10043
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10042
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10045
-            .species = SPECIES_JIGGLYPUFF,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10047
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10046
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TWINS_ELI_ANNE,
     },
 #line 10049
     [TRAINER_COOL_COUPLE_RAY_TYRA] =
@@ -24605,45 +9139,7 @@
 #line 10056
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10058
-            .species = SPECIES_NIDOQUEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10060
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10059
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10061
-                MOVE_SUPERPOWER,
-                MOVE_BODY_SLAM,
-                MOVE_DOUBLE_KICK,
-                MOVE_POISON_STING,
-            },
-            },
-            {
-#line 10066
-            .species = SPECIES_NIDOKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10068
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10067
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10069
-                MOVE_MEGAHORN,
-                MOVE_THRASH,
-                MOVE_DOUBLE_KICK,
-                MOVE_POISON_STING,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOL_COUPLE_RAY_TYRA,
     },
 #line 10074
     [TRAINER_YOUNG_COUPLE_GIA_JES] =
@@ -24662,31 +9158,7 @@
 #line 10081
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10083
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10085
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10084
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10087
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10089
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10088
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNG_COUPLE_GIA_JES,
     },
 #line 10091
     [TRAINER_TWINS_KIRI_JAN] =
@@ -24704,32 +9176,8 @@
         .doubleBattle = TRUE,
 #line 10098
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
-        .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10100
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10102
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10101
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10104
-            .species = SPECIES_SQUIRTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10106
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10105
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .partySize = 2,
+        .party = gTrainerParty_TRAINER_TWINS_KIRI_JAN,
     },
 #line 10108
     [TRAINER_CRUSH_KIN_RON_MYA] =
@@ -24748,35 +9196,7 @@
 #line 10115
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10117
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10117
-            .heldItem = ITEM_BLACK_BELT,
-#line 10119
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 10118
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10121
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10121
-            .heldItem = ITEM_BLACK_BELT,
-#line 10123
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 10122
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA,
     },
 #line 10125
     [TRAINER_YOUNG_COUPLE_LEA_JED] =
@@ -24795,31 +9215,7 @@
 #line 10132
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10134
-            .species = SPECIES_RAPIDASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10136
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10135
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10138
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10140
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10139
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNG_COUPLE_LEA_JED,
     },
 #line 10142
     [TRAINER_SIS_AND_BRO_LIA_LUC] =
@@ -24838,31 +9234,7 @@
 #line 10149
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10151
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10153
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10152
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10155
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10157
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10156
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SIS_AND_BRO_LIA_LUC,
     },
 #line 10159
     [TRAINER_SIS_AND_BRO_LIL_IAN] =
@@ -24881,31 +9253,7 @@
 #line 10166
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10168
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10170
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10169
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10172
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10174
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10173
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SIS_AND_BRO_LIL_IAN,
     },
 #line 10176
     [TRAINER_BUG_CATCHER_3] =
@@ -24922,20 +9270,7 @@
 #line 10183
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10185
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10187
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10186
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_3,
     },
 #line 10189
     [TRAINER_BUG_CATCHER_4] =
@@ -24952,20 +9287,7 @@
 #line 10196
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10198
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10200
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10199
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_4,
     },
 #line 10202
     [TRAINER_BUG_CATCHER_5] =
@@ -24982,20 +9304,7 @@
 #line 10209
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10211
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10213
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10212
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_5,
     },
 #line 10215
     [TRAINER_BUG_CATCHER_6] =
@@ -25012,20 +9321,7 @@
 #line 10222
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10224
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10226
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10225
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_6,
     },
 #line 10228
     [TRAINER_BUG_CATCHER_7] =
@@ -25042,20 +9338,7 @@
 #line 10235
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10237
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10239
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10238
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_7,
     },
 #line 10241
     [TRAINER_BUG_CATCHER_8] =
@@ -25072,20 +9355,7 @@
 #line 10248
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10250
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10252
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10251
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_8,
     },
 #line 10254
     [TRAINER_YOUNGSTER_BEN_3] =
@@ -25104,31 +9374,7 @@
 #line 10261
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10263
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10265
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10264
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10267
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10269
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10268
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_BEN_3,
     },
 #line 10271
     [TRAINER_YOUNGSTER_BEN_4] =
@@ -25147,31 +9393,7 @@
 #line 10278
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10280
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10282
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 10281
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10284
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10286
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 10285
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_BEN_4,
     },
 #line 10288
     [TRAINER_YOUNGSTER_CHAD_2] =
@@ -25190,31 +9412,7 @@
 #line 10295
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10297
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10299
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10298
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10301
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10303
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10302
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_CHAD_2,
     },
 #line 10305
     [TRAINER_LASS_RELI_2] =
@@ -25233,31 +9431,7 @@
 #line 10312
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10314
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10316
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10315
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10318
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10320
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10319
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_RELI_2,
     },
 #line 10322
     [TRAINER_LASS_RELI_3] =
@@ -25276,31 +9450,7 @@
 #line 10329
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10331
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10333
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10332
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10335
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10337
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10336
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_RELI_3,
     },
 #line 10339
     [TRAINER_YOUNGSTER_TIMMY_2] =
@@ -25319,42 +9469,7 @@
 #line 10346
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10348
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10350
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10349
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10352
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10354
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10353
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10356
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10358
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10357
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_TIMMY_2,
     },
 #line 10360
     [TRAINER_YOUNGSTER_TIMMY_3] =
@@ -25373,42 +9488,7 @@
 #line 10367
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10369
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10371
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10370
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10373
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10375
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10374
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10377
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10379
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10378
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_TIMMY_3,
     },
 #line 10381
     [TRAINER_YOUNGSTER_TIMMY_4] =
@@ -25427,42 +9507,7 @@
 #line 10388
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10390
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10392
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 10391
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10394
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10396
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 10395
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10398
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10400
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 10399
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_TIMMY_4,
     },
 #line 10402
     [TRAINER_YOUNGSTER_CHAD_3] =
@@ -25481,31 +9526,7 @@
 #line 10409
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10411
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10413
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10412
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10415
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10417
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10416
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_CHAD_3,
     },
 #line 10419
     [TRAINER_LASS_JANICE_2] =
@@ -25524,31 +9545,7 @@
 #line 10426
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10428
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10430
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10429
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10432
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10434
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 10433
-            .lvl = 20,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_JANICE_2,
     },
 #line 10436
     [TRAINER_LASS_JANICE_3] =
@@ -25567,31 +9564,7 @@
 #line 10443
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10445
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10447
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10446
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10449
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10451
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10450
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_JANICE_3,
     },
 #line 10453
     [TRAINER_YOUNGSTER_CHAD_4] =
@@ -25610,31 +9583,7 @@
 #line 10460
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10462
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10464
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 10463
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10466
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10468
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 10467
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_CHAD_4,
     },
 #line 10470
     [TRAINER_HIKER_FRANKLIN_2] =
@@ -25653,31 +9602,7 @@
 #line 10477
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10479
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10481
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 10480
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10483
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10485
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 10484
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_FRANKLIN_2,
     },
 #line 10487
     [TRAINER_PKMN_PROF_PROF_OAK] =
@@ -25696,20 +9621,7 @@
 #line 10494
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10496
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10498
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10497
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_PROF_PROF_OAK,
     },
 #line 10500
     [TRAINER_PLAYER_BRENDAN] =
@@ -25728,20 +9640,7 @@
 #line 10507
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10509
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10511
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10510
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PLAYER_BRENDAN,
     },
 #line 10513
     [TRAINER_PLAYER_MAY] =
@@ -25760,20 +9659,7 @@
 #line 10520
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10522
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10524
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10523
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PLAYER_MAY,
     },
 #line 10526
     [TRAINER_PLAYER_RED] =
@@ -25792,20 +9678,7 @@
 #line 10533
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10535
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10537
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10536
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PLAYER_RED,
     },
 #line 10539
     [TRAINER_PLAYER_LEAF] =
@@ -25824,20 +9697,7 @@
 #line 10546
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10548
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10550
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10549
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PLAYER_LEAF,
     },
 #line 10552
     [TRAINER_TEAM_ROCKET_GRUNT_42] =
@@ -25856,31 +9716,7 @@
 #line 10559
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10561
-            .species = SPECIES_HOUNDOUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10563
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10562
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10565
-            .species = SPECIES_HOUNDOUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10567
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10566
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_42,
     },
 #line 10569
     [TRAINER_PSYCHIC_JACLYN] =
@@ -25899,63 +9735,7 @@
 #line 10576
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10578
-            .species = SPECIES_NATU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10580
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10579
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10581
-                MOVE_NIGHT_SHADE,
-                MOVE_CONFUSE_RAY,
-                MOVE_FUTURE_SIGHT,
-                MOVE_WISH,
-            },
-            },
-            {
-#line 10586
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10588
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10587
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10589
-                MOVE_PSYCHIC,
-                MOVE_HEADBUTT,
-                MOVE_AMNESIA,
-                MOVE_YAWN,
-            },
-            },
-            {
-#line 10594
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10596
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10595
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10597
-                MOVE_PSYCHIC,
-                MOVE_FUTURE_SIGHT,
-                MOVE_RECOVER,
-                MOVE_REFLECT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_JACLYN,
     },
 #line 10602
     [TRAINER_CRUSH_GIRL_SHARON] =
@@ -25974,35 +9754,7 @@
 #line 10609
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10611
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10611
-            .heldItem = ITEM_BLACK_BELT,
-#line 10613
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 10612
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10615
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10615
-            .heldItem = ITEM_BLACK_BELT,
-#line 10617
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 10616
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_SHARON,
     },
 #line 10619
     [TRAINER_TUBER_AMIRA] =
@@ -26021,42 +9773,7 @@
 #line 10626
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10628
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10630
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10629
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10632
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10634
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10633
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10636
-            .species = SPECIES_POLIWAG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10638
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10637
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TUBER_AMIRA,
     },
 #line 10640
     [TRAINER_PKMN_BREEDER_ALIZE] =
@@ -26075,42 +9792,7 @@
 #line 10647
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10649
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10651
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 10650
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10653
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10655
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 10654
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10657
-            .species = SPECIES_MARILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10659
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 10658
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_BREEDER_ALIZE,
     },
 #line 10661
     [TRAINER_PKMN_RANGER_NICOLAS] =
@@ -26131,45 +9813,7 @@
 #line 10669
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10671
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10673
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10672
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10674
-                MOVE_RAZOR_LEAF,
-                MOVE_ACID,
-                MOVE_SWEET_SCENT,
-                MOVE_WRAP,
-            },
-            },
-            {
-#line 10679
-            .species = SPECIES_VICTREEBEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10681
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10680
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10682
-                MOVE_RAZOR_LEAF,
-                MOVE_ACID,
-                MOVE_SLEEP_POWDER,
-                MOVE_STUN_SPORE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_NICOLAS,
     },
 #line 10687
     [TRAINER_PKMN_RANGER_MADELINE] =
@@ -26190,45 +9834,7 @@
 #line 10695
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10697
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10699
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10698
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10700
-                MOVE_PETAL_DANCE,
-                MOVE_ACID,
-                MOVE_SWEET_SCENT,
-                MOVE_POISON_POWDER,
-            },
-            },
-            {
-#line 10705
-            .species = SPECIES_VILEPLUME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10707
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 10706
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10708
-                MOVE_PETAL_DANCE,
-                MOVE_MOONLIGHT,
-                MOVE_ACID,
-                MOVE_STUN_SPORE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_MADELINE,
     },
 #line 10713
     [TRAINER_AROMA_LADY_NIKKI] =
@@ -26247,31 +9853,7 @@
 #line 10720
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10722
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10724
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10723
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10726
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10728
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10727
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AROMA_LADY_NIKKI,
     },
 #line 10730
     [TRAINER_RUIN_MANIAC_STANLY] =
@@ -26290,42 +9872,7 @@
 #line 10737
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10739
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10741
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10740
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10743
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10745
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10744
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10747
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10749
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10748
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_STANLY,
     },
 #line 10751
     [TRAINER_LADY_JACKI] =
@@ -26346,35 +9893,7 @@
 #line 10759
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10761
-            .species = SPECIES_HOPPIP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10761
-            .heldItem = ITEM_STARDUST,
-#line 10763
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10762
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10765
-            .species = SPECIES_SKIPLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10765
-            .heldItem = ITEM_STARDUST,
-#line 10767
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10766
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LADY_JACKI,
     },
 #line 10769
     [TRAINER_PAINTER_DAISY] =
@@ -26393,27 +9912,7 @@
 #line 10776
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10778
-            .species = SPECIES_SMEARGLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10780
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 10779
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10781
-                MOVE_DYNAMIC_PUNCH,
-                MOVE_DIZZY_PUNCH,
-                MOVE_FOCUS_PUNCH,
-                MOVE_MEGA_PUNCH,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PAINTER_DAISY,
     },
 #line 10786
     [TRAINER_BIKER_GOON] =
@@ -26432,45 +9931,7 @@
 #line 10793
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10795
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10797
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10796
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10798
-                MOVE_HAZE,
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_TACKLE,
-            },
-            },
-            {
-#line 10803
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10805
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10804
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10806
-                MOVE_ACID_ARMOR,
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_GOON,
     },
 #line 10811
     [TRAINER_BIKER_GOON_2] =
@@ -26489,27 +9950,7 @@
 #line 10818
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10820
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10822
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10821
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10823
-                MOVE_HAZE,
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_TACKLE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_GOON_2,
     },
 #line 10828
     [TRAINER_BIKER_GOON_3] =
@@ -26528,20 +9969,7 @@
 #line 10835
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10837
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10839
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10838
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_GOON_3,
     },
 #line 10841
     [TRAINER_BIKER_2] =
@@ -26558,20 +9986,7 @@
 #line 10848
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10850
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10852
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10851
-            .lvl = 5,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_2,
     },
 #line 10854
     [TRAINER_BUG_CATCHER_ANTHONY] =
@@ -26590,31 +10005,7 @@
 #line 10861
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10863
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10865
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10864
-            .lvl = 7,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10867
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10869
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10868
-            .lvl = 8,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_ANTHONY,
     },
 #line 10871
     [TRAINER_BUG_CATCHER_CHARLIE] =
@@ -26633,42 +10024,7 @@
 #line 10878
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10880
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10882
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10881
-            .lvl = 7,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10884
-            .species = SPECIES_CATERPIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10886
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10885
-            .lvl = 7,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10888
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10890
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10889
-            .lvl = 7,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_CHARLIE,
     },
 #line 10892
     [TRAINER_TWINS_ELI_ANNE_2] =
@@ -26687,31 +10043,7 @@
 #line 10899
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10901
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10903
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10902
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10905
-            .species = SPECIES_JIGGLYPUFF,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10907
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 10906
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TWINS_ELI_ANNE_2,
     },
 #line 10909
     [TRAINER_YOUNGSTER_JOHNSON] =
@@ -26730,42 +10062,7 @@
 #line 10916
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10918
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10920
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10919
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10922
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10924
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10923
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10926
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10928
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10927
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_JOHNSON,
     },
 #line 10930
     [TRAINER_BIKER_RICARDO] =
@@ -26784,63 +10081,7 @@
 #line 10937
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10939
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10941
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10940
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10942
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-                MOVE_POISON_GAS,
-            },
-            },
-            {
-#line 10947
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10949
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10948
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10950
-                MOVE_SLUDGE,
-                MOVE_SMOG,
-                MOVE_TACKLE,
-                MOVE_POISON_GAS,
-            },
-            },
-            {
-#line 10955
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10957
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10956
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 10958
-                MOVE_MINIMIZE,
-                MOVE_SLUDGE,
-                MOVE_DISABLE,
-                MOVE_POUND,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_RICARDO,
     },
 #line 10963
     [TRAINER_BIKER_JAREN] =
@@ -26859,31 +10100,7 @@
 #line 10970
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10972
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10974
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10973
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10976
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10978
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10977
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_JAREN,
     },
 #line 10980
     [TRAINER_TEAM_ROCKET_GRUNT_43] =
@@ -26902,31 +10119,7 @@
 #line 10987
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 10989
-            .species = SPECIES_CUBONE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10991
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10990
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 10993
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 10995
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 10994
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_43,
     },
 #line 10997
     [TRAINER_TEAM_ROCKET_GRUNT_44] =
@@ -26945,53 +10138,7 @@
 #line 11004
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11006
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11008
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11007
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11010
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11012
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11011
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11014
-            .species = SPECIES_SANDSHREW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11016
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11015
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11018
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11020
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11019
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_44,
     },
 #line 11022
     [TRAINER_TEAM_ROCKET_GRUNT_45] =
@@ -27010,42 +10157,7 @@
 #line 11029
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11031
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11033
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11032
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11035
-            .species = SPECIES_ZUBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11037
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11036
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11039
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11041
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11040
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_45,
     },
 #line 11043
     [TRAINER_TEAM_ROCKET_GRUNT_46] =
@@ -27064,42 +10176,7 @@
 #line 11050
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11052
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11054
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11053
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11056
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11058
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11057
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11060
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11062
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11061
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_46,
     },
 #line 11064
     [TRAINER_TEAM_ROCKET_GRUNT_47] =
@@ -27118,42 +10195,7 @@
 #line 11071
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11073
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11075
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11074
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11077
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11079
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11078
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11081
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11083
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11082
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_47,
     },
 #line 11085
     [TRAINER_TEAM_ROCKET_GRUNT_48] =
@@ -27172,31 +10214,7 @@
 #line 11092
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11094
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11096
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11095
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11098
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11100
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11099
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_48,
     },
 #line 11102
     [TRAINER_TEAM_ROCKET_ADMIN] =
@@ -27217,63 +10235,7 @@
 #line 11110
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11112
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11114
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 11113
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11115
-                MOVE_SLUDGE_BOMB,
-                MOVE_SCREECH,
-                MOVE_MINIMIZE,
-                MOVE_ROCK_TOMB,
-            },
-            },
-            {
-#line 11120
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11122
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 11121
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11123
-                MOVE_SLUDGE_BOMB,
-                MOVE_BITE,
-                MOVE_EARTHQUAKE,
-                MOVE_IRON_TAIL,
-            },
-            },
-            {
-#line 11128
-            .species = SPECIES_VILEPLUME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11130
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 11129
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11131
-                MOVE_SLUDGE_BOMB,
-                MOVE_GIGA_DRAIN,
-                MOVE_SLEEP_POWDER,
-                MOVE_STUN_SPORE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_ADMIN,
     },
 #line 11136
     [TRAINER_TEAM_ROCKET_ADMIN_2] =
@@ -27294,63 +10256,7 @@
 #line 11144
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11146
-            .species = SPECIES_GOLBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11148
-            .iv = TRAINER_PARTY_IVS(24, 24, 24, 24, 24, 24),
-#line 11147
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11149
-                MOVE_CONFUSE_RAY,
-                MOVE_SLUDGE_BOMB,
-                MOVE_AIR_CUTTER,
-                MOVE_SHADOW_BALL,
-            },
-            },
-            {
-#line 11154
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11156
-            .iv = TRAINER_PARTY_IVS(24, 24, 24, 24, 24, 24),
-#line 11155
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11157
-                MOVE_SLUDGE_BOMB,
-                MOVE_THUNDERBOLT,
-                MOVE_EXPLOSION,
-                MOVE_SHADOW_BALL,
-            },
-            },
-            {
-#line 11162
-            .species = SPECIES_HOUNDOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11164
-            .iv = TRAINER_PARTY_IVS(24, 24, 24, 24, 24, 24),
-#line 11163
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11165
-                MOVE_FLAMETHROWER,
-                MOVE_CRUNCH,
-                MOVE_IRON_TAIL,
-                MOVE_SHADOW_BALL,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_ADMIN_2,
     },
 #line 11170
     [TRAINER_SCIENTIST_GIDEON] =
@@ -27369,99 +10275,7 @@
 #line 11177
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11179
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11181
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11180
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11182
-                MOVE_SWIFT,
-                MOVE_SCREECH,
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-            },
-            },
-            {
-#line 11187
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11189
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11188
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11190
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-                MOVE_SCREECH,
-                MOVE_CHARGE,
-            },
-            },
-            {
-#line 11195
-            .species = SPECIES_MAGNEMITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11197
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11196
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11198
-                MOVE_SCREECH,
-                MOVE_SWIFT,
-                MOVE_SPARK,
-                MOVE_THUNDER_WAVE,
-            },
-            },
-            {
-#line 11203
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11205
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11204
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11206
-                MOVE_TRI_ATTACK,
-                MOVE_SPARK,
-                MOVE_THUNDER_WAVE,
-                MOVE_SONIC_BOOM,
-            },
-            },
-            {
-#line 11211
-            .species = SPECIES_PORYGON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11213
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11212
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11214
-                MOVE_TRI_ATTACK,
-                MOVE_CONVERSION,
-                MOVE_RECOVER,
-                MOVE_PSYBEAM,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_SCIENTIST_GIDEON,
     },
 #line 11219
     [TRAINER_SWIMMER_FEMALE_AMARA] =
@@ -27480,42 +10294,7 @@
 #line 11226
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11228
-            .species = SPECIES_SEEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11230
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11229
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11232
-            .species = SPECIES_SEEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11234
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11233
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11236
-            .species = SPECIES_DEWGONG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11238
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11237
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_AMARA,
     },
 #line 11240
     [TRAINER_SWIMMER_FEMALE_MARIA] =
@@ -27534,31 +10313,7 @@
 #line 11247
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11249
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11251
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11250
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11253
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11255
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11254
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_MARIA,
     },
 #line 11257
     [TRAINER_SWIMMER_FEMALE_ABIGAIL] =
@@ -27577,42 +10332,7 @@
 #line 11264
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11266
-            .species = SPECIES_PSYDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11268
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11267
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11270
-            .species = SPECIES_PSYDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11272
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11271
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11274
-            .species = SPECIES_GOLDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11276
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11275
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_ABIGAIL,
     },
 #line 11278
     [TRAINER_SWIMMER_MALE_FINN] =
@@ -27631,20 +10351,7 @@
 #line 11285
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11287
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11289
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11288
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_FINN,
     },
 #line 11291
     [TRAINER_SWIMMER_MALE_GARRETT] =
@@ -27663,42 +10370,7 @@
 #line 11298
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11300
-            .species = SPECIES_SHELLDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11302
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11301
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11304
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11306
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11305
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11308
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11310
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11309
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_GARRETT,
     },
 #line 11312
     [TRAINER_FISHERMAN_TOMMY] =
@@ -27717,64 +10389,7 @@
 #line 11319
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11321
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11323
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11322
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11325
-            .species = SPECIES_GOLDEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11327
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11326
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11329
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11331
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11330
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11333
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11335
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11334
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11337
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11339
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11338
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_TOMMY,
     },
 #line 11341
     [TRAINER_CRUSH_GIRL_TANYA] =
@@ -27793,35 +10408,7 @@
 #line 11348
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11350
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11350
-            .heldItem = ITEM_BLACK_BELT,
-#line 11352
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11351
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11354
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11354
-            .heldItem = ITEM_BLACK_BELT,
-#line 11356
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11355
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_TANYA,
     },
 #line 11358
     [TRAINER_BLACK_BELT_SHEA] =
@@ -27840,35 +10427,7 @@
 #line 11365
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11367
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11367
-            .heldItem = ITEM_BLACK_BELT,
-#line 11369
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11368
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11371
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11371
-            .heldItem = ITEM_BLACK_BELT,
-#line 11373
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11372
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_SHEA,
     },
 #line 11375
     [TRAINER_BLACK_BELT_HUGH] =
@@ -27887,35 +10446,7 @@
 #line 11382
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11384
-            .species = SPECIES_MACHOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11384
-            .heldItem = ITEM_BLACK_BELT,
-#line 11386
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11385
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11388
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11388
-            .heldItem = ITEM_BLACK_BELT,
-#line 11390
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11389
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_HUGH,
     },
 #line 11392
     [TRAINER_CAMPER_BRYCE] =
@@ -27934,42 +10465,7 @@
 #line 11399
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11401
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11403
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11402
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11405
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11407
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11406
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11409
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11411
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11410
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_BRYCE,
     },
 #line 11413
     [TRAINER_PICNICKER_CLAIRE] =
@@ -27988,53 +10484,7 @@
 #line 11420
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11422
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11424
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11423
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11426
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11428
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11427
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11430
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11432
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11431
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11434
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11436
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11435
-            .lvl = 35,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_CLAIRE,
     },
 #line 11438
     [TRAINER_CRUSH_KIN_MIK_KIA] =
@@ -28053,35 +10503,7 @@
 #line 11445
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11447
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11447
-            .heldItem = ITEM_BLACK_BELT,
-#line 11449
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11448
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11451
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11451
-            .heldItem = ITEM_BLACK_BELT,
-#line 11453
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11452
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_KIN_MIK_KIA,
     },
 #line 11455
     [TRAINER_AROMA_LADY_VIOLET] =
@@ -28100,42 +10522,7 @@
 #line 11462
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11464
-            .species = SPECIES_BULBASAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11466
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11465
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11468
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11470
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11469
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11472
-            .species = SPECIES_IVYSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11474
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11473
-            .lvl = 36,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AROMA_LADY_VIOLET,
     },
 #line 11476
     [TRAINER_TUBER_ALEXIS] =
@@ -28154,53 +10541,7 @@
 #line 11483
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11485
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11487
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11486
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11489
-            .species = SPECIES_STARYU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11491
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11490
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11493
-            .species = SPECIES_KRABBY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11495
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11494
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11497
-            .species = SPECIES_KRABBY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11499
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11498
-            .lvl = 34,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TUBER_ALEXIS,
     },
 #line 11501
     [TRAINER_TWINS_JOY_MEG] =
@@ -28219,31 +10560,7 @@
 #line 11508
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11510
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11512
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11511
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11514
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11516
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11515
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TWINS_JOY_MEG,
     },
 #line 11518
     [TRAINER_SWIMMER_FEMALE_TISHA] =
@@ -28262,20 +10579,7 @@
 #line 11525
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11527
-            .species = SPECIES_KINGLER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11529
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11528
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_TISHA,
     },
 #line 11531
     [TRAINER_PAINTER_CELINA] =
@@ -28294,27 +10598,7 @@
 #line 11538
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11540
-            .species = SPECIES_SMEARGLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11542
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11541
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11543
-                MOVE_FLY,
-                MOVE_DIG,
-                MOVE_DIVE,
-                MOVE_BOUNCE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PAINTER_CELINA,
     },
 #line 11548
     [TRAINER_PAINTER_RAYNA] =
@@ -28333,27 +10617,7 @@
 #line 11555
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11557
-            .species = SPECIES_SMEARGLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11559
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11558
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11560
-                MOVE_CROSS_CHOP,
-                MOVE_MEGAHORN,
-                MOVE_DOUBLE_EDGE,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PAINTER_RAYNA,
     },
 #line 11565
     [TRAINER_LADY_GILLIAN] =
@@ -28374,48 +10638,7 @@
 #line 11573
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11575
-            .species = SPECIES_MAREEP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11575
-            .heldItem = ITEM_STARDUST,
-#line 11577
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11576
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11579
-            .species = SPECIES_MAREEP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11579
-            .heldItem = ITEM_STARDUST,
-#line 11581
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11580
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11583
-            .species = SPECIES_FLAAFFY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11583
-            .heldItem = ITEM_NUGGET,
-#line 11585
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11584
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LADY_GILLIAN,
     },
 #line 11587
     [TRAINER_YOUNGSTER_DESTIN] =
@@ -28434,31 +10657,7 @@
 #line 11594
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11596
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11598
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11597
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11600
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11602
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11601
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_DESTIN,
     },
 #line 11604
     [TRAINER_SWIMMER_MALE_TOBY] =
@@ -28477,42 +10676,7 @@
 #line 11611
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11613
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11615
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11614
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11617
-            .species = SPECIES_TENTACOOL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11619
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11618
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11621
-            .species = SPECIES_TENTACRUEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11623
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11622
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_TOBY,
     },
 #line 11625
     [TRAINER_TEAM_ROCKET_GRUNT_49] =
@@ -28531,42 +10695,7 @@
 #line 11632
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11634
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11636
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11635
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11638
-            .species = SPECIES_GRIMER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11640
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11639
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11642
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11644
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11643
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_49,
     },
 #line 11646
     [TRAINER_TEAM_ROCKET_GRUNT_50] =
@@ -28585,45 +10714,7 @@
 #line 11653
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11655
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11657
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11656
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11658
-                MOVE_MEMENTO,
-                MOVE_HAZE,
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-            },
-            },
-            {
-#line 11663
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11665
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11664
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11666
-                MOVE_HAZE,
-                MOVE_SMOKESCREEN,
-                MOVE_SLUDGE,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_50,
     },
 #line 11671
     [TRAINER_TEAM_ROCKET_GRUNT_51] =
@@ -28642,42 +10733,7 @@
 #line 11678
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11680
-            .species = SPECIES_EKANS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11682
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11681
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11684
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11686
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11685
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11688
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11690
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 11689
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TEAM_ROCKET_GRUNT_51,
     },
 #line 11692
     [TRAINER_BIRD_KEEPER_MILO] =
@@ -28696,31 +10752,7 @@
 #line 11699
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11701
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11703
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11702
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11705
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11707
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11706
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_MILO,
     },
 #line 11709
     [TRAINER_BIRD_KEEPER_CHAZ] =
@@ -28739,31 +10771,7 @@
 #line 11716
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11718
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11720
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11719
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11722
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11724
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11723
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_CHAZ,
     },
 #line 11726
     [TRAINER_BIRD_KEEPER_HAROLD] =
@@ -28782,31 +10790,7 @@
 #line 11733
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11735
-            .species = SPECIES_HOOTHOOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11737
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11736
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11739
-            .species = SPECIES_NOCTOWL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11741
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11740
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_HAROLD,
     },
 #line 11743
     [TRAINER_FISHERMAN_TYLOR] =
@@ -28825,31 +10809,7 @@
 #line 11750
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11752
-            .species = SPECIES_QWILFISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11754
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11753
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11756
-            .species = SPECIES_QWILFISH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11758
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11757
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_TYLOR,
     },
 #line 11760
     [TRAINER_SWIMMER_MALE_MYMO] =
@@ -28868,31 +10828,7 @@
 #line 11767
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11769
-            .species = SPECIES_KINGLER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11771
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11770
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11773
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11775
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11774
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_MYMO,
     },
 #line 11777
     [TRAINER_SWIMMER_FEMALE_NICOLE] =
@@ -28911,20 +10847,7 @@
 #line 11784
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11786
-            .species = SPECIES_MARILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11788
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11787
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_NICOLE,
     },
 #line 11790
     [TRAINER_SIS_AND_BRO_AVA_GEB] =
@@ -28943,31 +10866,7 @@
 #line 11797
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11799
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11801
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11800
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11803
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11805
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11804
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SIS_AND_BRO_AVA_GEB,
     },
 #line 11807
     [TRAINER_AROMA_LADY_ROSE] =
@@ -28986,31 +10885,7 @@
 #line 11814
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11816
-            .species = SPECIES_SUNKERN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11818
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11817
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11820
-            .species = SPECIES_SUNFLORA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11822
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11821
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AROMA_LADY_ROSE,
     },
 #line 11824
     [TRAINER_SWIMMER_MALE_SAMIR] =
@@ -29029,20 +10904,7 @@
 #line 11831
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11833
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11835
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11834
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_SAMIR,
     },
 #line 11837
     [TRAINER_SWIMMER_FEMALE_DENISE] =
@@ -29061,31 +10923,7 @@
 #line 11844
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11846
-            .species = SPECIES_CHINCHOU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11848
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11847
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11850
-            .species = SPECIES_LANTURN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11852
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11851
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_DENISE,
     },
 #line 11854
     [TRAINER_TWINS_MIU_MIA] =
@@ -29104,31 +10942,7 @@
 #line 11861
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11863
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11865
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11864
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11867
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11869
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11868
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TWINS_MIU_MIA,
     },
 #line 11871
     [TRAINER_HIKER_EARL] =
@@ -29147,31 +10961,7 @@
 #line 11878
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11880
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11882
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11881
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11884
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11886
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11885
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_EARL,
     },
 #line 11888
     [TRAINER_RUIN_MANIAC_FOSTER] =
@@ -29190,20 +10980,7 @@
 #line 11895
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11897
-            .species = SPECIES_GOLEM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11899
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11898
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_FOSTER,
     },
 #line 11901
     [TRAINER_RUIN_MANIAC_LARRY] =
@@ -29222,31 +10999,7 @@
 #line 11908
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11910
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11912
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11911
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11914
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11916
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11915
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_LARRY,
     },
 #line 11918
     [TRAINER_HIKER_DARYL] =
@@ -29265,20 +11018,7 @@
 #line 11925
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11927
-            .species = SPECIES_SUDOWOODO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11929
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 11928
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_DARYL,
     },
 #line 11931
     [TRAINER_POKEMANIAC_HECTOR] =
@@ -29297,31 +11037,7 @@
 #line 11938
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11940
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11942
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 11941
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 11944
-            .species = SPECIES_KANGASKHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11946
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 11945
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_HECTOR,
     },
 #line 11948
     [TRAINER_PSYCHIC_DARIO] =
@@ -29340,27 +11056,7 @@
 #line 11955
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11957
-            .species = SPECIES_GIRAFARIG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11959
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11958
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11960
-                MOVE_CRUNCH,
-                MOVE_PSYBEAM,
-                MOVE_ODOR_SLEUTH,
-                MOVE_AGILITY,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_DARIO,
     },
 #line 11965
     [TRAINER_PSYCHIC_RODETTE] =
@@ -29379,63 +11075,7 @@
 #line 11972
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 11974
-            .species = SPECIES_NATU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11976
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11975
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11977
-                MOVE_NIGHT_SHADE,
-                MOVE_CONFUSE_RAY,
-                MOVE_WISH,
-                MOVE_FUTURE_SIGHT,
-            },
-            },
-            {
-#line 11982
-            .species = SPECIES_DROWZEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11984
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11983
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11985
-                MOVE_PSYCHIC,
-                MOVE_DISABLE,
-                MOVE_PSYCH_UP,
-                MOVE_FUTURE_SIGHT,
-            },
-            },
-            {
-#line 11990
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 11992
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 11991
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 11993
-                MOVE_PSYCHIC,
-                MOVE_HYPNOSIS,
-                MOVE_PSYCH_UP,
-                MOVE_FUTURE_SIGHT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_RODETTE,
     },
 #line 11998
     [TRAINER_AROMA_LADY_MIAH] =
@@ -29454,31 +11094,7 @@
 #line 12005
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12007
-            .species = SPECIES_BELLOSSOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12009
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12008
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12011
-            .species = SPECIES_BELLOSSOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12013
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12012
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_AROMA_LADY_MIAH,
     },
 #line 12015
     [TRAINER_YOUNG_COUPLE_EVE_JON] =
@@ -29497,31 +11113,7 @@
 #line 12022
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12024
-            .species = SPECIES_GOLDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12026
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12025
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12028
-            .species = SPECIES_PSYDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12030
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12029
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNG_COUPLE_EVE_JON,
     },
 #line 12032
     [TRAINER_JUGGLER_MASON] =
@@ -29540,81 +11132,7 @@
 #line 12039
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12041
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12043
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12042
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12044
-                MOVE_SWIFT,
-                MOVE_LIGHT_SCREEN,
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-            },
-            },
-            {
-#line 12049
-            .species = SPECIES_PINECO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12051
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12050
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12052
-                MOVE_SPIKES,
-                MOVE_BIDE,
-                MOVE_RAPID_SPIN,
-                MOVE_TAKE_DOWN,
-            },
-            },
-            {
-#line 12057
-            .species = SPECIES_VOLTORB,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12059
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12058
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12060
-                MOVE_SWIFT,
-                MOVE_LIGHT_SCREEN,
-                MOVE_SPARK,
-                MOVE_SONIC_BOOM,
-            },
-            },
-            {
-#line 12065
-            .species = SPECIES_PINECO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12067
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12066
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12068
-                MOVE_SPIKES,
-                MOVE_BIDE,
-                MOVE_RAPID_SPIN,
-                MOVE_EXPLOSION,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_MASON,
     },
 #line 12073
     [TRAINER_CRUSH_GIRL_CYNDY] =
@@ -29633,48 +11151,7 @@
 #line 12080
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12082
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12082
-            .heldItem = ITEM_BLACK_BELT,
-#line 12084
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 12083
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12086
-            .species = SPECIES_HITMONTOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12086
-            .heldItem = ITEM_BLACK_BELT,
-#line 12088
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 12087
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12090
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12090
-            .heldItem = ITEM_BLACK_BELT,
-#line 12092
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 12091
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_CYNDY,
     },
 #line 12094
     [TRAINER_CRUSH_GIRL_JOCELYN] =
@@ -29693,35 +11170,7 @@
 #line 12101
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12103
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12103
-            .heldItem = ITEM_BLACK_BELT,
-#line 12105
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 12104
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12107
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12107
-            .heldItem = ITEM_BLACK_BELT,
-#line 12109
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 12108
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_JOCELYN,
     },
 #line 12111
     [TRAINER_TAMER_EVAN] =
@@ -29740,42 +11189,7 @@
 #line 12118
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12120
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12122
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 12121
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12124
-            .species = SPECIES_LICKITUNG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12126
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 12125
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12128
-            .species = SPECIES_URSARING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12130
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 12129
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_EVAN,
     },
 #line 12132
     [TRAINER_POKEMANIAC_MARK_2] =
@@ -29794,31 +11208,7 @@
 #line 12139
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12141
-            .species = SPECIES_RHYHORN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12143
-            .iv = TRAINER_PARTY_IVS(10, 10, 10, 10, 10, 10),
-#line 12142
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12145
-            .species = SPECIES_LICKITUNG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12147
-            .iv = TRAINER_PARTY_IVS(10, 10, 10, 10, 10, 10),
-#line 12146
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_MARK_2,
     },
 #line 12149
     [TRAINER_PKMN_RANGER_LOGAN] =
@@ -29839,45 +11229,7 @@
 #line 12157
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12159
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12161
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12160
-            .lvl = 37,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12162
-                MOVE_SLEEP_POWDER,
-                MOVE_POISON_POWDER,
-                MOVE_STUN_SPORE,
-                MOVE_CONFUSION,
-            },
-            },
-            {
-#line 12167
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12169
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12168
-            .lvl = 40,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12170
-                MOVE_EGG_BOMB,
-                MOVE_STOMP,
-                MOVE_CONFUSION,
-                MOVE_HYPNOSIS,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_LOGAN,
     },
 #line 12175
     [TRAINER_PKMN_RANGER_JACKSON] =
@@ -29898,63 +11250,7 @@
 #line 12183
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12185
-            .species = SPECIES_TANGELA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12187
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12186
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12188
-                MOVE_SLAM,
-                MOVE_MEGA_DRAIN,
-                MOVE_BIND,
-                MOVE_INGRAIN,
-            },
-            },
-            {
-#line 12193
-            .species = SPECIES_EXEGGCUTE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12195
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12194
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12196
-                MOVE_CONFUSION,
-                MOVE_POISON_POWDER,
-                MOVE_BARRAGE,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 12201
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12203
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12202
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12204
-                MOVE_CONFUSION,
-                MOVE_EGG_BOMB,
-                MOVE_SLEEP_POWDER,
-                MOVE_STOMP,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_JACKSON,
     },
 #line 12209
     [TRAINER_PKMN_RANGER_BETH] =
@@ -29975,42 +11271,7 @@
 #line 12217
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12219
-            .species = SPECIES_BELLSPROUT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12221
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12220
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12223
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12225
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12224
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12227
-            .species = SPECIES_GLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12229
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12228
-            .lvl = 38,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_BETH,
     },
 #line 12231
     [TRAINER_PKMN_RANGER_KATELYN] =
@@ -30031,27 +11292,7 @@
 #line 12239
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12241
-            .species = SPECIES_CHANSEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12243
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12242
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12244
-                MOVE_EGG_BOMB,
-                MOVE_DEFENSE_CURL,
-                MOVE_MINIMIZE,
-                MOVE_SOFT_BOILED,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_KATELYN,
     },
 #line 12249
     [TRAINER_COOLTRAINER_LEROY] =
@@ -30072,99 +11313,7 @@
 #line 12257
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12259
-            .species = SPECIES_RHYDON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12261
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12260
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12262
-                MOVE_TAKE_DOWN,
-                MOVE_HORN_DRILL,
-                MOVE_ROCK_BLAST,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 12267
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12269
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12268
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12270
-                MOVE_PSYCHIC,
-                MOVE_HEADBUTT,
-                MOVE_AMNESIA,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 12275
-            .species = SPECIES_KANGASKHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12277
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12276
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12278
-                MOVE_DIZZY_PUNCH,
-                MOVE_BITE,
-                MOVE_ENDURE,
-                MOVE_REVERSAL,
-            },
-            },
-            {
-#line 12283
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12285
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12284
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12286
-                MOVE_CROSS_CHOP,
-                MOVE_VITAL_THROW,
-                MOVE_REVENGE,
-                MOVE_SEISMIC_TOSS,
-            },
-            },
-            {
-#line 12291
-            .species = SPECIES_URSARING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12293
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12292
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12294
-                MOVE_SLASH,
-                MOVE_FAINT_ATTACK,
-                MOVE_SNORE,
-                MOVE_REST,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_LEROY,
     },
 #line 12299
     [TRAINER_COOLTRAINER_MICHELLE] =
@@ -30185,99 +11334,7 @@
 #line 12307
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12309
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12311
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12310
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12312
-                MOVE_SLASH,
-                MOVE_SCREECH,
-                MOVE_FAINT_ATTACK,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 12317
-            .species = SPECIES_DEWGONG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12319
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12318
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12320
-                MOVE_ICE_BEAM,
-                MOVE_TAKE_DOWN,
-                MOVE_ICY_WIND,
-                MOVE_GROWL,
-            },
-            },
-            {
-#line 12325
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12327
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12326
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12328
-                MOVE_FLAMETHROWER,
-                MOVE_CONFUSE_RAY,
-                MOVE_WILL_O_WISP,
-                MOVE_GRUDGE,
-            },
-            },
-            {
-#line 12333
-            .species = SPECIES_RAPIDASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12335
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12334
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12336
-                MOVE_BOUNCE,
-                MOVE_AGILITY,
-                MOVE_FIRE_SPIN,
-                MOVE_TAKE_DOWN,
-            },
-            },
-            {
-#line 12341
-            .species = SPECIES_GIRAFARIG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12343
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12342
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12344
-                MOVE_CRUNCH,
-                MOVE_PSYBEAM,
-                MOVE_STOMP,
-                MOVE_ODOR_SLEUTH,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_MICHELLE,
     },
 #line 12349
     [TRAINER_COOL_COUPLE_LEX_NYA] =
@@ -30298,45 +11355,7 @@
 #line 12357
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12359
-            .species = SPECIES_MILTANK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12361
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12360
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12362
-                MOVE_BODY_SLAM,
-                MOVE_MILK_DRINK,
-                MOVE_GROWL,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 12367
-            .species = SPECIES_TAUROS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12369
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12368
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12370
-                MOVE_THRASH,
-                MOVE_HORN_ATTACK,
-                MOVE_PURSUIT,
-                MOVE_SWAGGER,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOL_COUPLE_LEX_NYA,
     },
 #line 12375
     [TRAINER_RUIN_MANIAC_BRANDON] =
@@ -30355,20 +11374,7 @@
 #line 12382
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12384
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12386
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12385
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_BRANDON,
     },
 #line 12388
     [TRAINER_RUIN_MANIAC_BENJAMIN] =
@@ -30387,63 +11393,7 @@
 #line 12395
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12397
-            .species = SPECIES_GEODUDE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12399
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12398
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12400
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_BLAST,
-                MOVE_ROLLOUT,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-            {
-#line 12405
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12407
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12406
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12408
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_BLAST,
-                MOVE_ROCK_THROW,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-            {
-#line 12413
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12415
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12414
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12416
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_BLAST,
-                MOVE_ROCK_THROW,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_BENJAMIN,
     },
 #line 12421
     [TRAINER_PAINTER_EDNA] =
@@ -30462,27 +11412,7 @@
 #line 12428
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12430
-            .species = SPECIES_SMEARGLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12432
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 12431
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12433
-                MOVE_FAKE_OUT,
-                MOVE_EXTREME_SPEED,
-                MOVE_PROTECT,
-                MOVE_QUICK_ATTACK,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PAINTER_EDNA,
     },
 #line 12438
     [TRAINER_GENTLEMAN_CLIFFORD] =
@@ -30501,31 +11431,7 @@
 #line 12445
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12447
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12449
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12448
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12451
-            .species = SPECIES_GOLDUCK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12453
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12452
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GENTLEMAN_CLIFFORD,
     },
 #line 12455
     [TRAINER_LADY_SELPHY] =
@@ -30546,49 +11452,7 @@
 #line 12463
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12465
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12465
-            .heldItem = ITEM_NUGGET,
-#line 12467
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12466
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12468
-                MOVE_PAY_DAY,
-                MOVE_BITE,
-                MOVE_TAUNT,
-                MOVE_TORMENT,
-            },
-            },
-            {
-#line 12473
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12473
-            .heldItem = ITEM_NUGGET,
-#line 12475
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12474
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 12476
-                MOVE_PAY_DAY,
-                MOVE_SCRATCH,
-                MOVE_TORMENT,
-                MOVE_TAUNT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_LADY_SELPHY,
     },
 #line 12481
     [TRAINER_RUIN_MANIAC_LAWSON] =
@@ -30607,42 +11471,7 @@
 #line 12488
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12490
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12492
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12491
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12494
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12496
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12495
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12498
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12500
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12499
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_LAWSON,
     },
 #line 12502
     [TRAINER_PSYCHIC_LAURA] =
@@ -30661,42 +11490,7 @@
 #line 12509
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12511
-            .species = SPECIES_NATU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12513
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12512
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12515
-            .species = SPECIES_NATU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12517
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12516
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12519
-            .species = SPECIES_XATU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12521
-            .iv = TRAINER_PARTY_IVS(12, 12, 12, 12, 12, 12),
-#line 12520
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_LAURA,
     },
 #line 12523
     [TRAINER_PKMN_BREEDER_BETHANY] =
@@ -30715,20 +11509,7 @@
 #line 12530
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12532
-            .species = SPECIES_CHANSEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12534
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 12533
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_BREEDER_BETHANY,
     },
 #line 12536
     [TRAINER_PKMN_BREEDER_ALLISON] =
@@ -30747,42 +11528,7 @@
 #line 12543
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12545
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12547
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 12546
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12549
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12551
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 12550
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12553
-            .species = SPECIES_CLEFABLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12555
-            .iv = TRAINER_PARTY_IVS(3, 3, 3, 3, 3, 3),
-#line 12554
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_BREEDER_ALLISON,
     },
 #line 12557
     [TRAINER_BUG_CATCHER_GARRET] =
@@ -30801,20 +11547,7 @@
 #line 12564
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12566
-            .species = SPECIES_HERACROSS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12568
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12567
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_GARRET,
     },
 #line 12570
     [TRAINER_BUG_CATCHER_JONAH] =
@@ -30833,53 +11566,7 @@
 #line 12577
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12579
-            .species = SPECIES_YANMA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12581
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12580
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12583
-            .species = SPECIES_BEEDRILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12585
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12584
-            .lvl = 45,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12587
-            .species = SPECIES_YANMA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12589
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12588
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12591
-            .species = SPECIES_BEEDRILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12593
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12592
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_JONAH,
     },
 #line 12595
     [TRAINER_BUG_CATCHER_VANCE] =
@@ -30898,31 +11585,7 @@
 #line 12602
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12604
-            .species = SPECIES_VENONAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12606
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12605
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12608
-            .species = SPECIES_VENOMOTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12610
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12609
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_VANCE,
     },
 #line 12612
     [TRAINER_YOUNGSTER_NASH] =
@@ -30941,42 +11604,7 @@
 #line 12619
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12621
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12623
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12622
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12625
-            .species = SPECIES_WEEPINBELL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12627
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12626
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12629
-            .species = SPECIES_VICTREEBEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12631
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12630
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_NASH,
     },
 #line 12633
     [TRAINER_YOUNGSTER_CORDELL] =
@@ -30995,31 +11623,7 @@
 #line 12640
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12642
-            .species = SPECIES_FARFETCHD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12644
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12643
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12646
-            .species = SPECIES_FARFETCHD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12648
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12647
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_CORDELL,
     },
 #line 12650
     [TRAINER_LASS_DALIA] =
@@ -31038,53 +11642,7 @@
 #line 12657
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12659
-            .species = SPECIES_HOPPIP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12661
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12660
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12663
-            .species = SPECIES_HOPPIP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12665
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12664
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12667
-            .species = SPECIES_SKIPLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12669
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12668
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12671
-            .species = SPECIES_SKIPLOOM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12673
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12672
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_DALIA,
     },
 #line 12675
     [TRAINER_LASS_JOANA] =
@@ -31103,20 +11661,7 @@
 #line 12682
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12684
-            .species = SPECIES_SNUBBULL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12686
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12685
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_JOANA,
     },
 #line 12688
     [TRAINER_CAMPER_RILEY] =
@@ -31135,31 +11680,7 @@
 #line 12695
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12697
-            .species = SPECIES_PINSIR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12699
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12698
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12701
-            .species = SPECIES_HERACROSS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12703
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12702
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_RILEY,
     },
 #line 12705
     [TRAINER_PICNICKER_MARCY] =
@@ -31178,42 +11699,7 @@
 #line 12712
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12714
-            .species = SPECIES_PARAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12716
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12715
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12718
-            .species = SPECIES_PARAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12720
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12719
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12722
-            .species = SPECIES_PARASECT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12724
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12723
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_MARCY,
     },
 #line 12726
     [TRAINER_RUIN_MANIAC_LAYTON] =
@@ -31232,42 +11718,7 @@
 #line 12733
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12735
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12737
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12736
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12739
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12741
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12740
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12743
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12745
-            .iv = TRAINER_PARTY_IVS(0, 0, 0, 0, 0, 0),
-#line 12744
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_LAYTON,
     },
 #line 12747
     [TRAINER_PICNICKER_KELSEY_2] =
@@ -31286,31 +11737,7 @@
 #line 12754
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12756
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12758
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12757
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12760
-            .species = SPECIES_NIDORAN_F,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12762
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12761
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_KELSEY_2,
     },
 #line 12764
     [TRAINER_PICNICKER_KELSEY_3] =
@@ -31329,31 +11756,7 @@
 #line 12771
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12773
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12775
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12774
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12777
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12779
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12778
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_KELSEY_3,
     },
 #line 12781
     [TRAINER_PICNICKER_KELSEY_4] =
@@ -31372,31 +11775,7 @@
 #line 12788
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12790
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12792
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12791
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12794
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12796
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12795
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_KELSEY_4,
     },
 #line 12798
     [TRAINER_CAMPER_RICKY_2] =
@@ -31415,20 +11794,7 @@
 #line 12805
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12807
-            .species = SPECIES_SQUIRTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12809
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12808
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_RICKY_2,
     },
 #line 12811
     [TRAINER_CAMPER_RICKY_3] =
@@ -31447,20 +11813,7 @@
 #line 12818
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12820
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12822
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12821
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_RICKY_3,
     },
 #line 12824
     [TRAINER_CAMPER_RICKY_4] =
@@ -31479,20 +11832,7 @@
 #line 12831
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12833
-            .species = SPECIES_WARTORTLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12835
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 12834
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_RICKY_4,
     },
 #line 12837
     [TRAINER_CAMPER_JEFF_2] =
@@ -31511,31 +11851,7 @@
 #line 12844
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12846
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12848
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12847
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12850
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12852
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12851
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_JEFF_2,
     },
 #line 12854
     [TRAINER_CAMPER_JEFF_3] =
@@ -31554,31 +11870,7 @@
 #line 12861
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12863
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12865
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12864
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12867
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12869
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12868
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_JEFF_3,
     },
 #line 12871
     [TRAINER_CAMPER_JEFF_4] =
@@ -31597,31 +11889,7 @@
 #line 12878
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12880
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12882
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 12881
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12884
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12886
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 12885
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_JEFF_4,
     },
 #line 12888
     [TRAINER_PICNICKER_ISABELLE_2] =
@@ -31640,42 +11908,7 @@
 #line 12895
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12897
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12899
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12898
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12901
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12903
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12902
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12905
-            .species = SPECIES_PIDGEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12907
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 12906
-            .lvl = 18,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ISABELLE_2,
     },
 #line 12909
     [TRAINER_PICNICKER_ISABELLE_3] =
@@ -31694,42 +11927,7 @@
 #line 12916
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12918
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12920
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12919
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12922
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12924
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12923
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12926
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12928
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 12927
-            .lvl = 26,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ISABELLE_3,
     },
 #line 12930
     [TRAINER_PICNICKER_ISABELLE_4] =
@@ -31748,42 +11946,7 @@
 #line 12937
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12939
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12941
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12940
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12943
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12945
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12944
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12947
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12949
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12948
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ISABELLE_4,
     },
 #line 12951
     [TRAINER_YOUNGSTER_YASU_2] =
@@ -31802,42 +11965,7 @@
 #line 12958
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12960
-            .species = SPECIES_RATTATA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12962
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 12961
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12964
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12966
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 12965
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12968
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12970
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 12969
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_YASU_2,
     },
 #line 12972
     [TRAINER_YOUNGSTER_YASU_3] =
@@ -31856,42 +11984,7 @@
 #line 12979
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 12981
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12983
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12982
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12985
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12987
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12986
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 12989
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 12991
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 12990
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_YASU_3,
     },
 #line 12993
     [TRAINER_ENGINEER_BERNIE_2] =
@@ -31910,42 +12003,7 @@
 #line 13000
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13002
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13004
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13003
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13006
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13008
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13007
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13010
-            .species = SPECIES_MAGNETON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13012
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13011
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ENGINEER_BERNIE_2,
     },
 #line 13014
     [TRAINER_GAMER_DARIAN_2] =
@@ -31964,31 +12022,7 @@
 #line 13021
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13023
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13025
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13024
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13027
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13029
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13028
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_DARIAN_2,
     },
 #line 13031
     [TRAINER_CAMPER_CHRIS_2] =
@@ -32007,31 +12041,7 @@
 #line 13038
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13040
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13042
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13041
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13044
-            .species = SPECIES_CHARMANDER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13046
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13045
-            .lvl = 24,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_CHRIS_2,
     },
 #line 13048
     [TRAINER_CAMPER_CHRIS_3] =
@@ -32050,31 +12060,7 @@
 #line 13055
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13057
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13059
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13058
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13061
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13063
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13062
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_CHRIS_3,
     },
 #line 13065
     [TRAINER_CAMPER_CHRIS_4] =
@@ -32093,31 +12079,7 @@
 #line 13072
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13074
-            .species = SPECIES_ARCANINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13076
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13075
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13078
-            .species = SPECIES_CHARMELEON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13080
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13079
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CAMPER_CHRIS_4,
     },
 #line 13082
     [TRAINER_PICNICKER_ALICIA_2] =
@@ -32136,20 +12098,7 @@
 #line 13089
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13091
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13093
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13092
-            .lvl = 25,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ALICIA_2,
     },
 #line 13095
     [TRAINER_PICNICKER_ALICIA_3] =
@@ -32168,20 +12117,7 @@
 #line 13102
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13104
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13106
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13105
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ALICIA_3,
     },
 #line 13108
     [TRAINER_PICNICKER_ALICIA_4] =
@@ -32200,20 +12136,7 @@
 #line 13115
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13117
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13119
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13118
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_ALICIA_4,
     },
 #line 13121
     [TRAINER_HIKER_JEREMY_2] =
@@ -32232,31 +12155,7 @@
 #line 13128
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13130
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13132
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13131
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13134
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13136
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13135
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_JEREMY_2,
     },
 #line 13138
     [TRAINER_POKEMANIAC_MARK_3] =
@@ -32275,31 +12174,7 @@
 #line 13145
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13147
-            .species = SPECIES_RHYDON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13149
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 13148
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13151
-            .species = SPECIES_LICKITUNG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13153
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 13152
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_MARK_3,
     },
 #line 13155
     [TRAINER_POKEMANIAC_HERMAN_2] =
@@ -32318,31 +12193,7 @@
 #line 13162
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13164
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13166
-            .iv = TRAINER_PARTY_IVS(10, 10, 10, 10, 10, 10),
-#line 13165
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13168
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13170
-            .iv = TRAINER_PARTY_IVS(10, 10, 10, 10, 10, 10),
-#line 13169
-            .lvl = 29,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_HERMAN_2,
     },
 #line 13172
     [TRAINER_POKEMANIAC_HERMAN_3] =
@@ -32361,31 +12212,7 @@
 #line 13179
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13181
-            .species = SPECIES_MAROWAK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13183
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 13182
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13185
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13187
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 13186
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_HERMAN_3,
     },
 #line 13189
     [TRAINER_HIKER_TRENT_2] =
@@ -32404,31 +12231,7 @@
 #line 13196
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13198
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13200
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13199
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13202
-            .species = SPECIES_GRAVELER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13204
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13203
-            .lvl = 31,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_TRENT_2,
     },
 #line 13206
     [TRAINER_LASS_MEGAN_2] =
@@ -32447,64 +12250,7 @@
 #line 13213
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13215
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13217
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13216
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13219
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13221
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13220
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13223
-            .species = SPECIES_NIDORAN_M,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13225
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13224
-            .lvl = 23,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13227
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13229
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13228
-            .lvl = 21,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13231
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13233
-            .iv = TRAINER_PARTY_IVS(4, 4, 4, 4, 4, 4),
-#line 13232
-            .lvl = 22,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_MEGAN_2,
     },
 #line 13235
     [TRAINER_LASS_MEGAN_3] =
@@ -32523,64 +12269,7 @@
 #line 13242
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13244
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13246
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13245
-            .lvl = 46,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13248
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13250
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13249
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13252
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13254
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13253
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13256
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13258
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13257
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13260
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13262
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13261
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_LASS_MEGAN_3,
     },
 #line 13264
     [TRAINER_SUPER_NERD_GLENN_2] =
@@ -32599,42 +12288,7 @@
 #line 13271
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13273
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13275
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13274
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13277
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13279
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13278
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13281
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13283
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13282
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SUPER_NERD_GLENN_2,
     },
 #line 13285
     [TRAINER_GAMER_RICH_2] =
@@ -32653,31 +12307,7 @@
 #line 13292
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13294
-            .species = SPECIES_GROWLITHE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13296
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13295
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13298
-            .species = SPECIES_VULPIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13300
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13299
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_GAMER_RICH_2,
     },
 #line 13302
     [TRAINER_BIKER_JAREN_2] =
@@ -32696,31 +12326,7 @@
 #line 13309
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13311
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13313
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13312
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13315
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13317
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13316
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_JAREN_2,
     },
 #line 13319
     [TRAINER_FISHERMAN_ELLIOT_2] =
@@ -32739,53 +12345,7 @@
 #line 13326
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13328
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13330
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13329
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13332
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13334
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13333
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13336
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13338
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13337
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13340
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13342
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13341
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_ELLIOT_2,
     },
 #line 13344
     [TRAINER_ROCKER_LUCA_2] =
@@ -32804,31 +12364,7 @@
 #line 13351
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13353
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13355
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13354
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13357
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13359
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13358
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_ROCKER_LUCA_2,
     },
 #line 13361
     [TRAINER_BEAUTY_SHEILA_2] =
@@ -32847,31 +12383,7 @@
 #line 13368
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13370
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13372
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13371
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13374
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13376
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13375
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_SHEILA_2,
     },
 #line 13378
     [TRAINER_BIRD_KEEPER_ROBERT_2] =
@@ -32890,53 +12402,7 @@
 #line 13385
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13387
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13389
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13388
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13391
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13393
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13392
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13395
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13397
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13396
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13399
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13401
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13400
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_ROBERT_2,
     },
 #line 13403
     [TRAINER_BIRD_KEEPER_ROBERT_3] =
@@ -32954,54 +12420,8 @@
         .doubleBattle = FALSE,
 #line 13410
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
-        .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13412
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13414
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13413
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13416
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13418
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13417
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13420
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13422
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13421
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13424
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13426
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13425
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .partySize = 4,
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_ROBERT_3,
     },
 #line 13428
     [TRAINER_PICNICKER_SUSIE_2] =
@@ -33020,64 +12440,7 @@
 #line 13435
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13437
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13439
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13438
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13441
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13443
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13442
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13445
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13447
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13446
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13449
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13451
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13450
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13453
-            .species = SPECIES_MEOWTH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13455
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13454
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_SUSIE_2,
     },
 #line 13457
     [TRAINER_PICNICKER_SUSIE_3] =
@@ -33096,64 +12459,7 @@
 #line 13464
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13466
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13468
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13467
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13470
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13472
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13471
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13474
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13476
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13475
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13478
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13480
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13479
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13482
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13484
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13483
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_SUSIE_3,
     },
 #line 13486
     [TRAINER_PICNICKER_SUSIE_4] =
@@ -33172,64 +12478,7 @@
 #line 13493
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13495
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13497
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13496
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13499
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13501
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13500
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13503
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13505
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13504
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13507
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13509
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13508
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13511
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13513
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13512
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_SUSIE_4,
     },
 #line 13515
     [TRAINER_BIKER_LUKAS_2] =
@@ -33248,53 +12497,7 @@
 #line 13522
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13524
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13526
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13525
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13528
-            .species = SPECIES_KOFFING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13530
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13529
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13532
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13534
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13533
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13536
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13538
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13537
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_LUKAS_2,
     },
 #line 13540
     [TRAINER_BIRD_KEEPER_BENNY_2] =
@@ -33313,31 +12516,7 @@
 #line 13547
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13549
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13551
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13550
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13553
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13555
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13554
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_BENNY_2,
     },
 #line 13557
     [TRAINER_BIRD_KEEPER_BENNY_3] =
@@ -33356,31 +12535,7 @@
 #line 13564
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13566
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13568
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13567
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13570
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13572
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13571
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_BENNY_3,
     },
 #line 13574
     [TRAINER_BIRD_KEEPER_MARLON_2] =
@@ -33399,42 +12554,7 @@
 #line 13581
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13583
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13585
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13584
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13587
-            .species = SPECIES_DODUO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13589
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13588
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13591
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13593
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13592
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_MARLON_2,
     },
 #line 13595
     [TRAINER_BIRD_KEEPER_MARLON_3] =
@@ -33453,42 +12573,7 @@
 #line 13602
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13604
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13606
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13605
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13608
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13610
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13609
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13612
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13614
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13613
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_MARLON_3,
     },
 #line 13616
     [TRAINER_BEAUTY_GRACE_2] =
@@ -33507,31 +12592,7 @@
 #line 13623
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13625
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13627
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13626
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13629
-            .species = SPECIES_WIGGLYTUFF,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13631
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13630
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BEAUTY_GRACE_2,
     },
 #line 13633
     [TRAINER_BIRD_KEEPER_CHESTER_2] =
@@ -33550,42 +12611,7 @@
 #line 13640
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13642
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13644
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13643
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13646
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13648
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13647
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13650
-            .species = SPECIES_DODUO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13652
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13651
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_CHESTER_2,
     },
 #line 13654
     [TRAINER_BIRD_KEEPER_CHESTER_3] =
@@ -33604,42 +12630,7 @@
 #line 13661
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13663
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13665
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13664
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13667
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13669
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13668
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13671
-            .species = SPECIES_DODRIO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13673
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13672
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_CHESTER_3,
     },
 #line 13675
     [TRAINER_PICNICKER_BECKY_2] =
@@ -33658,31 +12649,7 @@
 #line 13682
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13684
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13686
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13685
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13688
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13690
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13689
-            .lvl = 32,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_BECKY_2,
     },
 #line 13692
     [TRAINER_PICNICKER_BECKY_3] =
@@ -33701,31 +12668,7 @@
 #line 13699
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13701
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13703
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13702
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13705
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13707
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13706
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_BECKY_3,
     },
 #line 13709
     [TRAINER_PICNICKER_BECKY_4] =
@@ -33744,31 +12687,7 @@
 #line 13716
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13718
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13720
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13719
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13722
-            .species = SPECIES_RAICHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13724
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13723
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_BECKY_4,
     },
 #line 13726
     [TRAINER_CRUSH_KIN_RON_MYA_2] =
@@ -33787,35 +12706,7 @@
 #line 13733
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13735
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13735
-            .heldItem = ITEM_BLACK_BELT,
-#line 13737
-            .iv = TRAINER_PARTY_IVS(13, 13, 13, 13, 13, 13),
-#line 13736
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13739
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13739
-            .heldItem = ITEM_BLACK_BELT,
-#line 13741
-            .iv = TRAINER_PARTY_IVS(13, 13, 13, 13, 13, 13),
-#line 13740
-            .lvl = 33,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA_2,
     },
 #line 13743
     [TRAINER_CRUSH_KIN_RON_MYA_3] =
@@ -33834,35 +12725,7 @@
 #line 13750
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13752
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13752
-            .heldItem = ITEM_BLACK_BELT,
-#line 13754
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 13753
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13756
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13756
-            .heldItem = ITEM_BLACK_BELT,
-#line 13758
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 13757
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA_3,
     },
 #line 13760
     [TRAINER_CRUSH_KIN_RON_MYA_4] =
@@ -33881,35 +12744,7 @@
 #line 13767
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13769
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13769
-            .heldItem = ITEM_BLACK_BELT,
-#line 13771
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 13770
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13773
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13773
-            .heldItem = ITEM_BLACK_BELT,
-#line 13775
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 13774
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_KIN_RON_MYA_4,
     },
 #line 13777
     [TRAINER_BIKER_RUBEN_2] =
@@ -33928,42 +12763,7 @@
 #line 13784
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13786
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13788
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13787
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13790
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13792
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13791
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13794
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13796
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13795
-            .lvl = 48,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_RUBEN_2,
     },
 #line 13798
     [TRAINER_CUE_BALL_CAMRON_2] =
@@ -33982,31 +12782,7 @@
 #line 13805
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13807
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13809
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13808
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13811
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13813
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13812
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_CAMRON_2,
     },
 #line 13815
     [TRAINER_BIKER_JAXON_2] =
@@ -34025,31 +12801,7 @@
 #line 13822
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13824
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13826
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13825
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13828
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13830
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13829
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIKER_JAXON_2,
     },
 #line 13832
     [TRAINER_CUE_BALL_ISAIAH_2] =
@@ -34068,31 +12820,7 @@
 #line 13839
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13841
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13843
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13842
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13845
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13847
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13846
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_ISAIAH_2,
     },
 #line 13849
     [TRAINER_CUE_BALL_COREY_2] =
@@ -34111,31 +12839,7 @@
 #line 13856
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13858
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13860
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13859
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13862
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13864
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13863
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_COREY_2,
     },
 #line 13866
     [TRAINER_BIRD_KEEPER_JACOB_2] =
@@ -34154,53 +12858,7 @@
 #line 13873
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13875
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13877
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13876
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13879
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13881
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13880
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13883
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13885
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13884
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13887
-            .species = SPECIES_SPEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13889
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 13888
-            .lvl = 28,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_JACOB_2,
     },
 #line 13891
     [TRAINER_BIRD_KEEPER_JACOB_3] =
@@ -34219,53 +12877,7 @@
 #line 13898
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13900
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13902
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13901
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13904
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13906
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13905
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13908
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13910
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13909
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13912
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13914
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13913
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_JACOB_3,
     },
 #line 13916
     [TRAINER_SWIMMER_FEMALE_ALICE_2] =
@@ -34284,31 +12896,7 @@
 #line 13923
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13925
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13927
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13926
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13929
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13931
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13930
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_ALICE_2,
     },
 #line 13933
     [TRAINER_SWIMMER_MALE_DARRIN_2] =
@@ -34327,53 +12915,7 @@
 #line 13940
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13942
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13944
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13943
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13946
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13948
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13947
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13950
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13952
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13951
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13954
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13956
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13955
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_DARRIN_2,
     },
 #line 13958
     [TRAINER_PICNICKER_MISSY_2] =
@@ -34392,31 +12934,7 @@
 #line 13965
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13967
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13969
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13968
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13971
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13973
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 13972
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_MISSY_2,
     },
 #line 13975
     [TRAINER_PICNICKER_MISSY_3] =
@@ -34435,31 +12953,7 @@
 #line 13982
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 13984
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13986
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13985
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 13988
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 13990
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 13989
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PICNICKER_MISSY_3,
     },
 #line 13992
     [TRAINER_FISHERMAN_WADE_2] =
@@ -34478,75 +12972,7 @@
 #line 13999
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14001
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14003
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14002
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14005
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14007
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14006
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14009
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14011
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14010
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14013
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14015
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14014
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14017
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14019
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14018
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14021
-            .species = SPECIES_MAGIKARP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14023
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14022
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_FISHERMAN_WADE_2,
     },
 #line 14025
     [TRAINER_SWIMMER_MALE_JACK_2] =
@@ -34565,20 +12991,7 @@
 #line 14032
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14034
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14036
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14035
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_JACK_2,
     },
 #line 14038
     [TRAINER_SIS_AND_BRO_LIL_IAN_2] =
@@ -34597,31 +13010,7 @@
 #line 14045
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14047
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14049
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14048
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14051
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14053
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14052
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SIS_AND_BRO_LIL_IAN_2,
     },
 #line 14055
     [TRAINER_SIS_AND_BRO_LIL_IAN_3] =
@@ -34640,31 +13029,7 @@
 #line 14062
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14064
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14066
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14065
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14068
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14070
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14069
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SIS_AND_BRO_LIL_IAN_3,
     },
 #line 14072
     [TRAINER_SWIMMER_MALE_FINN_2] =
@@ -34683,20 +13048,7 @@
 #line 14079
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14081
-            .species = SPECIES_STARMIE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14083
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14082
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_FINN_2,
     },
 #line 14085
     [TRAINER_CRUSH_GIRL_SHARON_2] =
@@ -34715,35 +13067,7 @@
 #line 14092
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14094
-            .species = SPECIES_MANKEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14094
-            .heldItem = ITEM_BLACK_BELT,
-#line 14096
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 14095
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14098
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14098
-            .heldItem = ITEM_BLACK_BELT,
-#line 14100
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 14099
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_SHARON_2,
     },
 #line 14102
     [TRAINER_CRUSH_GIRL_SHARON_3] =
@@ -34762,35 +13086,7 @@
 #line 14109
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14111
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14111
-            .heldItem = ITEM_BLACK_BELT,
-#line 14113
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14112
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14115
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14115
-            .heldItem = ITEM_BLACK_BELT,
-#line 14117
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14116
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_SHARON_3,
     },
 #line 14119
     [TRAINER_CRUSH_GIRL_TANYA_2] =
@@ -34809,35 +13105,7 @@
 #line 14126
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14128
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14128
-            .heldItem = ITEM_BLACK_BELT,
-#line 14130
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 14129
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14132
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14132
-            .heldItem = ITEM_BLACK_BELT,
-#line 14134
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 14133
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_TANYA_2,
     },
 #line 14136
     [TRAINER_CRUSH_GIRL_TANYA_3] =
@@ -34856,35 +13124,7 @@
 #line 14143
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14145
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14145
-            .heldItem = ITEM_BLACK_BELT,
-#line 14147
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14146
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14149
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14149
-            .heldItem = ITEM_BLACK_BELT,
-#line 14151
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14150
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_TANYA_3,
     },
 #line 14153
     [TRAINER_BLACK_BELT_SHEA_2] =
@@ -34903,35 +13143,7 @@
 #line 14160
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14162
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14162
-            .heldItem = ITEM_BLACK_BELT,
-#line 14164
-            .iv = TRAINER_PARTY_IVS(21, 21, 21, 21, 21, 21),
-#line 14163
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14166
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14166
-            .heldItem = ITEM_BLACK_BELT,
-#line 14168
-            .iv = TRAINER_PARTY_IVS(21, 21, 21, 21, 21, 21),
-#line 14167
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_SHEA_2,
     },
 #line 14170
     [TRAINER_BLACK_BELT_SHEA_3] =
@@ -34950,35 +13162,7 @@
 #line 14177
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14179
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14179
-            .heldItem = ITEM_BLACK_BELT,
-#line 14181
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14180
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14183
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14183
-            .heldItem = ITEM_BLACK_BELT,
-#line 14185
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14184
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_SHEA_3,
     },
 #line 14187
     [TRAINER_BLACK_BELT_HUGH_2] =
@@ -34997,35 +13181,7 @@
 #line 14194
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14196
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14196
-            .heldItem = ITEM_BLACK_BELT,
-#line 14198
-            .iv = TRAINER_PARTY_IVS(21, 21, 21, 21, 21, 21),
-#line 14197
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14200
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14200
-            .heldItem = ITEM_BLACK_BELT,
-#line 14202
-            .iv = TRAINER_PARTY_IVS(21, 21, 21, 21, 21, 21),
-#line 14201
-            .lvl = 50,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_HUGH_2,
     },
 #line 14204
     [TRAINER_BLACK_BELT_HUGH_3] =
@@ -35044,35 +13200,7 @@
 #line 14211
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14213
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14213
-            .heldItem = ITEM_BLACK_BELT,
-#line 14215
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14214
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14217
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14217
-            .heldItem = ITEM_BLACK_BELT,
-#line 14219
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14218
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BLACK_BELT_HUGH_3,
     },
 #line 14221
     [TRAINER_CRUSH_KIN_MIK_KIA_2] =
@@ -35091,35 +13219,7 @@
 #line 14228
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14230
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14230
-            .heldItem = ITEM_BLACK_BELT,
-#line 14232
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 14231
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14234
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14234
-            .heldItem = ITEM_BLACK_BELT,
-#line 14236
-            .iv = TRAINER_PARTY_IVS(15, 15, 15, 15, 15, 15),
-#line 14235
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_KIN_MIK_KIA_2,
     },
 #line 14238
     [TRAINER_CRUSH_KIN_MIK_KIA_3] =
@@ -35138,35 +13238,7 @@
 #line 14245
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14247
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14247
-            .heldItem = ITEM_BLACK_BELT,
-#line 14249
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14248
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14251
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14251
-            .heldItem = ITEM_BLACK_BELT,
-#line 14253
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14252
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_KIN_MIK_KIA_3,
     },
 #line 14255
     [TRAINER_TUBER_AMIRA_2] =
@@ -35185,42 +13257,7 @@
 #line 14262
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14264
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14266
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14265
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14268
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14270
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14269
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14272
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14274
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14273
-            .lvl = 47,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TUBER_AMIRA_2,
     },
 #line 14276
     [TRAINER_TWINS_JOY_MEG_2] =
@@ -35239,31 +13276,7 @@
 #line 14283
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14285
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14287
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14286
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14289
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14291
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14290
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TWINS_JOY_MEG_2,
     },
 #line 14293
     [TRAINER_PAINTER_RAYNA_2] =
@@ -35282,27 +13295,7 @@
 #line 14300
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14302
-            .species = SPECIES_SMEARGLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14304
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14303
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14305
-                MOVE_CROSS_CHOP,
-                MOVE_MEGAHORN,
-                MOVE_DOUBLE_EDGE,
-                MOVE_SELF_DESTRUCT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PAINTER_RAYNA_2,
     },
 #line 14310
     [TRAINER_YOUNGSTER_DESTIN_2] =
@@ -35321,31 +13314,7 @@
 #line 14317
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14319
-            .species = SPECIES_RATICATE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14321
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14320
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14323
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14325
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14324
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNGSTER_DESTIN_2,
     },
 #line 14327
     [TRAINER_PKMN_BREEDER_ALIZE_2] =
@@ -35364,42 +13333,7 @@
 #line 14334
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14336
-            .species = SPECIES_PIKACHU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14338
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 14337
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14340
-            .species = SPECIES_CLEFAIRY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14342
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 14341
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14344
-            .species = SPECIES_MARILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14346
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 14345
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_BREEDER_ALIZE_2,
     },
 #line 14348
     [TRAINER_YOUNG_COUPLE_GIA_JES_2] =
@@ -35418,31 +13352,7 @@
 #line 14355
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14357
-            .species = SPECIES_NIDORINA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14359
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 14358
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14361
-            .species = SPECIES_NIDORINO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14363
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 14362
-            .lvl = 30,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNG_COUPLE_GIA_JES_2,
     },
 #line 14365
     [TRAINER_YOUNG_COUPLE_GIA_JES_3] =
@@ -35461,31 +13371,7 @@
 #line 14372
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14374
-            .species = SPECIES_NIDOKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14376
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14375
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14378
-            .species = SPECIES_NIDOQUEEN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14380
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14379
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_YOUNG_COUPLE_GIA_JES_3,
     },
 #line 14382
     [TRAINER_BIRD_KEEPER_MILO_2] =
@@ -35504,31 +13390,7 @@
 #line 14389
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14391
-            .species = SPECIES_PIDGEOTTO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14393
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14392
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14395
-            .species = SPECIES_PIDGEOT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14397
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14396
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_MILO_2,
     },
 #line 14399
     [TRAINER_BIRD_KEEPER_CHAZ_2] =
@@ -35547,31 +13409,7 @@
 #line 14406
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14408
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14410
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14409
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14412
-            .species = SPECIES_FEAROW,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14414
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14413
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_CHAZ_2,
     },
 #line 14416
     [TRAINER_BIRD_KEEPER_HAROLD_2] =
@@ -35590,31 +13428,7 @@
 #line 14423
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14425
-            .species = SPECIES_NOCTOWL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14427
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14426
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14429
-            .species = SPECIES_NOCTOWL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14431
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14430
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BIRD_KEEPER_HAROLD_2,
     },
 #line 14433
     [TRAINER_SWIMMER_FEMALE_NICOLE_2] =
@@ -35633,20 +13447,7 @@
 #line 14440
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14442
-            .species = SPECIES_MARILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14444
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14443
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_NICOLE_2,
     },
 #line 14446
     [TRAINER_PSYCHIC_JACLYN_2] =
@@ -35665,63 +13466,7 @@
 #line 14453
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14455
-            .species = SPECIES_NATU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14457
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14456
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14458
-                MOVE_PSYCHIC,
-                MOVE_CONFUSE_RAY,
-                MOVE_FUTURE_SIGHT,
-                MOVE_WISH,
-            },
-            },
-            {
-#line 14463
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14465
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14464
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14466
-                MOVE_PSYCHIC,
-                MOVE_HEADBUTT,
-                MOVE_AMNESIA,
-                MOVE_YAWN,
-            },
-            },
-            {
-#line 14471
-            .species = SPECIES_KADABRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14473
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14472
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14474
-                MOVE_PSYCHIC,
-                MOVE_FUTURE_SIGHT,
-                MOVE_RECOVER,
-                MOVE_REFLECT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_JACLYN_2,
     },
 #line 14479
     [TRAINER_SWIMMER_MALE_SAMIR_2] =
@@ -35740,20 +13485,7 @@
 #line 14486
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14488
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14490
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14489
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_SAMIR_2,
     },
 #line 14492
     [TRAINER_HIKER_EARL_2] =
@@ -35772,31 +13504,7 @@
 #line 14499
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14501
-            .species = SPECIES_ONIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14503
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14502
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14505
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14507
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14506
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_HIKER_EARL_2,
     },
 #line 14509
     [TRAINER_RUIN_MANIAC_LARRY_2] =
@@ -35815,31 +13523,7 @@
 #line 14516
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14518
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14520
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14519
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14522
-            .species = SPECIES_MACHOKE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14524
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14523
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_RUIN_MANIAC_LARRY_2,
     },
 #line 14526
     [TRAINER_POKEMANIAC_HECTOR_2] =
@@ -35858,31 +13542,7 @@
 #line 14533
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14535
-            .species = SPECIES_RHYDON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14537
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 14536
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14539
-            .species = SPECIES_KANGASKHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14541
-            .iv = TRAINER_PARTY_IVS(18, 18, 18, 18, 18, 18),
-#line 14540
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_POKEMANIAC_HECTOR_2,
     },
 #line 14543
     [TRAINER_PSYCHIC_DARIO_2] =
@@ -35901,27 +13561,7 @@
 #line 14550
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14552
-            .species = SPECIES_GIRAFARIG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14554
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14553
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14555
-                MOVE_CRUNCH,
-                MOVE_PSYBEAM,
-                MOVE_ODOR_SLEUTH,
-                MOVE_AGILITY,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_DARIO_2,
     },
 #line 14560
     [TRAINER_PSYCHIC_RODETTE_2] =
@@ -35940,63 +13580,7 @@
 #line 14567
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14569
-            .species = SPECIES_NATU,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14571
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14570
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14572
-                MOVE_PSYCHIC,
-                MOVE_CONFUSE_RAY,
-                MOVE_WISH,
-                MOVE_FUTURE_SIGHT,
-            },
-            },
-            {
-#line 14577
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14579
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14578
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14580
-                MOVE_PSYCHIC,
-                MOVE_DISABLE,
-                MOVE_PSYCH_UP,
-                MOVE_FUTURE_SIGHT,
-            },
-            },
-            {
-#line 14585
-            .species = SPECIES_HYPNO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14587
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14586
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14588
-                MOVE_PSYCHIC,
-                MOVE_HYPNOSIS,
-                MOVE_PSYCH_UP,
-                MOVE_FUTURE_SIGHT,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PSYCHIC_RODETTE_2,
     },
 #line 14593
     [TRAINER_JUGGLER_MASON_2] =
@@ -36015,53 +13599,7 @@
 #line 14600
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 4,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14602
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14604
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14603
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14606
-            .species = SPECIES_PINECO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14608
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14607
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14610
-            .species = SPECIES_ELECTRODE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14612
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14611
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14614
-            .species = SPECIES_PINECO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14616
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14615
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_JUGGLER_MASON_2,
     },
 #line 14618
     [TRAINER_PKMN_RANGER_NICOLAS_2] =
@@ -36082,45 +13620,7 @@
 #line 14626
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14628
-            .species = SPECIES_VICTREEBEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14630
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14629
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14631
-                MOVE_RAZOR_LEAF,
-                MOVE_ACID,
-                MOVE_STUN_SPORE,
-                MOVE_WRAP,
-            },
-            },
-            {
-#line 14636
-            .species = SPECIES_VICTREEBEL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14638
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14637
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14639
-                MOVE_RAZOR_LEAF,
-                MOVE_ACID,
-                MOVE_SLEEP_POWDER,
-                MOVE_SLAM,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_NICOLAS_2,
     },
 #line 14644
     [TRAINER_PKMN_RANGER_MADELINE_2] =
@@ -36141,45 +13641,7 @@
 #line 14652
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14654
-            .species = SPECIES_VILEPLUME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14656
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14655
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14657
-                MOVE_PETAL_DANCE,
-                MOVE_MOONLIGHT,
-                MOVE_ACID,
-                MOVE_SLEEP_POWDER,
-            },
-            },
-            {
-#line 14662
-            .species = SPECIES_VILEPLUME,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14664
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14663
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14665
-                MOVE_PETAL_DANCE,
-                MOVE_MOONLIGHT,
-                MOVE_ACID,
-                MOVE_STUN_SPORE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_MADELINE_2,
     },
 #line 14670
     [TRAINER_CRUSH_GIRL_CYNDY_2] =
@@ -36198,48 +13660,7 @@
 #line 14677
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14679
-            .species = SPECIES_PRIMEAPE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14679
-            .heldItem = ITEM_BLACK_BELT,
-#line 14681
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14680
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14683
-            .species = SPECIES_HITMONTOP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14683
-            .heldItem = ITEM_BLACK_BELT,
-#line 14685
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14684
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14687
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14687
-            .heldItem = ITEM_BLACK_BELT,
-#line 14689
-            .iv = TRAINER_PARTY_IVS(20, 20, 20, 20, 20, 20),
-#line 14688
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CRUSH_GIRL_CYNDY_2,
     },
 #line 14691
     [TRAINER_TAMER_EVAN_2] =
@@ -36258,42 +13679,7 @@
 #line 14698
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14700
-            .species = SPECIES_SANDSLASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14702
-            .iv = TRAINER_PARTY_IVS(19, 19, 19, 19, 19, 19),
-#line 14701
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14704
-            .species = SPECIES_LICKITUNG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14706
-            .iv = TRAINER_PARTY_IVS(19, 19, 19, 19, 19, 19),
-#line 14705
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14708
-            .species = SPECIES_URSARING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14710
-            .iv = TRAINER_PARTY_IVS(19, 19, 19, 19, 19, 19),
-#line 14709
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_TAMER_EVAN_2,
     },
 #line 14712
     [TRAINER_PKMN_RANGER_JACKSON_2] =
@@ -36314,63 +13700,7 @@
 #line 14720
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14722
-            .species = SPECIES_TANGELA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14724
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14723
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14725
-                MOVE_SLAM,
-                MOVE_MEGA_DRAIN,
-                MOVE_BIND,
-                MOVE_INGRAIN,
-            },
-            },
-            {
-#line 14730
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14732
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14731
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14733
-                MOVE_CONFUSION,
-                MOVE_EGG_BOMB,
-                MOVE_STUN_SPORE,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 14738
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14740
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14739
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14741
-                MOVE_CONFUSION,
-                MOVE_EGG_BOMB,
-                MOVE_SLEEP_POWDER,
-                MOVE_STOMP,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_JACKSON_2,
     },
 #line 14746
     [TRAINER_PKMN_RANGER_KATELYN_2] =
@@ -36391,27 +13721,7 @@
 #line 14754
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 1,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14756
-            .species = SPECIES_CHANSEY,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14758
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14757
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14759
-                MOVE_EGG_BOMB,
-                MOVE_DEFENSE_CURL,
-                MOVE_MINIMIZE,
-                MOVE_SOFT_BOILED,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_PKMN_RANGER_KATELYN_2,
     },
 #line 14764
     [TRAINER_COOLTRAINER_LEROY_2] =
@@ -36432,99 +13742,7 @@
 #line 14772
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14774
-            .species = SPECIES_RHYDON,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14776
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14775
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14777
-                MOVE_EARTHQUAKE,
-                MOVE_HORN_DRILL,
-                MOVE_ROCK_BLAST,
-                MOVE_SCARY_FACE,
-            },
-            },
-            {
-#line 14782
-            .species = SPECIES_SLOWBRO,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14784
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14783
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14785
-                MOVE_PSYCHIC,
-                MOVE_HEADBUTT,
-                MOVE_AMNESIA,
-                MOVE_DISABLE,
-            },
-            },
-            {
-#line 14790
-            .species = SPECIES_KANGASKHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14792
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14791
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14793
-                MOVE_DIZZY_PUNCH,
-                MOVE_BITE,
-                MOVE_ENDURE,
-                MOVE_REVERSAL,
-            },
-            },
-            {
-#line 14798
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14800
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14799
-            .lvl = 52,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14801
-                MOVE_CROSS_CHOP,
-                MOVE_VITAL_THROW,
-                MOVE_REVENGE,
-                MOVE_SEISMIC_TOSS,
-            },
-            },
-            {
-#line 14806
-            .species = SPECIES_URSARING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14808
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14807
-            .lvl = 55,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14809
-                MOVE_SLASH,
-                MOVE_FAINT_ATTACK,
-                MOVE_SNORE,
-                MOVE_REST,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_LEROY_2,
     },
 #line 14814
     [TRAINER_COOLTRAINER_MICHELLE_2] =
@@ -36545,99 +13763,7 @@
 #line 14822
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14824
-            .species = SPECIES_PERSIAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14826
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14825
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14827
-                MOVE_SLASH,
-                MOVE_SCREECH,
-                MOVE_FAINT_ATTACK,
-                MOVE_BITE,
-            },
-            },
-            {
-#line 14832
-            .species = SPECIES_DEWGONG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14834
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14833
-            .lvl = 53,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14835
-                MOVE_ICE_BEAM,
-                MOVE_TAKE_DOWN,
-                MOVE_ICY_WIND,
-                MOVE_SHEER_COLD,
-            },
-            },
-            {
-#line 14840
-            .species = SPECIES_NINETALES,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14842
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14841
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14843
-                MOVE_FLAMETHROWER,
-                MOVE_CONFUSE_RAY,
-                MOVE_WILL_O_WISP,
-                MOVE_GRUDGE,
-            },
-            },
-            {
-#line 14848
-            .species = SPECIES_RAPIDASH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14850
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14849
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14851
-                MOVE_BOUNCE,
-                MOVE_AGILITY,
-                MOVE_FIRE_SPIN,
-                MOVE_TAKE_DOWN,
-            },
-            },
-            {
-#line 14856
-            .species = SPECIES_GIRAFARIG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14858
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14857
-            .lvl = 56,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14859
-                MOVE_CRUNCH,
-                MOVE_PSYBEAM,
-                MOVE_STOMP,
-                MOVE_ODOR_SLEUTH,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOLTRAINER_MICHELLE_2,
     },
 #line 14864
     [TRAINER_COOL_COUPLE_LEX_NYA_2] =
@@ -36658,45 +13784,7 @@
 #line 14872
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_TRY_TO_FAINT | AI_FLAG_CHECK_VIABILITY,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14874
-            .species = SPECIES_MILTANK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14876
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14875
-            .lvl = 57,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14877
-                MOVE_BODY_SLAM,
-                MOVE_MILK_DRINK,
-                MOVE_GROWL,
-                MOVE_DEFENSE_CURL,
-            },
-            },
-            {
-#line 14882
-            .species = SPECIES_TAUROS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14884
-            .iv = TRAINER_PARTY_IVS(26, 26, 26, 26, 26, 26),
-#line 14883
-            .lvl = 57,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 14885
-                MOVE_TAKE_DOWN,
-                MOVE_SCARY_FACE,
-                MOVE_PURSUIT,
-                MOVE_SWAGGER,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_COOL_COUPLE_LEX_NYA_2,
     },
 #line 14890
     [TRAINER_BUG_CATCHER_COLTON_2] =
@@ -36715,42 +13803,7 @@
 #line 14897
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14899
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14901
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 14900
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14903
-            .species = SPECIES_WEEDLE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14905
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 14904
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14907
-            .species = SPECIES_METAPOD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14909
-            .iv = TRAINER_PARTY_IVS(2, 2, 2, 2, 2, 2),
-#line 14908
-            .lvl = 19,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_COLTON_2,
     },
 #line 14911
     [TRAINER_BUG_CATCHER_COLTON_3] =
@@ -36769,42 +13822,7 @@
 #line 14918
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14920
-            .species = SPECIES_BUTTERFREE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14922
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 14921
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14924
-            .species = SPECIES_KAKUNA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14926
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 14925
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14928
-            .species = SPECIES_BUTTERFREE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14930
-            .iv = TRAINER_PARTY_IVS(7, 7, 7, 7, 7, 7),
-#line 14929
-            .lvl = 27,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_COLTON_3,
     },
 #line 14932
     [TRAINER_BUG_CATCHER_COLTON_4] =
@@ -36823,42 +13841,7 @@
 #line 14939
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 3,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14941
-            .species = SPECIES_BUTTERFREE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14943
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14942
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14945
-            .species = SPECIES_BEEDRILL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14947
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14946
-            .lvl = 54,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14949
-            .species = SPECIES_BUTTERFREE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14951
-            .iv = TRAINER_PARTY_IVS(14, 14, 14, 14, 14, 14),
-#line 14950
-            .lvl = 51,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_BUG_CATCHER_COLTON_4,
     },
 #line 14953
     [TRAINER_SWIMMER_MALE_MATTHEW_2] =
@@ -36877,31 +13860,7 @@
 #line 14960
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14962
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14964
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14963
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14966
-            .species = SPECIES_POLIWRATH,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14968
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14967
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_MATTHEW_2,
     },
 #line 14970
     [TRAINER_SWIMMER_MALE_TONY_2] =
@@ -36920,31 +13879,7 @@
 #line 14977
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14979
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14981
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14980
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 14983
-            .species = SPECIES_SEADRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14985
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14984
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_MALE_TONY_2,
     },
 #line 14987
     [TRAINER_SWIMMER_FEMALE_MELISSA_2] =
@@ -36963,31 +13898,7 @@
 #line 14994
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 14996
-            .species = SPECIES_POLIWHIRL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 14998
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 14997
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 15000
-            .species = SPECIES_SEAKING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15002
-            .iv = TRAINER_PARTY_IVS(9, 9, 9, 9, 9, 9),
-#line 15001
-            .lvl = 49,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_SWIMMER_FEMALE_MELISSA_2,
     },
 #line 15004
     [TRAINER_ELITE_FOUR_LORELEI_2] =
@@ -37011,101 +13922,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_PURPLE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15015
-            .species = SPECIES_DEWGONG,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15017
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15016
-            .lvl = 64,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15018
-                MOVE_ICE_BEAM,
-                MOVE_SURF,
-                MOVE_SIGNAL_BEAM,
-                MOVE_DOUBLE_TEAM,
-            },
-            },
-            {
-#line 15023
-            .species = SPECIES_CLOYSTER,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15025
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15024
-            .lvl = 63,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15026
-                MOVE_ICE_BEAM,
-                MOVE_SURF,
-                MOVE_SUPERSONIC,
-                MOVE_RAIN_DANCE,
-            },
-            },
-            {
-#line 15031
-            .species = SPECIES_PILOSWINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15033
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15032
-            .lvl = 63,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15034
-                MOVE_BLIZZARD,
-                MOVE_EARTHQUAKE,
-                MOVE_DOUBLE_EDGE,
-                MOVE_ROCK_SLIDE,
-            },
-            },
-            {
-#line 15039
-            .species = SPECIES_JYNX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15041
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15040
-            .lvl = 66,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15042
-                MOVE_ICE_BEAM,
-                MOVE_PSYCHIC,
-                MOVE_LOVELY_KISS,
-                MOVE_ATTRACT,
-            },
-            },
-            {
-#line 15047
-            .species = SPECIES_LAPRAS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15047
-            .heldItem = ITEM_CHERI_BERRY,
-#line 15049
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15048
-            .lvl = 66,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15050
-                MOVE_ICE_BEAM,
-                MOVE_SURF,
-                MOVE_PSYCHIC,
-                MOVE_THUNDER,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_LORELEI_2,
     },
 #line 15055
     [TRAINER_ELITE_FOUR_BRUNO_2] =
@@ -37129,101 +13946,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_GREEN,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15066
-            .species = SPECIES_STEELIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15068
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15067
-            .lvl = 65,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15069
-                MOVE_EARTHQUAKE,
-                MOVE_IRON_TAIL,
-                MOVE_CRUNCH,
-                MOVE_ROCK_TOMB,
-            },
-            },
-            {
-#line 15074
-            .species = SPECIES_HITMONCHAN,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15076
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15075
-            .lvl = 65,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15077
-                MOVE_SKY_UPPERCUT,
-                MOVE_MACH_PUNCH,
-                MOVE_ROCK_SLIDE,
-                MOVE_COUNTER,
-            },
-            },
-            {
-#line 15082
-            .species = SPECIES_HITMONLEE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15084
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15083
-            .lvl = 65,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15085
-                MOVE_MEGA_KICK,
-                MOVE_FORESIGHT,
-                MOVE_EARTHQUAKE,
-                MOVE_ROCK_SLIDE,
-            },
-            },
-            {
-#line 15090
-            .species = SPECIES_STEELIX,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15092
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15091
-            .lvl = 66,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15093
-                MOVE_EARTHQUAKE,
-                MOVE_IRON_TAIL,
-                MOVE_CRUNCH,
-                MOVE_DRAGON_BREATH,
-            },
-            },
-            {
-#line 15098
-            .species = SPECIES_MACHAMP,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15098
-            .heldItem = ITEM_PERSIM_BERRY,
-#line 15100
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15099
-            .lvl = 68,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15101
-                MOVE_CROSS_CHOP,
-                MOVE_EARTHQUAKE,
-                MOVE_BRICK_BREAK,
-                MOVE_ROCK_SLIDE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_BRUNO_2,
     },
 #line 15106
     [TRAINER_ELITE_FOUR_AGATHA_2] =
@@ -37247,101 +13970,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_PINK,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15117
-            .species = SPECIES_GENGAR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15119
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15118
-            .lvl = 66,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15120
-                MOVE_SHADOW_BALL,
-                MOVE_PSYCHIC,
-                MOVE_CONFUSE_RAY,
-                MOVE_HYPNOSIS,
-            },
-            },
-            {
-#line 15125
-            .species = SPECIES_CROBAT,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15127
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15126
-            .lvl = 66,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15128
-                MOVE_SLUDGE_BOMB,
-                MOVE_AIR_CUTTER,
-                MOVE_SHADOW_BALL,
-                MOVE_CONFUSE_RAY,
-            },
-            },
-            {
-#line 15133
-            .species = SPECIES_MISDREAVUS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15135
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15134
-            .lvl = 65,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15136
-                MOVE_SHADOW_BALL,
-                MOVE_PSYCHIC,
-                MOVE_THUNDERBOLT,
-                MOVE_ATTRACT,
-            },
-            },
-            {
-#line 15141
-            .species = SPECIES_ARBOK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15143
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15142
-            .lvl = 68,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15144
-                MOVE_SLUDGE_BOMB,
-                MOVE_EARTHQUAKE,
-                MOVE_GIGA_DRAIN,
-                MOVE_DOUBLE_TEAM,
-            },
-            },
-            {
-#line 15149
-            .species = SPECIES_GENGAR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15149
-            .heldItem = ITEM_CHESTO_BERRY,
-#line 15151
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15150
-            .lvl = 70,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15152
-                MOVE_SHADOW_BALL,
-                MOVE_PSYCHIC,
-                MOVE_THUNDERBOLT,
-                MOVE_SLUDGE_BOMB,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_AGATHA_2,
     },
 #line 15157
     [TRAINER_ELITE_FOUR_LANCE_2] =
@@ -37365,101 +13994,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_BLUE,
         .partySize = 5,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15168
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15170
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15169
-            .lvl = 68,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15171
-                MOVE_HYPER_BEAM,
-                MOVE_DRAGON_DANCE,
-                MOVE_EARTHQUAKE,
-                MOVE_THUNDER_WAVE,
-            },
-            },
-            {
-#line 15176
-            .species = SPECIES_DRAGONITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15178
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15177
-            .lvl = 66,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15179
-                MOVE_HYPER_BEAM,
-                MOVE_EARTHQUAKE,
-                MOVE_DRAGON_CLAW,
-                MOVE_FLAMETHROWER,
-            },
-            },
-            {
-#line 15184
-            .species = SPECIES_KINGDRA,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15186
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15185
-            .lvl = 66,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15187
-                MOVE_HYPER_BEAM,
-                MOVE_DRAGON_DANCE,
-                MOVE_SURF,
-                MOVE_ICE_BEAM,
-            },
-            },
-            {
-#line 15192
-            .species = SPECIES_AERODACTYL,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15194
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15193
-            .lvl = 70,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15195
-                MOVE_HYPER_BEAM,
-                MOVE_ANCIENT_POWER,
-                MOVE_AERIAL_ACE,
-                MOVE_EARTHQUAKE,
-            },
-            },
-            {
-#line 15200
-            .species = SPECIES_DRAGONITE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15200
-            .heldItem = ITEM_PERSIM_BERRY,
-#line 15202
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15201
-            .lvl = 72,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15203
-                MOVE_HYPER_BEAM,
-                MOVE_OUTRAGE,
-                MOVE_THUNDERBOLT,
-                MOVE_ICE_BEAM,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_ELITE_FOUR_LANCE_2,
     },
 #line 15208
     [TRAINER_CHAMPION_REMATCH_SQUIRTLE] =
@@ -37483,119 +14018,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_YELLOW,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15219
-            .species = SPECIES_HERACROSS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15221
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15220
-            .lvl = 72,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15222
-                MOVE_MEGAHORN,
-                MOVE_EARTHQUAKE,
-                MOVE_COUNTER,
-                MOVE_ROCK_TOMB,
-            },
-            },
-            {
-#line 15227
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15229
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15228
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15230
-                MOVE_PSYCHIC,
-                MOVE_SHADOW_BALL,
-                MOVE_CALM_MIND,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 15235
-            .species = SPECIES_TYRANITAR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15237
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15236
-            .lvl = 72,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15238
-                MOVE_CRUNCH,
-                MOVE_EARTHQUAKE,
-                MOVE_THUNDERBOLT,
-                MOVE_AERIAL_ACE,
-            },
-            },
-            {
-#line 15243
-            .species = SPECIES_ARCANINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15245
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15244
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15246
-                MOVE_EXTREME_SPEED,
-                MOVE_OVERHEAT,
-                MOVE_AERIAL_ACE,
-                MOVE_IRON_TAIL,
-            },
-            },
-            {
-#line 15251
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15253
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15252
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15254
-                MOVE_GIGA_DRAIN,
-                MOVE_PSYCHIC,
-                MOVE_SLEEP_POWDER,
-                MOVE_LIGHT_SCREEN,
-            },
-            },
-            {
-#line 15259
-            .species = SPECIES_BLASTOISE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15259
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 15261
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15260
-            .lvl = 75,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15262
-                MOVE_HYDRO_PUMP,
-                MOVE_ICE_BEAM,
-                MOVE_EARTHQUAKE,
-                MOVE_RAIN_DANCE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHAMPION_REMATCH_SQUIRTLE,
     },
 #line 15267
     [TRAINER_CHAMPION_REMATCH_BULBASAUR] =
@@ -37619,119 +14042,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_YELLOW,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15278
-            .species = SPECIES_HERACROSS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15280
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15279
-            .lvl = 72,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15281
-                MOVE_MEGAHORN,
-                MOVE_EARTHQUAKE,
-                MOVE_COUNTER,
-                MOVE_ROCK_TOMB,
-            },
-            },
-            {
-#line 15286
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15288
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15287
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15289
-                MOVE_PSYCHIC,
-                MOVE_SHADOW_BALL,
-                MOVE_CALM_MIND,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 15294
-            .species = SPECIES_TYRANITAR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15296
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15295
-            .lvl = 72,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15297
-                MOVE_CRUNCH,
-                MOVE_EARTHQUAKE,
-                MOVE_THUNDERBOLT,
-                MOVE_AERIAL_ACE,
-            },
-            },
-            {
-#line 15302
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15304
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15303
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15305
-                MOVE_HYDRO_PUMP,
-                MOVE_DRAGON_DANCE,
-                MOVE_EARTHQUAKE,
-                MOVE_HYPER_BEAM,
-            },
-            },
-            {
-#line 15310
-            .species = SPECIES_ARCANINE,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15312
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15311
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15313
-                MOVE_EXTREME_SPEED,
-                MOVE_OVERHEAT,
-                MOVE_AERIAL_ACE,
-                MOVE_IRON_TAIL,
-            },
-            },
-            {
-#line 15318
-            .species = SPECIES_VENUSAUR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15318
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 15320
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15319
-            .lvl = 75,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15321
-                MOVE_SOLAR_BEAM,
-                MOVE_SLUDGE_BOMB,
-                MOVE_EARTHQUAKE,
-                MOVE_SUNNY_DAY,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHAMPION_REMATCH_BULBASAUR,
     },
 #line 15326
     [TRAINER_CHAMPION_REMATCH_CHARMANDER] =
@@ -37755,119 +14066,7 @@
         .mugshotEnabled = TRUE,
         .mugshotColor = MUGSHOT_COLOR_YELLOW,
         .partySize = 6,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15337
-            .species = SPECIES_HERACROSS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15339
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15338
-            .lvl = 72,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15340
-                MOVE_MEGAHORN,
-                MOVE_EARTHQUAKE,
-                MOVE_COUNTER,
-                MOVE_ROCK_TOMB,
-            },
-            },
-            {
-#line 15345
-            .species = SPECIES_ALAKAZAM,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15347
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15346
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15348
-                MOVE_PSYCHIC,
-                MOVE_SHADOW_BALL,
-                MOVE_CALM_MIND,
-                MOVE_REFLECT,
-            },
-            },
-            {
-#line 15353
-            .species = SPECIES_TYRANITAR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15355
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15354
-            .lvl = 72,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15356
-                MOVE_CRUNCH,
-                MOVE_EARTHQUAKE,
-                MOVE_THUNDERBOLT,
-                MOVE_AERIAL_ACE,
-            },
-            },
-            {
-#line 15361
-            .species = SPECIES_EXEGGUTOR,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15363
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15362
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15364
-                MOVE_GIGA_DRAIN,
-                MOVE_PSYCHIC,
-                MOVE_SLEEP_POWDER,
-                MOVE_LIGHT_SCREEN,
-            },
-            },
-            {
-#line 15369
-            .species = SPECIES_GYARADOS,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15371
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15370
-            .lvl = 73,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15372
-                MOVE_HYDRO_PUMP,
-                MOVE_DRAGON_DANCE,
-                MOVE_EARTHQUAKE,
-                MOVE_HYPER_BEAM,
-            },
-            },
-            {
-#line 15377
-            .species = SPECIES_CHARIZARD,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15377
-            .heldItem = ITEM_SITRUS_BERRY,
-#line 15379
-            .iv = TRAINER_PARTY_IVS(31, 31, 31, 31, 31, 31),
-#line 15378
-            .lvl = 75,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            .moves = {
-#line 15380
-                MOVE_FIRE_BLAST,
-                MOVE_DRAGON_CLAW,
-                MOVE_AERIAL_ACE,
-                MOVE_EARTHQUAKE,
-            },
-            },
-        },
+        .party = gTrainerParty_TRAINER_CHAMPION_REMATCH_CHARMANDER,
     },
 #line 15385
     [TRAINER_CUE_BALL_PAXTON] =
@@ -37886,29 +14085,5 @@
 #line 15392
         .aiFlags = AI_FLAG_CHECK_BAD_MOVE,
         .partySize = 2,
-        .party = (const struct TrainerMon[])
-        {
-            {
-#line 15394
-            .species = SPECIES_WEEZING,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15396
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 15395
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-            {
-#line 15398
-            .species = SPECIES_MUK,
-            .gender = TRAINER_MON_RANDOM_GENDER,
-#line 15400
-            .iv = TRAINER_PARTY_IVS(6, 6, 6, 6, 6, 6),
-#line 15399
-            .lvl = 39,
-            .nature = NATURE_HARDY,
-            .dynamaxLevel = MAX_DYNAMAX_LEVEL,
-            },
-        },
+        .party = gTrainerParty_TRAINER_CUE_BALL_PAXTON,
     },
@@ -173,14 +173,15 @@ bool8 LoadCompressedSpritePaletteUsingHeap(const struct CompressedSpritePalette
 {
     struct SpritePalette dest;
     void *buffer;
+    u32 mark = ArenaMark(&gFrameArena);
 
-    buffer = AllocZeroed(src->data[0] >> 8);
+    buffer = FrameAllocZeroed(src->data[0] >> 8);
     LZ77UnCompWram(src->data, buffer);
     dest.data = buffer;
     dest.tag = src->tag;
 
     LoadSpritePalette(&dest);
-    Free(buffer);
+    ArenaResetToMark(&gFrameArena, mark);
     return FALSE;
 }
 
@@ -188,15 +189,16 @@ bool8 LoadCompressedSpritePaletteUsingHeapWithTag(const u32 *pal, u16 tag)
 {
     struct SpritePalette dest;
     void *buffer;
+    u32 mark = ArenaMark(&gFrameArena);
 
-    buffer = AllocZeroed(*((u32 *)pal) >> 8);
+    buffer = FrameAllocZeroed(*((u32 *)pal) >> 8);
     if (!buffer)
         return TRUE;
     LZ77UnCompWram(pal, buffer);
     dest.data = buffer;
     dest.tag = tag;
     LoadSpritePalette(&dest);
-    Free(buffer);
+    ArenaResetToMark(&gFrameArena, mark);
     return FALSE;
 }
 
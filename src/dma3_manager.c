@@ -2,181 +2,365 @@
 #include "dma3.h"
 
 #define MAX_DMA_REQUESTS 128
+#define MAX_DMA_PRIORITY_REQUESTS 16
 
-static struct {
+// Stop transferring once VCOUNT passes this line, leaving the rest of
+// vblank to the sound mixer and the other vblank work.
+#define DMA3_VCOUNT_LIMIT 225
+#define CYCLES_PER_SCANLINE 1232
+
+// Approximate cost of starting a DMA transfer (2N + 2I).
+#define DMA3_STARTUP_CYCLES 4
+
+struct Dma3Request
+{
     /* 0x00 */ const u8 *src;
     /* 0x04 */ u8 *dest;
     /* 0x08 */ u16 size;
     /* 0x0A */ u16 mode;
     /* 0x0C */ u32 value;
-} gDma3Requests[128];
+};
+
+struct Dma3Queue
+{
+    struct Dma3Request *requests;
+    u16 count;
+    // Index returned to callers for requests[0].
+    u16 baseIndex;
+    u8 cursor;
+    // Last request added to the queue, candidate for merging.
+    u8 tail;
+};
+
+static struct Dma3Request gDma3Requests[MAX_DMA_REQUESTS];
+static struct Dma3Request gDma3PriorityRequests[MAX_DMA_PRIORITY_REQUESTS];
+
+static struct Dma3Queue sDma3Queues[] =
+{
+    // Processed in order, so priority requests are never starved by a
+    // backlog of large VRAM copies.
+    { gDma3PriorityRequests, MAX_DMA_PRIORITY_REQUESTS, MAX_DMA_REQUESTS },
+    { gDma3Requests, MAX_DMA_REQUESTS, 0 },
+};
+
+#define PRIORITY_QUEUE (&sDma3Queues[0])
+#define NORMAL_QUEUE (&sDma3Queues[1])
 
 static volatile bool8 gDma3ManagerLocked;
-static u8 gDma3RequestCursor;
+static struct Dma3Stats sDma3FrameStats;
+// Accumulated between calls to ProcessDma3Requests.
+static u16 sDma3RequestsMerged;
+static u16 sDma3RequestsDropped;
+static u32 sDma3BytesDropped;
 
-void ClearDma3Requests(void)
+static void ClearDma3Queue(struct Dma3Queue *queue)
 {
     int i;
 
-    gDma3ManagerLocked = TRUE;
-    gDma3RequestCursor = 0;
+    queue->cursor = 0;
+    queue->tail = 0;
 
-    for(i = 0; i < (u8)NELEMS(gDma3Requests); i++)
+    for (i = 0; i < queue->count; i++)
     {
-        gDma3Requests[i].size = 0;
-        gDma3Requests[i].src = 0;
-        gDma3Requests[i].dest = 0;
+        queue->requests[i].size = 0;
+        queue->requests[i].src = 0;
+        queue->requests[i].dest = 0;
     }
+}
+
+void ClearDma3Requests(void)
+{
+    gDma3ManagerLocked = TRUE;
+
+    ClearDma3Queue(PRIORITY_QUEUE);
+    ClearDma3Queue(NORMAL_QUEUE);
 
     gDma3ManagerLocked = FALSE;
 }
 
-void ProcessDma3Requests(void)
+// Wait states per access, based on REG_WAITCNT as configured in AgbMain.
+static u32 GetAccessCycles(const void *addr, bool32 is32Bit)
+{
+    switch ((uintptr_t)addr >> 24)
+    {
+    case 0x02: // EWRAM, 16-bit bus with 2 wait states
+        return is32Bit ? 6 : 3;
+    case 0x03: // IWRAM
+    case 0x04: // I/O
+    case 0x07: // OAM
+        return 1;
+    case 0x05: // PLTT, 16-bit bus
+    case 0x06: // VRAM, 16-bit bus
+        return is32Bit ? 2 : 1;
+    default: // ROM, sequential accesses with 1 wait state
+        return is32Bit ? 4 : 2;
+    }
+}
+
+static u32 EstimateDma3RequestCycles(const struct Dma3Request *request)
 {
-    u16 bytesTransferred;
+    bool32 is32Bit = request->mode == DMA_REQUEST_COPY32 || request->mode == DMA_REQUEST_FILL32;
+    u32 units = is32Bit ? request->size / 4 : request->size / 2;
+    u32 blocks = (request->size + MAX_DMA_BLOCK_SIZE - 1) / MAX_DMA_BLOCK_SIZE;
+    u32 srcCycles;
 
-    if (gDma3ManagerLocked)
-        return;
+    // Fills read the same IWRAM value every time.
+    if (request->mode == DMA_REQUEST_COPY32 || request->mode == DMA_REQUEST_COPY16)
+        srcCycles = GetAccessCycles(request->src, is32Bit);
+    else
+        srcCycles = 1;
 
-    bytesTransferred = 0;
+    return units * (srcCycles + GetAccessCycles(request->dest, is32Bit)) + blocks * DMA3_STARTUP_CYCLES;
+}
 
-    // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
-    while (gDma3Requests[gDma3RequestCursor].size != 0)
+static void ExecuteDma3Request(const struct Dma3Request *request)
+{
+    switch (request->mode)
     {
-        bytesTransferred += gDma3Requests[gDma3RequestCursor].size;
+    case DMA_REQUEST_COPY32: // regular 32-bit copy
+        Dma3CopyLarge32_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
+        Dma3FillLarge32_(request->value, request->dest, request->size);
+        break;
+    case DMA_REQUEST_COPY16: // regular 16-bit copy
+        Dma3CopyLarge16_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
+        Dma3FillLarge16_(request->value, request->dest, request->size);
+        break;
+    }
+}
 
-        if (bytesTransferred > 40 * 1024)
-            return; // don't transfer more than 40 KiB
-        if (*(u8 *)REG_ADDR_VCOUNT > 224)
-            return; // we're about to leave vblank, stop
+// Returns FALSE once the budget is exhausted.
+static bool32 ProcessDma3Queue(struct Dma3Queue *queue, s32 *budget)
+{
+    struct Dma3Request *request;
+    s32 cycles;
 
-        switch (gDma3Requests[gDma3RequestCursor].mode)
-        {
-        case DMA_REQUEST_COPY32: // regular 32-bit copy
-            Dma3CopyLarge32_(gDma3Requests[gDma3RequestCursor].src,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
-            Dma3FillLarge32_(gDma3Requests[gDma3RequestCursor].value,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_COPY16:    // regular 16-bit copy
-            Dma3CopyLarge16_(gDma3Requests[gDma3RequestCursor].src,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
-            Dma3FillLarge16_(gDma3Requests[gDma3RequestCursor].value,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        }
+    // as long as there are DMA requests to process (unless the budget or vblank is an issue), do not exit
+    while (queue->requests[queue->cursor].size != 0)
+    {
+        request = &queue->requests[queue->cursor];
+        cycles = EstimateDma3RequestCycles(request);
+
+        // A request which cannot fit in a whole vblank would never be
+        // transferred, so let it through if it is the first this frame.
+        if (cycles > *budget && sDma3FrameStats.bytesTransferred != 0)
+            return FALSE;
+        if (*(u8 *)REG_ADDR_VCOUNT >= DMA3_VCOUNT_LIMIT)
+            return FALSE; // we're about to leave vblank, stop
+
+        ExecuteDma3Request(request);
+        *budget -= cycles;
+        sDma3FrameStats.bytesTransferred += request->size;
 
         // Free the request
-        gDma3Requests[gDma3RequestCursor].src = NULL;
-        gDma3Requests[gDma3RequestCursor].dest = NULL;
-        gDma3Requests[gDma3RequestCursor].size = 0;
-        gDma3Requests[gDma3RequestCursor].mode = 0;
-        gDma3Requests[gDma3RequestCursor].value = 0;
-        gDma3RequestCursor++;
-
-        if (gDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
-            gDma3RequestCursor = 0;
+        request->src = NULL;
+        request->dest = NULL;
+        request->size = 0;
+        request->mode = 0;
+        request->value = 0;
+
+        if (++queue->cursor >= queue->count) // loop back to the first DMA request
+            queue->cursor = 0;
     }
+
+    return TRUE;
 }
 
-s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+static u32 CountPendingDma3Bytes(const struct Dma3Queue *queue)
 {
-    int cursor;
-    int var = 0;
+    int i;
+    u32 bytes = 0;
+
+    for (i = 0; i < queue->count; i++)
+        bytes += queue->requests[i].size;
+
+    return bytes;
+}
+
+void ProcessDma3Requests(void)
+{
+    u32 vcount;
+    s32 budget;
+
+    if (gDma3ManagerLocked)
+        return;
+
+    sDma3FrameStats.bytesTransferred = 0;
+    sDma3FrameStats.requestsMerged = sDma3RequestsMerged;
+    sDma3FrameStats.requestsDropped = sDma3RequestsDropped;
+    sDma3FrameStats.bytesDropped = sDma3BytesDropped;
+    sDma3FrameStats.totalBytesDropped += sDma3BytesDropped;
+    sDma3RequestsMerged = 0;
+    sDma3RequestsDropped = 0;
+    sDma3BytesDropped = 0;
 
-    gDma3ManagerLocked = 1;
+    vcount = *(u8 *)REG_ADDR_VCOUNT;
+    if (vcount < DISPLAY_HEIGHT)
+        vcount = DISPLAY_HEIGHT;
+    if (vcount < DMA3_VCOUNT_LIMIT)
+        budget = (DMA3_VCOUNT_LIMIT - vcount) * CYCLES_PER_SCANLINE;
+    else
+        budget = 0;
 
-    cursor = gDma3RequestCursor;
-    while(1)
+    if (ProcessDma3Queue(PRIORITY_QUEUE, &budget))
+        ProcessDma3Queue(NORMAL_QUEUE, &budget);
+
+    sDma3FrameStats.bytesDeferred = CountPendingDma3Bytes(PRIORITY_QUEUE) + CountPendingDma3Bytes(NORMAL_QUEUE);
+    if (sDma3FrameStats.bytesDeferred > sDma3FrameStats.peakBytesDeferred)
+        sDma3FrameStats.peakBytesDeferred = sDma3FrameStats.bytesDeferred;
+}
+
+const struct Dma3Stats *GetDma3FrameStats(void)
+{
+    return &sDma3FrameStats;
+}
+
+// Extends the most recent request if the new one continues it, e.g. a
+// tilemap copy followed by a copy of the next block of VRAM.
+static bool32 TryMergeDma3Request(struct Dma3Queue *queue, const u8 *src, u8 *dest, u16 size, u16 mode, u32 value)
+{
+    struct Dma3Request *tail = &queue->requests[queue->tail];
+
+    if (tail->size == 0 || tail->mode != mode)
+        return FALSE;
+    if (tail->dest + tail->size != dest)
+        return FALSE;
+    if ((u32)tail->size + size > UINT16_MAX)
+        return FALSE;
+
+    if (mode == DMA_REQUEST_COPY32 || mode == DMA_REQUEST_COPY16)
     {
-        if(!gDma3Requests[cursor].size) // an empty copy was found and the current cursor will be returned.
-        {
-            gDma3Requests[cursor].src = src;
-            gDma3Requests[cursor].dest = dest;
-            gDma3Requests[cursor].size = size;
+        if (tail->src + tail->size != src)
+            return FALSE;
+    }
+    else if (tail->value != value)
+    {
+        return FALSE;
+    }
+
+    tail->size += size;
+    sDma3RequestsMerged++;
+    return TRUE;
+}
 
-            if(mode == DMA3_32BIT)
-                gDma3Requests[cursor].mode = DMA_REQUEST_COPY32;
-            else
-                gDma3Requests[cursor].mode = DMA_REQUEST_COPY16;
+static bool32 OverlapsPendingDma3Request(const struct Dma3Queue *queue, const u8 *dest, u16 size)
+{
+    int i;
 
-            gDma3ManagerLocked = FALSE;
-            return (s16)cursor;
-        }
-        if(++cursor >= 0x80) // loop back to start.
-        {
-            cursor = 0;
-        }
-        if(++var >= 0x80) // max checks were made. all resulted in failure.
-        {
-            break;
-        }
+    for (i = 0; i < queue->count; i++)
+    {
+        const struct Dma3Request *request = &queue->requests[i];
+
+        if (request->size != 0 && dest < request->dest + request->size && request->dest < dest + size)
+            return TRUE;
     }
-    gDma3ManagerLocked = FALSE;
-    return -1;
+
+    return FALSE;
 }
 
-s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+static s16 AddDma3Request(const void *src, void *dest, u16 size, u16 mode, u32 value, bool32 highPriority)
 {
+    struct Dma3Queue *queue = NORMAL_QUEUE;
     int cursor;
     int var = 0;
 
-    cursor = gDma3RequestCursor;
-    gDma3ManagerLocked = 1;
+    gDma3ManagerLocked = TRUE;
 
-    while(1)
+    // A priority request must not overtake a pending write to the same
+    // memory, otherwise the older data would be left there. Queue it
+    // behind that write instead.
+    if (highPriority && !OverlapsPendingDma3Request(NORMAL_QUEUE, dest, size))
+        queue = PRIORITY_QUEUE;
+
+    if (TryMergeDma3Request(queue, src, dest, size, mode, value))
     {
-        if(!gDma3Requests[cursor].size)
-        {
-            gDma3Requests[cursor].dest = dest;
-            gDma3Requests[cursor].size = size;
-            gDma3Requests[cursor].mode = mode;
-            gDma3Requests[cursor].value = value;
+        gDma3ManagerLocked = FALSE;
+        return (s16)(queue->baseIndex + queue->tail);
+    }
 
-            if(mode == DMA3_32BIT)
-                gDma3Requests[cursor].mode = DMA_REQUEST_FILL32;
-            else
-                gDma3Requests[cursor].mode = DMA_REQUEST_FILL16;
+    cursor = queue->cursor;
+    while (1)
+    {
+        if (!queue->requests[cursor].size) // an empty copy was found and the current cursor will be returned.
+        {
+            queue->requests[cursor].src = src;
+            queue->requests[cursor].dest = dest;
+            queue->requests[cursor].size = size;
+            queue->requests[cursor].mode = mode;
+            queue->requests[cursor].value = value;
+            queue->tail = cursor;
 
             gDma3ManagerLocked = FALSE;
-            return (s16)cursor;
+            return (s16)(queue->baseIndex + cursor);
         }
-        if(++cursor >= 0x80) // loop back to start.
+        if (++cursor >= queue->count) // loop back to start.
         {
             cursor = 0;
         }
-        if(++var >= 0x80) // max checks were made. all resulted in failure.
+        if (++var >= queue->count) // max checks were made. all resulted in failure.
         {
             break;
         }
     }
+
+    sDma3RequestsDropped++;
+    sDma3BytesDropped += size;
     gDma3ManagerLocked = FALSE;
     return -1;
 }
 
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    u16 requestMode;
+
+    if ((mode & DMA3_32BIT) == DMA3_32BIT)
+        requestMode = DMA_REQUEST_COPY32;
+    else
+        requestMode = DMA_REQUEST_COPY16;
+
+    return AddDma3Request(src, dest, size, requestMode, 0, mode & DMA3_PRIORITY);
+}
+
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+{
+    u16 requestMode;
+
+    if ((mode & DMA3_32BIT) == DMA3_32BIT)
+        requestMode = DMA_REQUEST_FILL32;
+    else
+        requestMode = DMA_REQUEST_FILL16;
+
+    return AddDma3Request(NULL, dest, size, requestMode, value, mode & DMA3_PRIORITY);
+}
+
 s16 WaitDma3Request(s16 index)
 {
     int current = 0;
 
     if (index == -1)
     {
-        for (; current < 0x80; current ++)
+        for (; current < MAX_DMA_REQUESTS; current++)
             if (gDma3Requests[current].size)
                 return -1;
+        for (current = 0; current < MAX_DMA_PRIORITY_REQUESTS; current++)
+            if (gDma3PriorityRequests[current].size)
+                return -1;
 
         return 0;
     }
 
-    if (gDma3Requests[index].size)
+    if (index >= MAX_DMA_REQUESTS)
+    {
+        if (gDma3PriorityRequests[index - MAX_DMA_REQUESTS].size)
+            return -1;
+    }
+    else if (gDma3Requests[index].size)
+    {
         return -1;
+    }
 
     return 0;
 }
@@ -44,7 +44,6 @@ static void ObjectEventExecHeldMovementAction(struct ObjectEvent *, struct Sprit
 static void UpdateObjectEventSpriteAnimPause(struct ObjectEvent *, struct Sprite *);
 static bool8 IsCoordOutsideObjectEventMovementRange(struct ObjectEvent *, s16, s16);
 static bool8 IsMetatileDirectionallyImpassable(struct ObjectEvent *, s16, s16, u8);
-static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *, s16, s16);
 static void CalcWhetherObjectIsOffscreen(struct ObjectEvent *, struct Sprite *);
 static void UpdateObjEventSpriteVisibility(struct ObjectEvent *, struct Sprite *);
 static void ObjectEventUpdateMetatileBehaviors(struct ObjectEvent *);
@@ -1251,6 +1250,55 @@ static const u8 sPlayerDirectionToCopyDirection[][4] = {
 
 #include "data/object_events/movement_action_func_tables.h"
 
+// Object events whose current or previous coords fall in each cell of a
+// coarse grid, tiled across the map. Adjacent coords are always in
+// different cells, so lookups by position usually check a single object.
+#define OCCUPANCY_GRID_SIZE 8
+#define OCCUPANCY_CELL(x, y) (((x) & (OCCUPANCY_GRID_SIZE - 1)) | (((y) & (OCCUPANCY_GRID_SIZE - 1)) * OCCUPANCY_GRID_SIZE))
+
+STATIC_ASSERT(OBJECT_EVENTS_COUNT <= 16, ObjectEventOccupancyTooSmall)
+
+static EWRAM_DATA u16 sObjectEventOccupancy[OCCUPANCY_GRID_SIZE * OCCUPANCY_GRID_SIZE] = {0};
+static EWRAM_DATA u8 sObjectEventCells[OBJECT_EVENTS_COUNT][2] = {0};
+
+// Must be called whenever an object event's coords or active state change.
+void UpdateObjectEventOccupancy(struct ObjectEvent *objectEvent)
+{
+    u32 objectEventId = objectEvent - gObjectEvents;
+    u32 bit = 1 << objectEventId;
+    u32 currentCell, previousCell;
+
+    UpdateTrainerSight(objectEvent);
+
+    sObjectEventOccupancy[sObjectEventCells[objectEventId][0]] &= ~bit;
+    sObjectEventOccupancy[sObjectEventCells[objectEventId][1]] &= ~bit;
+
+    if (objectEvent->active)
+    {
+        currentCell = OCCUPANCY_CELL(objectEvent->currentCoords.x, objectEvent->currentCoords.y);
+        previousCell = OCCUPANCY_CELL(objectEvent->previousCoords.x, objectEvent->previousCoords.y);
+        sObjectEventCells[objectEventId][0] = currentCell;
+        sObjectEventCells[objectEventId][1] = previousCell;
+        sObjectEventOccupancy[currentCell] |= bit;
+        sObjectEventOccupancy[previousCell] |= bit;
+    }
+}
+
+// For when gObjectEvents has been replaced wholesale, e.g. loaded from the save block.
+void RebuildObjectEventOccupancy(void)
+{
+    u32 i;
+
+    CpuFill16(0, sObjectEventOccupancy, sizeof(sObjectEventOccupancy));
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        UpdateObjectEventOccupancy(&gObjectEvents[i]);
+}
+
+static inline u32 GetObjectEventsNear(s16 x, s16 y)
+{
+    return sObjectEventOccupancy[OCCUPANCY_CELL(x, y)];
+}
+
 static void ClearObjectEvent(struct ObjectEvent *objectEvent)
 {
     *objectEvent = (struct ObjectEvent){};
@@ -1258,6 +1306,7 @@ static void ClearObjectEvent(struct ObjectEvent *objectEvent)
     objectEvent->mapNum = MAP_NUM(UNDEFINED);
     objectEvent->mapGroup = MAP_GROUP(UNDEFINED);
     objectEvent->movementActionId = MOVEMENT_ACTION_NONE;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 static void ClearAllObjectEvents(void)
@@ -1322,14 +1371,15 @@ bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u
 
 u8 GetObjectEventIdByXY(s16 x, s16 y)
 {
-    u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u32 i, candidates;
+
+    for (i = 0, candidates = GetObjectEventsNear(x, y); candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
-            break;
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
     }
 
-    return i;
+    return OBJECT_EVENTS_COUNT;
 }
 
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapGroupId)
@@ -1499,6 +1549,7 @@ static u8 InitObjectEventStateFromTemplate(const struct ObjectEventTemplate *tem
     objectEvent->currentCoords.y = y;
     objectEvent->previousCoords.x = x;
     objectEvent->previousCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
     objectEvent->currentElevation = template->elevation;
     objectEvent->previousElevation = template->elevation;
     objectEvent->rangeX = template->movementRangeX;
@@ -1567,6 +1618,7 @@ static bool8 GetAvailableObjectEventId(u16 localId, u8 mapNum, u8 mapGroup, u8 *
 static void RemoveObjectEvent(struct ObjectEvent *objectEvent)
 {
     objectEvent->active = FALSE;
+    UpdateObjectEventOccupancy(objectEvent);
     RemoveObjectEventInternal(objectEvent);
     // zero potential species info
     objectEvent->graphicsId = objectEvent->shiny = 0;
@@ -1761,6 +1813,7 @@ static u8 TrySetupObjectEventSprite(const struct ObjectEventTemplate *objectEven
     if (spriteId == MAX_SPRITES)
     {
         gObjectEvents[objectEventId].active = FALSE;
+        UpdateObjectEventOccupancy(&gObjectEvents[objectEventId]);
         return OBJECT_EVENTS_COUNT;
     }
 
@@ -3205,6 +3258,7 @@ void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -3213,6 +3267,7 @@ static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 void MoveObjectEventToMapCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -3271,16 +3326,17 @@ void UpdateObjectEventCoordsForCameraUpdate(void)
                 gObjectEvents[i].previousCoords.y -= dy;
             }
         }
+        RebuildObjectEventOccupancy();
     }
 }
 
 u8 GetObjectEventIdByPosition(u16 x, u16 y, u8 elevation)
 {
-    u8 i;
+    u32 i, candidates;
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0, candidates = GetObjectEventsNear(x, y); candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active)
+        if ((candidates & 1) && gObjectEvents[i].active)
         {
             if (gObjectEvents[i].currentCoords.x == x
              && gObjectEvents[i].currentCoords.y == y
@@ -3455,6 +3511,7 @@ void SetObjectEventDirection(struct ObjectEvent *objectEvent, u8 direction)
     {
         d2 = direction;
         objectEvent->facingDirection = d2;
+        UpdateTrainerSight(objectEvent);
     }
     objectEvent->movementDirection = direction;
 }
@@ -6412,16 +6469,18 @@ static bool8 IsMetatileDirectionallyImpassable(struct ObjectEvent *objectEvent,
     return FALSE;
 }
 
-static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16 x, s16 y)
+bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16 x, s16 y)
 {
-    u8 i;
+    u32 i, candidates;
     struct ObjectEvent *curObject;
 
     if (objectEvent->localId == OBJ_EVENT_ID_FOLLOWER)
         return FALSE; // follower cannot collide with other objects, but they can collide with it
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0, candidates = GetObjectEventsNear(x, y); candidates != 0; i++, candidates >>= 1)
     {
+        if (!(candidates & 1))
+            continue;
         curObject = &gObjectEvents[i];
         if (curObject->active && (curObject->movementType != MOVEMENT_TYPE_FOLLOW_PLAYER || objectEvent != &gObjectEvents[gPlayerAvatar.objectEventId]) && curObject != objectEvent)
         {
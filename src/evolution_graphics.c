@@ -512,11 +512,13 @@ u8 CycleEvolutionMonSprite(u8 preEvoSpriteId, u8 postEvoSpriteId)
     gSprites[preEvoSpriteId].oam.matrixNum = 30;
     gSprites[preEvoSpriteId].invisible = FALSE;
     CpuCopy16(palette, &gPlttBufferFaded[OBJ_PLTT_ID(gSprites[preEvoSpriteId].oam.paletteNum)], PLTT_SIZE_4BPP);
+    MarkPaletteRangeDirty(OBJ_PLTT_ID(gSprites[preEvoSpriteId].oam.paletteNum), 16);
     gSprites[postEvoSpriteId].callback = SpriteCallbackDummy_MonSprites;
     gSprites[postEvoSpriteId].oam.affineMode = ST_OAM_AFFINE_NORMAL;
     gSprites[postEvoSpriteId].oam.matrixNum = 31;
     gSprites[postEvoSpriteId].invisible = FALSE;
     CpuCopy16(palette, &gPlttBufferFaded[OBJ_PLTT_ID(gSprites[postEvoSpriteId].oam.paletteNum)], PLTT_SIZE_4BPP);
+    MarkPaletteRangeDirty(OBJ_PLTT_ID(gSprites[postEvoSpriteId].oam.paletteNum), 16);
     gTasks[taskId].EvoGraphicsTaskEvoStop = FALSE;
     return taskId;
 }
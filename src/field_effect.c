@@ -442,6 +442,7 @@ void ApplyGlobalFieldPaletteTint(u8 paletteIdx)
         return;
     }
     CpuFastCopy(&gPlttBufferUnfaded[OBJ_PLTT_ID2(paletteIdx)], &gPlttBufferFaded[OBJ_PLTT_ID2(paletteIdx)], PLTT_SIZE_4BPP);
+    MarkPaletteRangeDirty(OBJ_PLTT_ID2(paletteIdx), 16);
 }
 
 void FieldEffectScript_LoadFadedPal(const struct SpritePalette * spritePalette)
@@ -618,6 +619,7 @@ void MultiplyInvertedPaletteRGBComponents(u16 i, u8 r, u8 g, u8 b)
     outPal |= curGreen << 5;
     outPal |= curBlue << 10;
     gPlttBufferFaded[i] = outPal;
+    MarkPaletteRangeDirty(i, 1);
 }
 
 static void PokecenterHealEffect_Init(struct Task *task);
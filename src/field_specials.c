@@ -486,7 +486,7 @@ bool8 IsThereRoomInAnyBoxForMorePokemon(void)
     {
         for (j = 0; j < IN_BOX_COUNT; j++)
         {
-            if (GetBoxMonDataAt(i, j, MON_DATA_SPECIES) == SPECIES_NONE)
+            if (GetBoxMonSummaryAt(i, j)->species == SPECIES_NONE)
                 return TRUE;
         }
     }
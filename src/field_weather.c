@@ -481,6 +481,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
 
             curPalIndex++;
         }
+        MarkPalettesDirty(palettes);
     }
     else if (colorMapIndex < 0)
     {
@@ -509,6 +510,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
 
             curPalIndex++;
         }
+        MarkPaletteRangeDirty(PLTT_ID(startPalIndex), PLTT_ID(numPalettes - startPalIndex));
     }
     else
     {
@@ -523,6 +525,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
         {
             // No palette blending.
             CpuFastCopy(&gPlttBufferUnfaded[PLTT_ID(startPalIndex)], &gPlttBufferFaded[PLTT_ID(startPalIndex)], numPalettes * PLTT_SIZE_4BPP);
+            MarkPaletteRangeDirty(PLTT_ID(startPalIndex), PLTT_ID(numPalettes));
         }
     }
 }
@@ -579,6 +582,7 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
 
         curPalIndex++;
     }
+    MarkPaletteRangeDirty(PLTT_ID(startPalIndex), PLTT_ID(numPalettes - startPalIndex));
 }
 
 static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u32 blendColor)
@@ -634,6 +638,7 @@ static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u32 b
             }
         }
     }
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 static void ApplyFogBlend(u8 blendCoeff, u32 blendColor)
@@ -656,6 +661,7 @@ static void ApplyFogBlend(u8 blendCoeff, u32 blendColor)
     }
     // Finally blend all sprite palettes faded->faded with fadeIn color
     BlendPalettesFine(PALETTES_OBJECTS, gPlttBufferFaded, gPlttBufferFaded, blendCoeff, blendColor);
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 static void MarkFogSpritePalToLighten(u8 paletteIndex)
@@ -869,6 +875,7 @@ void UpdateSpritePaletteWithWeather(u8 spritePaletteIndex, bool32 allowFog)
             paletteIndex = PLTT_ID(paletteIndex);
             for (i = 0; i < 16; i++)
                 gPlttBufferFaded[paletteIndex + i] = gWeatherPtr->fadeDestColor;
+            MarkPaletteRangeDirty(paletteIndex, 16);
         }
         break;
     case WEATHER_PAL_STATE_SCREEN_FADING_OUT:
@@ -898,6 +905,7 @@ void UpdateSpritePaletteWithWeather(u8 spritePaletteIndex, bool32 allowFog)
                 UpdateSpritePaletteWithTime(spritePaletteIndex);
                 // Then blend faded->faded with fog coeff
                 BlendPalettesFine(1, gPlttBufferFaded + paletteIndex, gPlttBufferFaded + paletteIndex, i, RGB(28, 31, 28));
+                MarkPaletteRangeDirty(paletteIndex, 16);
             }
             else
             {
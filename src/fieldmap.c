@@ -22,6 +22,21 @@ EWRAM_DATA struct Camera gCamera = {0};
 static EWRAM_DATA struct ConnectionFlags gMapConnectionFlags = {0};
 EWRAM_DATA u8 gGlobalFieldTintMode = QL_TINT_NONE;
 
+#if OW_METATILE_ATTRIBUTE_CACHE
+// Behavior and layer type of the metatile in each cell of VMap, built when
+// the map is loaded. A layout swap or season change without a map load
+// rebuilds it on the next lookup instead.
+#define CACHED_BEHAVIOR_MASK      0x01FF
+#define CACHED_LAYER_TYPE_SHIFT   9
+#define CACHED_LAYER_TYPE_MASK    0x0600
+#define CACHED_UNRESOLVED         0xFFFF
+
+static EWRAM_DATA u16 sMetatileAttributeCache[VIRTUAL_MAP_SIZE] = {0};
+static EWRAM_DATA u16 sResolvedMetatileAttributes[NUM_METATILES_TOTAL] = {0};
+static EWRAM_DATA const struct MapLayout *sMetatileAttributeCacheLayout = NULL;
+static EWRAM_DATA u8 sMetatileAttributeCacheSeason = 0;
+#endif
+
 static const struct ConnectionFlags sDummyConnectionFlags = {};
 
 static void InitMapLayoutData(struct MapHeader *);
@@ -36,6 +51,8 @@ static const struct MapConnection *GetIncomingConnection(u8, s32, s32);
 static bool8 IsPosInIncomingConnectingMap(u8, s32, s32, const struct MapConnection *);
 static bool8 IsCoordInIncomingConnectingMap(s32, s32, s32, s32);
 static u32 GetAttributeByMetatileIdAndMapLayout(const struct MapLayout *, u16, u8);
+static void BuildMetatileAttributeCache(void);
+static void UpdateMetatileAttributeCacheAt(s32 x, s32 y);
 
 static inline u16 GetBorderBlockAt(s32 x, s32 y)
 {
@@ -91,6 +108,7 @@ const struct MapHeader * GetMapHeaderFromConnection(const struct MapConnection *
 void InitMap(void)
 {
     InitMapLayoutData(&gMapHeader);
+    BuildMetatileAttributeCache();
     RunOnLoadMapScript();
 }
 
@@ -98,6 +116,7 @@ void InitMapFromSavedGame(void)
 {
     InitMapLayoutData(&gMapHeader);
     LoadSavedMapView();
+    BuildMetatileAttributeCache();
     RunOnLoadMapScript();
 }
 
@@ -389,13 +408,82 @@ u32 MapGridGetMetatileAttributeAt(s16 x, s16 y, u8 attributeType)
     return GetAttributeByMetatileIdAndMapLayout(gMapHeader.mapLayout, metatileId, attributeType);
 }
 
+#if OW_METATILE_ATTRIBUTE_CACHE
+// Metatile ids are 10 bits, so every id is a valid index.
+STATIC_ASSERT(MAPGRID_METATILE_ID_MASK < NUM_METATILES_TOTAL, MetatileAttributeCacheIds)
+
+static u32 ResolveMetatileAttributes(u32 metatileId)
+{
+    u32 attributes;
+
+    if (sResolvedMetatileAttributes[metatileId] != CACHED_UNRESOLVED)
+        return sResolvedMetatileAttributes[metatileId];
+
+    attributes = GetAttributeByMetatileIdAndMapLayout(gMapHeader.mapLayout, metatileId, METATILE_ATTRIBUTES_ALL);
+    attributes = ExtractMetatileAttribute(attributes, METATILE_ATTRIBUTE_BEHAVIOR)
+               | (ExtractMetatileAttribute(attributes, METATILE_ATTRIBUTE_LAYER_TYPE) << CACHED_LAYER_TYPE_SHIFT);
+    sResolvedMetatileAttributes[metatileId] = attributes;
+    return attributes;
+}
+
+static void BuildMetatileAttributeCache(void)
+{
+    s32 x, y;
+    u16 *dest = sMetatileAttributeCache;
+
+    CpuFill16(CACHED_UNRESOLVED, sResolvedMetatileAttributes, sizeof(sResolvedMetatileAttributes));
+    sMetatileAttributeCacheLayout = gMapHeader.mapLayout;
+    sMetatileAttributeCacheSeason = gLoadedSeason;
+    for (y = 0; y < VMap.Ysize; y++)
+    {
+        for (x = 0; x < VMap.Xsize; x++)
+            *dest++ = ResolveMetatileAttributes(MapGridGetMetatileIdAt(x, y));
+    }
+}
+
+static inline const u16 *GetMetatileAttributeCacheAt(s32 x, s32 y)
+{
+    if (!AreCoordsWithinMapGridBounds(x, y))
+        return NULL;
+    if (sMetatileAttributeCacheLayout != gMapHeader.mapLayout || sMetatileAttributeCacheSeason != gLoadedSeason)
+        BuildMetatileAttributeCache();
+    return &sMetatileAttributeCache[x + VMap.Xsize * y];
+}
+
+static void UpdateMetatileAttributeCacheAt(s32 x, s32 y)
+{
+    if (sMetatileAttributeCacheLayout == gMapHeader.mapLayout && sMetatileAttributeCacheSeason == gLoadedSeason)
+        sMetatileAttributeCache[x + VMap.Xsize * y] = ResolveMetatileAttributes(MapGridGetMetatileIdAt(x, y));
+}
+#else
+static void BuildMetatileAttributeCache(void)
+{
+}
+
+static void UpdateMetatileAttributeCacheAt(s32 x, s32 y)
+{
+}
+#endif
+
 u32 MapGridGetMetatileBehaviorAt(s16 x, s16 y)
 {
+#if OW_METATILE_ATTRIBUTE_CACHE
+    const u16 *attributes = GetMetatileAttributeCacheAt(x, y);
+
+    if (attributes != NULL)
+        return *attributes & CACHED_BEHAVIOR_MASK;
+#endif
     return MapGridGetMetatileAttributeAt(x, y, METATILE_ATTRIBUTE_BEHAVIOR);
 }
 
 u8 MapGridGetMetatileLayerTypeAt(s16 x, s16 y)
 {
+#if OW_METATILE_ATTRIBUTE_CACHE
+    const u16 *attributes = GetMetatileAttributeCacheAt(x, y);
+
+    if (attributes != NULL)
+        return (*attributes & CACHED_LAYER_TYPE_MASK) >> CACHED_LAYER_TYPE_SHIFT;
+#endif
     return MapGridGetMetatileAttributeAt(x, y, METATILE_ATTRIBUTE_LAYER_TYPE);
 }
 
@@ -406,6 +494,7 @@ void MapGridSetMetatileIdAt(s32 x, s32 y, u16 metatile)
     {
         i = x + y * VMap.Xsize;
         VMap.map[i] = (VMap.map[i] & MAPGRID_ELEVATION_MASK) | (metatile & ~MAPGRID_ELEVATION_MASK);
+        UpdateMetatileAttributeCacheAt(x, y);
     }
 }
 
@@ -416,6 +505,7 @@ void MapGridSetMetatileEntryAt(s32 x, s32 y, u16 metatile)
     {
         i = x + VMap.Xsize * y;
         VMap.map[i] = metatile;
+        UpdateMetatileAttributeCacheAt(x, y);
     }
 }
 
@@ -427,6 +517,8 @@ void MapGridSetMetatileImpassabilityAt(s32 x, s32 y, bool32 impassable)
             VMap.map[x + VMap.Xsize * y] |= MAPGRID_COLLISION_MASK;
         else
             VMap.map[x + VMap.Xsize * y] &= ~MAPGRID_COLLISION_MASK;
+        // An undefined block stops falling back to the border once its collision bits are set.
+        UpdateMetatileAttributeCacheAt(x, y);
     }
 }
 
@@ -565,6 +657,7 @@ static void MoveMapViewToBackup(u8 direction)
             src = &mapView[srci + i];
             dest = &sBackupMapData[x0 + desti + j];
             *dest = *src;
+            UpdateMetatileAttributeCacheAt(x0 + j, y + y0);
             i++;
             j++;
         }
@@ -862,6 +955,7 @@ static void ApplyGlobalTintToPaletteEntries(u16 offset, u16 size)
         return;
     }
     CpuCopy16(&gPlttBufferUnfaded[offset], &gPlttBufferFaded[offset], PLTT_SIZEOF(size));
+    MarkPaletteRangeDirty(offset, size);
 }
 
 void ApplyGlobalTintToPaletteSlot(u8 slot, u8 count)
@@ -884,6 +978,7 @@ void ApplyGlobalTintToPaletteSlot(u8 slot, u8 count)
         return;
     }
     CpuFastCopy(&gPlttBufferUnfaded[BG_PLTT_ID(slot)], &gPlttBufferFaded[BG_PLTT_ID(slot)], count * PLTT_SIZE_4BPP);
+    MarkPaletteRangeDirty(BG_PLTT_ID(slot), count * 16);
 }
 
 static void LoadTilesetPalette(struct Tileset const *tileset, u16 destOffset, u16 size)
@@ -79,7 +79,7 @@ u8 RunHelpSystemCallback(void)
         break;
     case 2:
         RequestDma3Fill(0, (void *)BG_CHAR_ADDR(3), BG_CHAR_SIZE, DMA3_16BIT);
-        RequestDma3Copy(sPals, (void *)PLTT, sizeof(sPals), DMA3_16BIT);
+        RequestDma3Copy(sPals, (void *)PLTT, sizeof(sPals), DMA3_16BIT | DMA3_PRIORITY);
         RequestDma3Copy(sTiles, gDecompressionBuffer + 0x3EE0, sizeof(sTiles), DMA3_16BIT);
         sVideoState.state = 3;
         break;
@@ -121,6 +121,7 @@ u8 RunHelpSystemCallback(void)
             *((vu16 *)(PLTT + 0x000 + i)) = sPals[15];
             *((vu16 *)(PLTT + 0x200 + i)) = sPals[15];
         }
+        MarkPalettesDirty(PALETTES_ALL);
         sVideoState.state = 7;
         break;
     case 7:
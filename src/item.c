@@ -491,69 +491,197 @@ void SwapItemSlots(struct ItemSlot * a, struct ItemSlot * b)
     *b = c;
 }
 
+// Moves the empty slots to the end, keeping the order of the others.
 void BagPocketCompaction(struct ItemSlot * slots, u8 capacity)
 {
     u16 i, j;
 
-    for (i = 0; i < capacity - 1; i++)
+    for (i = 0, j = 0; i < capacity; i++)
     {
-        for (j = i + 1; j < capacity; j++)
+        if (GetBagItemQuantity(&slots[i].quantity) != 0)
         {
-            if (GetBagItemQuantity(&slots[i].quantity) == 0)
-            {
+            if (i != j)
                 SwapItemSlots(&slots[i], &slots[j]);
-            }
+            j++;
         }
     }
 }
 
-void SortPocketAndPlaceHMsFirst(struct BagPocket * pocket)
+static void ReverseItemSlots(struct ItemSlot * slots, u16 count)
 {
     u16 i;
-    u16 j = 0;
-    u16 k;
-    struct ItemSlot * buff;
+
+    for (i = 0; i < count / 2; i++)
+        SwapItemSlots(&slots[i], &slots[count - 1 - i]);
+}
+
+// Rotates slots[0..count) left by the given amount, in place.
+static void RotateItemSlots(struct ItemSlot * slots, u16 count, u16 amount)
+{
+    ReverseItemSlots(slots, amount);
+    ReverseItemSlots(slots + amount, count - amount);
+    ReverseItemSlots(slots, count);
+}
+
+void SortPocketAndPlaceHMsFirst(struct BagPocket * pocket)
+{
+    u16 i, count;
 
     SortAndCompactBagPocket(pocket);
 
-    for (i = 0; i < pocket->capacity; i++)
+    for (count = 0; count < pocket->capacity; count++)
+    {
+        if (GetBagItemQuantity(&pocket->itemSlots[count].quantity) == 0)
+            break;
+    }
+
+    // HMs sort after TMs, so move them to the front.
+    for (i = 0; i < count; i++)
     {
-        if (pocket->itemSlots[i].itemId == ITEM_NONE && GetBagItemQuantity(&pocket->itemSlots[i].quantity) == 0)
-            return;
-        if (pocket->itemSlots[i].itemId >= ITEM_HM01 && GetBagItemQuantity(&pocket->itemSlots[i].quantity) != 0)
+        if (pocket->itemSlots[i].itemId >= ITEM_HM01)
         {
-            for (j = i + 1; j < pocket->capacity; j++)
-            {
-                if (pocket->itemSlots[j].itemId == ITEM_NONE && GetBagItemQuantity(&pocket->itemSlots[j].quantity) == 0)
-                    break;
-            }
+            RotateItemSlots(pocket->itemSlots, count, i);
             break;
         }
     }
+}
+
+typedef s32 (*ItemSlotComparator)(const struct ItemSlot *, const struct ItemSlot *);
 
-    for (k = 0; k < pocket->capacity; k++)
-        pocket->itemSlots[k].quantity = GetBagItemQuantity(&pocket->itemSlots[k].quantity);
-    buff = AllocZeroed(pocket->capacity * sizeof(struct ItemSlot));
-    CpuCopy16(pocket->itemSlots + i, buff, (j - i) * sizeof(struct ItemSlot));
-    CpuCopy16(pocket->itemSlots, buff + (j - i), i * sizeof(struct ItemSlot));
-    CpuCopy16(buff, pocket->itemSlots, pocket->capacity * sizeof(struct ItemSlot));
-    for (k = 0; k < pocket->capacity; k++)
-        SetBagItemQuantity(&pocket->itemSlots[k].quantity, pocket->itemSlots[k].quantity);
-    Free(buff);
+// Quantities are decoded before sorting, so the comparators read them
+// directly. Empty slots always sort last.
+static s32 CompareItemSlotsByIndex(const struct ItemSlot *a, const struct ItemSlot *b)
+{
+    if (a->quantity == 0 || b->quantity == 0)
+        return (a->quantity == 0) - (b->quantity == 0);
+    return a->itemId - b->itemId;
 }
 
-void SortAndCompactBagPocket(struct BagPocket * pocket)
+static s32 CompareItemSlotsByName(const struct ItemSlot *a, const struct ItemSlot *b)
+{
+    s32 result;
+
+    if (a->quantity == 0 || b->quantity == 0)
+        return (a->quantity == 0) - (b->quantity == 0);
+    result = StringCompare(ItemId_GetName(a->itemId), ItemId_GetName(b->itemId));
+    if (result == 0)
+        result = a->itemId - b->itemId;
+    return result;
+}
+
+static s32 CompareItemSlotsByType(const struct ItemSlot *a, const struct ItemSlot *b)
+{
+    s32 result;
+
+    if (a->quantity == 0 || b->quantity == 0)
+        return (a->quantity == 0) - (b->quantity == 0);
+    result = ItemId_GetType(a->itemId) - ItemId_GetType(b->itemId);
+    if (result == 0)
+        result = a->itemId - b->itemId;
+    return result;
+}
+
+// Largest quantity first.
+static s32 CompareItemSlotsByAmount(const struct ItemSlot *a, const struct ItemSlot *b)
+{
+    s32 result;
+
+    if (a->quantity == 0 || b->quantity == 0)
+        return (a->quantity == 0) - (b->quantity == 0);
+    result = b->quantity - a->quantity;
+    if (result == 0)
+        result = a->itemId - b->itemId;
+    return result;
+}
+
+static const ItemSlotComparator sItemSlotComparators[ITEM_SORT_COUNT] =
+{
+    [ITEM_SORT_BY_INDEX] = CompareItemSlotsByIndex,
+    [ITEM_SORT_BY_NAME] = CompareItemSlotsByName,
+    [ITEM_SORT_BY_TYPE] = CompareItemSlotsByType,
+    [ITEM_SORT_BY_AMOUNT] = CompareItemSlotsByAmount,
+};
+
+// Runs shorter than this are insertion sorted before merging.
+#define ITEM_SORT_RUN_LENGTH 8
+
+static void InsertionSortItemSlots(struct ItemSlot * slots, u16 count, ItemSlotComparator compare)
 {
     u16 i, j;
+    struct ItemSlot slot;
 
-    for (i = 0; i < pocket->capacity; i++)
+    for (i = 1; i < count; i++)
     {
-        for (j = i + 1; j < pocket->capacity; j++)
-        {
-            if (GetBagItemQuantity(&pocket->itemSlots[i].quantity) == 0 || (GetBagItemQuantity(&pocket->itemSlots[j].quantity) != 0 && pocket->itemSlots[i].itemId > pocket->itemSlots[j].itemId))
-                SwapItemSlots(&pocket->itemSlots[i], &pocket->itemSlots[j]);
-        }
+        slot = slots[i];
+        for (j = i; j > 0 && compare(&slots[j - 1], &slot) > 0; j--)
+            slots[j] = slots[j - 1];
+        slots[j] = slot;
+    }
+}
+
+// Merges slots[0..middle) and slots[middle..count), copying the first
+// run to buffer. Stable: ties are taken from the first run.
+static void MergeItemSlots(struct ItemSlot * slots, u16 middle, u16 count, struct ItemSlot * buffer, ItemSlotComparator compare)
+{
+    u16 i = 0, j = middle, k = 0;
+
+    // Already in order, e.g. a pocket which was sorted before.
+    if (compare(&slots[middle - 1], &slots[middle]) <= 0)
+        return;
+
+    memcpy(buffer, slots, middle * sizeof(struct ItemSlot));
+    while (i < middle && j < count)
+    {
+        if (compare(&slots[j], &buffer[i]) < 0)
+            slots[k++] = slots[j++];
+        else
+            slots[k++] = buffer[i++];
+    }
+    while (i < middle)
+        slots[k++] = buffer[i++];
+}
+
+static void SortItemSlots(struct ItemSlot * slots, u16 count, ItemSlotComparator compare)
+{
+    u16 start, width;
+    u32 mark;
+    struct ItemSlot *buffer;
+
+    for (start = 0; start < count; start += ITEM_SORT_RUN_LENGTH)
+        InsertionSortItemSlots(slots + start, min(ITEM_SORT_RUN_LENGTH, count - start), compare);
+
+    if (count <= ITEM_SORT_RUN_LENGTH)
+        return;
+
+    mark = ArenaMark(&gFrameArena);
+    buffer = FrameAlloc(count * sizeof(struct ItemSlot));
+    for (width = ITEM_SORT_RUN_LENGTH; width < count; width *= 2)
+    {
+        for (start = 0; start + width < count; start += 2 * width)
+            MergeItemSlots(slots + start, width, min(2 * width, count - start), buffer, compare);
     }
+    ArenaResetToMark(&gFrameArena, mark);
+}
+
+// Sorts the pocket by one of the ITEM_SORT_* keys, moving empty slots to
+// the end. The sort is stable. Unknown keys sort by index.
+void SortBagPocket(struct BagPocket * pocket, u8 sortKey)
+{
+    u16 i;
+
+    AGB_ASSERT(sortKey < ITEM_SORT_COUNT);
+    if (sortKey >= ITEM_SORT_COUNT)
+        sortKey = ITEM_SORT_BY_INDEX;
+    for (i = 0; i < pocket->capacity; i++)
+        pocket->itemSlots[i].quantity = GetBagItemQuantity(&pocket->itemSlots[i].quantity);
+    SortItemSlots(pocket->itemSlots, pocket->capacity, sItemSlotComparators[sortKey]);
+    for (i = 0; i < pocket->capacity; i++)
+        SetBagItemQuantity(&pocket->itemSlots[i].quantity, pocket->itemSlots[i].quantity);
+}
+
+void SortAndCompactBagPocket(struct BagPocket * pocket)
+{
+    SortBagPocket(pocket, ITEM_SORT_BY_INDEX);
 }
 
 u16 BagGetItemIdByPocketPosition(u8 pocketId, u16 slotId)
@@ -6,6 +6,7 @@
 
 #include "agb_flash.h"
 #include "berry_powder.h"
+#include "event_object_movement.h"
 #include "fake_rtc.h"
 #include "item.h"
 #include "load_save.h"
@@ -218,6 +219,7 @@ void LoadObjectEvents(void)
             gObjectEvents[i].graphicsId >= OBJ_EVENT_GFX_MON_BASE)
             gObjectEvents[i].active = TRUE;
     }
+    RebuildObjectEventOccupancy();
 }
 
 void SaveSerializedGame(void)
@@ -101,6 +101,7 @@ void AgbMain()
     ResetBgs();
     SetDefaultFontsPointer();
     InitHeap(gHeap, HEAP_SIZE);
+    InitArena(&gFrameArena, gHeap + HEAP_SIZE, FRAME_ARENA_SIZE);
 
     gSoftResetDisabled = FALSE;
     gHelpSystemEnabled = FALSE;
@@ -127,6 +128,7 @@ void AgbMainLoop(void)
 {
     for (;;)
     {
+        ArenaReset(&gFrameArena);
         ReadKeys();
 
         if (gSoftResetDisabled == FALSE
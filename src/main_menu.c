@@ -537,6 +537,7 @@ static void Task_ExecuteMainMenuSelection(u8 taskId)
         case MAIN_MENU_CONTINUE:
             gPlttBufferUnfaded[0] = RGB_BLACK;
             gPlttBufferFaded[0] = RGB_BLACK;
+            MarkPaletteRangeDirty(0, 1);
             gExitStairsMovementDisabled = FALSE;
             FreeAllWindowBuffers();
             TryStartQuestLogPlayback(taskId);
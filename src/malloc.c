@@ -7,7 +7,8 @@
 static void *sHeapStart;
 static u32 sHeapSize;
 
-ALIGNED(4) EWRAM_DATA u8 gHeap[HEAP_SIZE] = {0};
+ALIGNED(4) EWRAM_DATA u8 gHeap[HEAP_SIZE + FRAME_ARENA_SIZE] = {0};
+EWRAM_DATA struct Arena gFrameArena = {0};
 
 void PutMemBlockHeader(void *block, struct MemBlock *prev, struct MemBlock *next, u32 size)
 {
@@ -160,12 +161,7 @@ void *AllocZeroedInternal(void *heapStart, u32 size, const char *location)
     void *mem = AllocInternal(heapStart, size, location);
 
     if (mem != NULL)
-    {
-        if (size & 3)
-            size = 4 * ((size / 4) + 1);
-
-        CpuFill32(0, mem, size);
-    }
+        CpuFill32(0, mem, ARENA_ALLOC_SIZE(size));
 
     return mem;
 }
@@ -236,6 +232,77 @@ bool32 CheckHeap()
     return TRUE;
 }
 
+void InitArena(struct Arena *arena, void *base, u32 size)
+{
+    arena->base = base;
+    arena->size = size;
+    arena->used = 0;
+}
+
+struct Arena *ArenaCreate_(u32 size, const char *location)
+{
+    // The arena's header and its memory share a single heap block, so
+    // creating and destroying an arena costs one Alloc and one Free.
+    struct Arena *arena = AllocInternal(sHeapStart, sizeof(struct Arena) + size, location);
+
+    if (arena != NULL)
+        InitArena(arena, (u8 *)(arena + 1), size);
+
+    return arena;
+}
+
+void ArenaDestroy(struct Arena *arena)
+{
+    Free(arena);
+}
+
+void *ArenaAlloc(struct Arena *arena, u32 size)
+{
+    void *mem;
+
+    size = ARENA_ALLOC_SIZE(size);
+    if (arena->size - arena->used < size)
+    {
+#if TESTING
+        Test_ExitWithResult(TEST_RESULT_ERROR, SourceLine(0), ":L%s:%d: OOM allocating %d bytes from arena (%d/%d used)", gTestRunnerState.test->filename, SourceLine(0), size, arena->used, arena->size);
+#endif
+        AGB_ASSERT(0);
+        return NULL;
+    }
+
+    mem = arena->base + arena->used;
+    arena->used += size;
+    return mem;
+}
+
+void *ArenaAllocZeroed(struct Arena *arena, u32 size)
+{
+    void *mem = ArenaAlloc(arena, size);
+
+    if (mem != NULL)
+        CpuFill32(0, mem, ARENA_ALLOC_SIZE(size));
+
+    return mem;
+}
+
+void ArenaReset(struct Arena *arena)
+{
+    arena->used = 0;
+}
+
+// Marks let a function release only the memory it took from a shared
+// arena (e.g. gFrameArena) once it is done with it.
+u32 ArenaMark(const struct Arena *arena)
+{
+    return arena->used;
+}
+
+void ArenaResetToMark(struct Arena *arena, u32 mark)
+{
+    AGB_ASSERT(mark <= arena->used);
+    arena->used = mark;
+}
+
 const struct MemBlock *HeapHead(void)
 {
     return (const struct MemBlock *)sHeapStart;
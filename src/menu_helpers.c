@@ -146,6 +146,7 @@ void ResetVramOamAndBgCntRegs(void)
     CpuFill16(0, (void *) VRAM, VRAM_SIZE);
     CpuFill32(0, (void *) OAM, OAM_SIZE);
     CpuFill16(0, (void *) PLTT, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 void ResetAllBgsCoordinates(void)
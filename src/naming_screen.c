@@ -991,6 +991,7 @@ static void RestoreButtonColor(u8 button)
 {
     u16 index = GetButtonPalOffset(button);
     gPlttBufferFaded[index] = gPlttBufferUnfaded[index];
+    MarkPaletteRangeDirty(index, 1);
 }
 
 static void StartButtonFlash(struct Task *task, u8 button, u8 keepFlashing)
@@ -691,6 +691,7 @@ void StartNewGameScene(void)
 {
     gPlttBufferUnfaded[0] = RGB_BLACK;
     gPlttBufferFaded[0]   = RGB_BLACK;
+    MarkPaletteRangeDirty(0, 1);
     CreateTask(Task_NewGameScene, 0);
     SetMainCallback2(CB2_NewGameScene);
 }
@@ -1769,6 +1770,7 @@ static void Task_OakSpeech_FadePlayerPicWhite(u8 taskId)
                 gPlttBufferFaded[i + BG_PLTT_ID(4)] = RGB_WHITE;
                 gPlttBufferUnfaded[i + BG_PLTT_ID(4)] = RGB_WHITE;
             }
+            MarkPaletteRangeDirty(BG_PLTT_ID(4), 32);
             DestroyTask(taskId);
         }
     }
@@ -2245,6 +2245,7 @@ static void ResetScreenForMapLoad(void)
     ScanlineEffect_Stop();
 
     DmaClear16(3, PLTT + 2, PLTT_SIZE - 2);
+    MarkPalettesDirty(PALETTES_ALL);
     DmaFillLarge16(3, 0, (void *)(VRAM + 0x0), 0x18000, 0x1000);
     ResetOamRange(0, 128);
     LoadOam();
@@ -3488,6 +3489,7 @@ static void InitLinkPlayerObjectEventPos(struct ObjectEvent *objEvent, s16 x, s1
     objEvent->currentCoords.y = y;
     objEvent->previousCoords.x = x;
     objEvent->previousCoords.y = y;
+    UpdateObjectEventOccupancy(objEvent);
     SetSpritePosToMapCoords(x, y, &objEvent->initialCoords.x, &objEvent->initialCoords.y);
     objEvent->initialCoords.x += 8;
     ObjectEventUpdateElevation(objEvent, NULL);
@@ -25,6 +25,8 @@ ALIGNED(4) EWRAM_DATA u16 gPlttBufferUnfaded[PLTT_BUFFER_SIZE] = {0};
 ALIGNED(4) EWRAM_DATA u16 gPlttBufferFaded[PLTT_BUFFER_SIZE] = {0};
 EWRAM_DATA struct PaletteFadeControl gPaletteFade = {0};
 static EWRAM_DATA u32 sPlttBufferTransferPending = 0;
+// Palettes of gPlttBufferFaded changed since the last TransferPlttBuffer.
+static EWRAM_DATA u32 sDirtyPalettes = 0;
 
 static const u8 sRoundedDownGrayscaleMap[] =
 {
@@ -37,32 +39,83 @@ static const u8 sRoundedDownGrayscaleMap[] =
     31, 31
 };
 
+void MarkPalettesDirty(u32 selectedPalettes)
+{
+    sDirtyPalettes |= selectedPalettes;
+}
+
+// For functions which take a palette pointer that may point into gPlttBufferFaded.
+static void MarkBufferRangeDirty(const u16 *dst, u32 numColors)
+{
+    if (dst >= gPlttBufferFaded && dst < gPlttBufferFaded + PLTT_BUFFER_SIZE)
+        MarkPaletteRangeDirty(dst - gPlttBufferFaded, numColors);
+}
+
+static void MarkBufferPalettesDirty(const u16 *dst, u32 selectedPalettes)
+{
+    if (dst >= gPlttBufferFaded && dst < gPlttBufferFaded + PLTT_BUFFER_SIZE)
+    {
+        u32 offset = dst - gPlttBufferFaded;
+        if (offset % 16 == 0)
+            MarkPalettesDirty(selectedPalettes << (offset / 16));
+        else
+            MarkPalettesDirty(PALETTES_ALL);
+    }
+}
+
 void LoadCompressedPalette(const u32 *src, u32 offset, u32 size)
 {
     LZDecompressWram(src, gDecompressionBuffer);
     CpuCopy16(gDecompressionBuffer, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(gDecompressionBuffer, &gPlttBufferFaded[offset], size);
+    MarkPaletteRangeDirty(offset, size / sizeof(u16));
 }
 
 void LoadPalette(const void *src, u32 offset, u32 size)
 {
     CpuCopy16(src, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(src, &gPlttBufferFaded[offset], size);
+    MarkPaletteRangeDirty(offset, size / sizeof(u16));
 }
 
 void FillPalette(u32 value, u32 offset, u32 size)
 {
     CpuFill16(value, &gPlttBufferUnfaded[offset], size);
     CpuFill16(value, &gPlttBufferFaded[offset], size);
+    MarkPaletteRangeDirty(offset, size / sizeof(u16));
 }
 
 void TransferPlttBuffer(void)
 {
     if (!gPaletteFade.bufferTransferDisabled)
     {
-        void *src = gPlttBufferFaded;
-        void *dest = (void *)PLTT;
-        DmaCopy16(3, src, dest, PLTT_SIZE);
+        u32 dirty = sDirtyPalettes;
+
+        if (dirty == PALETTES_ALL)
+        {
+            void *src = gPlttBufferFaded;
+            void *dest = (void *)PLTT;
+            DmaCopy16(3, src, dest, PLTT_SIZE);
+        }
+        else
+        {
+            // Upload each run of consecutive dirty palettes with one DMA.
+            u32 start = 0, count;
+
+            while (dirty)
+            {
+                while (!(dirty & 1))
+                {
+                    dirty >>= 1;
+                    start++;
+                }
+                for (count = 0; dirty & 1; count++)
+                    dirty >>= 1;
+                DmaCopy16(3, &gPlttBufferFaded[PLTT_ID(start)], (void *)(PLTT + PLTT_OFFSET_4BPP(start)), count * PLTT_SIZE_4BPP);
+                start += count;
+            }
+        }
+        sDirtyPalettes = 0;
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
@@ -124,6 +177,7 @@ bool32 BeginNormalPaletteFade(u32 selectedPalettes, s8 delay, u8 startY, u8 targ
         temp = gPaletteFade.bufferTransferDisabled;
         gPaletteFade.bufferTransferDisabled = FALSE;
         CpuCopy32(gPlttBufferFaded, (void *)PLTT, PLTT_SIZE);
+        sDirtyPalettes = 0;
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
@@ -174,6 +228,7 @@ bool32 BeginTimeOfDayPaletteFade(u32 selectedPalettes, s8 delay, u8 startY, u8 t
         temp = gPaletteFade.bufferTransferDisabled;
         gPaletteFade.bufferTransferDisabled = 0;
         CpuCopy32(gPlttBufferFaded, (void *)PLTT, PLTT_SIZE);
+        sDirtyPalettes = 0;
         sPlttBufferTransferPending = 0;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
@@ -200,6 +255,9 @@ void ResetPaletteFadeControl(void)
     gPaletteFade.softwareFadeFinishingCounter = 0;
     gPaletteFade.objPaletteToggle = 0;
     gPaletteFade.deltaY = 2;
+    // Screens often write PLTT directly before resetting the fade, so
+    // upload the whole buffer again.
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 // Like normal palette fade, but respects sprite/tile palettes immune to time of day fading
@@ -265,6 +323,7 @@ static u8 UpdateTimeOfDayPaletteFade(void)
     {
         u16 * src1 = src;
         u16 * dst1 = dst;
+        MarkBufferPalettesDirty(dst, copyPalettes & 0xFFFF);
         while (copyPalettes)
         {
             if (copyPalettes & 1)
@@ -397,6 +456,8 @@ void InvertPlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -415,6 +476,8 @@ void TintPlttBuffer(u32 selectedPalettes, s8 r, s8 g, s8 b)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -437,6 +500,8 @@ void UnfadePlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -466,6 +531,7 @@ static void BeginFastPaletteFadeInternal(u32 submode)
         CpuFill16(RGB_BLACK, gPlttBufferFaded, PLTT_SIZE);
     if (submode == FAST_FADE_IN_FROM_WHITE)
         CpuFill16(RGB_WHITE, gPlttBufferFaded, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
     UpdatePaletteFade();
 }
 
@@ -483,11 +549,13 @@ static u32 UpdateFastPaletteFade(void)
     {
         paletteOffsetStart = OBJ_PLTT_OFFSET;
         paletteOffsetEnd = PLTT_BUFFER_SIZE;
+        MarkPalettesDirty(PALETTES_OBJECTS);
     }
     else
     {
         paletteOffsetStart = 0;
         paletteOffsetEnd = OBJ_PLTT_OFFSET;
+        MarkPalettesDirty(PALETTES_BG);
     }
     switch (gPaletteFade_submode)
     {
@@ -595,6 +663,7 @@ static u32 UpdateFastPaletteFade(void)
             CpuFill32(0x00000000, gPlttBufferFaded, PLTT_SIZE);
             break;
         }
+        MarkPalettesDirty(PALETTES_ALL);
         gPaletteFade.mode = NORMAL_FADE;
         gPaletteFade.softwareFadeFinishing = TRUE;
     }
@@ -698,6 +767,56 @@ static bool32 IsSoftwarePaletteFadeFinishing(void)
     }
 }
 
+// Palette blending kernels. These run from IWRAM as ARM code and load two
+// colours per 32-bit word. The channels are masked apart so that one
+// multiply blends the same channel of both colours. Each channel field has
+// room for the full product, so the results match the per-channel formulas
+// exactly.
+
+#define LANES(x) ((x) * 0x00010001u)
+#define LANE_MASK LANES(0x1F)
+
+// BlendPalettesFine fits three channels with 10 bits of room in one word:
+// red and blue of the low colour with green of the high one, and the
+// remaining three once shifted down by 5.
+#define FINE_MASK_A 0x03E07C1F
+#define FINE_MASK_B 0x03E0F81F
+
+#define IS_WORD_ALIGNED(ptr) (((uintptr_t)(ptr) & 3) == 0)
+
+// r + (((n - r) * coeff) >> 5) is the same as (r * (32 - coeff) + n * coeff) >> 5
+// for coeff in [0, 32], which has no negative terms to spill across fields.
+ARM_FUNC IWRAM_CODE NOINLINE static void BlendPalettesFine_Arm(u32 palettes, const u32 *src, u32 *dst, u32 coeff, u32 color)
+{
+    u32 colors = LANES(color & 0x7FFF);
+    u32 addA = (colors & FINE_MASK_A) * coeff;
+    u32 addB = ((colors >> 5) & FINE_MASK_B) * coeff;
+
+    coeff = 32 - coeff;
+    do
+    {
+        if (palettes & 1)
+        {
+            const u32 *srcEnd = src + 8;
+            while (src != srcEnd)
+            {
+                u32 pair = *src++;
+                u32 a = ((pair & FINE_MASK_A) * coeff + addA) >> 5;
+                u32 b = (((pair >> 5) & FINE_MASK_B) * coeff + addB) >> 5;
+
+                // Transparency is kept (and blended, for backdrop reasons)
+                *dst++ = (a & FINE_MASK_A) | ((b & FINE_MASK_B) << 5) | (pair & LANES(RGB_ALPHA));
+            }
+        }
+        else
+        {
+            src += 8;
+            dst += 8;
+        }
+        palettes >>= 1;
+    } while (palettes);
+}
+
 // optimized based on lucktyphlosion's BlendPalettesFine
 void BlendPalettesFine(u32 palettes, u16 *src, u16 *dst, u32 coeff, u32 color)
 {
@@ -706,7 +825,14 @@ void BlendPalettesFine(u32 palettes, u16 *src, u16 *dst, u32 coeff, u32 color)
     if (!palettes)
         return;
 
+    MarkBufferPalettesDirty(dst, palettes);
     coeff *= 2;
+    if (coeff <= 32 && IS_WORD_ALIGNED(src) && IS_WORD_ALIGNED(dst))
+    {
+        BlendPalettesFine_Arm(palettes, (const u32 *)src, (u32 *)dst, coeff, color);
+        return;
+    }
+
     newR = (color << 27) >> 27;
     newG = (color << 22) >> 27;
     newB = (color << 17) >> 27;
@@ -763,6 +889,7 @@ void TimeBlendPalette(u16 palOffset, u32 coeff, u32 blendColor)
     u16 *srcEnd = src + 16;
     u32 altBlendColor = *dst++ = *src++; // color 0 is copied through unchanged
 
+    MarkPaletteRangeDirty(palOffset, 16);
     coeff *= 2;
     newR = (blendColor << 27) >> 27;
     newG = (blendColor << 22) >> 27;
@@ -805,151 +932,239 @@ void TimeBlendPalette(u16 palOffset, u32 coeff, u32 blendColor)
     }
 }
 
-// Blends a weighted average of two blend parameters
-// Parameters can be either blended (as in BlendPalettes) or tinted (as in TintPaletteRGB_Copy)
-void TimeMixPalettes(u32 palettes, u16 *src, u16 *dst, struct BlendSettings *blend0, struct BlendSettings *blend1, u16 weight0)
+struct TimeMixParams
 {
-    s32 r0, g0, b0, r1, g1, b1, defR, defG, defB, altR, altG, altB;
-    u32 color0, coeff0, color1, coeff1;
-    bool8 tint0, tint1;
-    u32 defaultColor = DEFAULT_LIGHT_COLOR;
+    s32 r0, g0, b0, r1, g1, b1;
+    u32 coeff0, coeff1;
+    bool32 tint0, tint1;
+    // Used by colors with the transparency bit set.
+    s32 altR, altG, altB;
+    u32 weight0;
+};
 
-    if (!palettes)
-    return;
+// One channel of a blend setting, as ((x * mul + add) >> shift) per lane.
+struct TimeMixLane
+{
+    u32 mul[3];
+    u32 add[3];
+    u32 shift;
+};
 
-    color0 = blend0->blendColor;
-    tint0 = blend0->isTint;
-    coeff0 = tint0 ? 8*2 : blend0->coeff*2;
-    color1 = blend1->blendColor;
-    tint1 = blend1->isTint;
-    coeff1 = tint1 ? 8*2 : blend1->coeff*2;
+static void InitTimeMixParams(struct TimeMixParams *params, const struct BlendSettings *blend0, const struct BlendSettings *blend1, u32 weight0)
+{
+    u32 color0 = blend0->blendColor;
+    u32 color1 = blend1->blendColor;
 
-    if (tint0)
+    params->tint0 = blend0->isTint;
+    params->coeff0 = params->tint0 ? 8*2 : blend0->coeff*2;
+    params->tint1 = blend1->isTint;
+    params->coeff1 = params->tint1 ? 8*2 : blend1->coeff*2;
+    params->weight0 = weight0;
+
+    if (params->tint0)
+    {
+        params->r0 = (color0 << 24) >> 24;
+        params->g0 = (color0 << 16) >> 24;
+        params->b0 = (color0 << 8) >> 24;
+    }
+    else
+    {
+        params->r0 = (color0 << 27) >> 27;
+        params->g0 = (color0 << 22) >> 27;
+        params->b0 = (color0 << 17) >> 27;
+    }
+    if (params->tint1)
     {
-        r0 = (color0 << 24) >> 24;
-        g0 = (color0 << 16) >> 24;
-        b0 = (color0 << 8) >> 24;
+        params->r1 = (color1 << 24) >> 24;
+        params->g1 = (color1 << 16) >> 24;
+        params->b1 = (color1 << 8) >> 24;
     }
     else
     {
-        r0 = (color0 << 27) >> 27;
-        g0 = (color0 << 22) >> 27;
-        b0 = (color0 << 17) >> 27;
+        params->r1 = (color1 << 27) >> 27;
+        params->g1 = (color1 << 22) >> 27;
+        params->b1 = (color1 << 17) >> 27;
     }
-    if (tint1)
+}
+
+// Palettes whose color 0 has the transparency bit set use it as the blend
+// color for their other transparent colors instead of the default.
+// This and TimeMixColor are always inlined, so that TimeMixPalettes_Arm
+// does not call Thumb code in ROM.
+static inline __attribute__((always_inline)) void SetTimeMixAltColor(struct TimeMixParams *params, u32 altBlendColor)
+{
+    if (!(altBlendColor >> 15))
+        altBlendColor = DEFAULT_LIGHT_COLOR;
+    params->altR = (altBlendColor << 27) >> 27;
+    params->altG = (altBlendColor << 22) >> 27;
+    params->altB = (altBlendColor << 17) >> 27;
+}
+
+static inline __attribute__((always_inline)) u32 TimeMixColor(u32 srcColor, const struct TimeMixParams *params)
+{
+    s32 r = (srcColor << 27) >> 27;
+    s32 g = (srcColor << 22) >> 27;
+    s32 b = (srcColor << 17) >> 27;
+    s32 r2, g2, b2;
+    s32 coeff0 = params->coeff0;
+    s32 coeff1 = params->coeff1;
+
+    if (srcColor >> 15)
     {
-        r1 = (color1 << 24) >> 24;
-        g1 = (color1 << 16) >> 24;
-        b1 = (color1 << 8) >> 24;
+        // Use alternate or default blend color
+        r2 = r + (((params->altR - r) * coeff1) >> 5);
+        g2 = g + (((params->altG - g) * coeff1) >> 5);
+        b2 = b + (((params->altB - b) * coeff1) >> 5);
+        r  = r + (((params->altR - r) * coeff0) >> 5);
+        g  = g + (((params->altG - g) * coeff0) >> 5);
+        b  = b + (((params->altB - b) * coeff0) >> 5);
     }
     else
     {
-        r1 = (color1 << 27) >> 27;
-        g1 = (color1 << 22) >> 27;
-        b1 = (color1 << 17) >> 27;
+        // Use provided blend colors
+        if (!params->tint1)
+        {
+            // blend-based
+            r2 = (r + (((params->r1 - r) * coeff1) >> 5));
+            g2 = (g + (((params->g1 - g) * coeff1) >> 5));
+            b2 = (b + (((params->b1 - b) * coeff1) >> 5));
+        }
+        else
+        {
+            // tint-based
+            r2 = (u16)((params->r1 * r)) >> 8;
+            g2 = (u16)((params->g1 * g)) >> 8;
+            b2 = (u16)((params->b1 * b)) >> 8;
+            if (r2 > 31)
+                r2 = 31;
+            if (g2 > 31)
+                g2 = 31;
+            if (b2 > 31)
+                b2 = 31;
+        }
+        if (!params->tint0)
+        {
+            // blend-based
+            r = (r + (((params->r0 - r) * coeff0) >> 5));
+            g = (g + (((params->g0 - g) * coeff0) >> 5));
+            b = (b + (((params->b0 - b) * coeff0) >> 5));
+        }
+        else
+        {
+            // tint-based
+            r = (u16)((params->r0 * r)) >> 8;
+            g = (u16)((params->g0 * g)) >> 8;
+            b = (u16)((params->b0 * b)) >> 8;
+            if (r > 31)
+                r = 31;
+            if (g > 31)
+                g = 31;
+            if (b > 31)
+                b = 31;
+        }
+    }
+    r  = r2 + (((r - r2) * (s32)params->weight0) >> 8);
+    g  = g2 + (((g - g2) * (s32)params->weight0) >> 8);
+    b  = b2 + (((b - b2) * (s32)params->weight0) >> 8);
+    return RGB2(r, g, b);
+}
+
+// Tinted channels never exceed 31 (255 * 31 >> 8 == 30), so only blends
+// with coeff above 32 and weights above 256 need the per-channel path.
+static bool32 InitTimeMixLane(struct TimeMixLane *lane, bool32 tint, u32 coeff, s32 r, s32 g, s32 b)
+{
+    if (tint)
+    {
+        lane->mul[0] = r;
+        lane->mul[1] = g;
+        lane->mul[2] = b;
+        lane->add[0] = lane->add[1] = lane->add[2] = 0;
+        lane->shift = 8;
+        return TRUE;
     }
-    defR = (defaultColor << 27) >> 27;
-    defG = (defaultColor << 22) >> 27;
-    defB = (defaultColor << 17) >> 27;
+    if (coeff > 32)
+        return FALSE;
+    lane->mul[0] = lane->mul[1] = lane->mul[2] = 32 - coeff;
+    lane->add[0] = LANES(r * coeff);
+    lane->add[1] = LANES(g * coeff);
+    lane->add[2] = LANES(b * coeff);
+    lane->shift = 5;
+    return TRUE;
+}
+
+ARM_FUNC IWRAM_CODE NOINLINE static void TimeMixPalettes_Arm(u32 palettes, const u32 *src, u32 *dst, struct TimeMixParams *params, const struct TimeMixLane *lanes)
+{
+    u32 weight0 = params->weight0;
+    u32 weight1 = 256 - weight0;
 
     do
     {
         if (palettes & 1)
         {
-            u16 *srcEnd = src + 16;
-            u32 altBlendColor = *dst++ = *src++; // color 0 is copied through
-            if (altBlendColor >> 15) // Transparency high bit set; alt blend color
-            {
-                altR = (altBlendColor << 27) >> 27;
-                altG = (altBlendColor << 22) >> 27;
-                altB = (altBlendColor << 17) >> 27;
-            }
-            else
-            {
-                altBlendColor = 0;
-            }
+            const u32 *srcEnd = src + 8;
+            u32 color0 = *(const u16 *)src; // color 0 is copied through
+
+            SetTimeMixAltColor(params, color0);
             while (src != srcEnd)
             {
-                u32 srcColor = *src;
-                s32 r = (srcColor << 27) >> 27;
-                s32 g = (srcColor << 22) >> 27;
-                s32 b = (srcColor << 17) >> 27;
-                s32 r2, g2, b2;
+                u32 pair = *src++;
+                u32 mixed = 0;
+                u32 i, shift;
 
-                if (srcColor >> 15)
+                for (i = 0, shift = 0; i < 3; i++, shift += 5)
                 {
-                    if (altBlendColor)
-                    {
-                        // Use alternate blend color
-                        r2 = r + (((altR - r) * (s32)coeff1) >> 5);
-                        g2 = g + (((altG - g) * (s32)coeff1) >> 5);
-                        b2 = b + (((altB - b) * (s32)coeff1) >> 5);
-                        r  = r + (((altR - r) * (s32)coeff0) >> 5);
-                        g  = g + (((altG - g) * (s32)coeff0) >> 5);
-                        b  = b + (((altB - b) * (s32)coeff0) >> 5);
-                    }
-                    else
-                    {
-                        // Use default blend color
-                        r2 = r + (((defR - r) * (s32)coeff1) >> 5);
-                        g2 = g + (((defG - g) * (s32)coeff1) >> 5);
-                        b2 = b + (((defB - b) * (s32)coeff1) >> 5);
-                        r  = r + (((defR - r) * (s32)coeff0) >> 5);
-                        g  = g + (((defG - g) * (s32)coeff0) >> 5);
-                        b  = b + (((defB - b) * (s32)coeff0) >> 5);
-                    }
+                    u32 x = (pair >> shift) & LANE_MASK;
+                    u32 x0 = ((x * lanes[0].mul[i] + lanes[0].add[i]) >> lanes[0].shift) & LANE_MASK;
+                    u32 x1 = ((x * lanes[1].mul[i] + lanes[1].add[i]) >> lanes[1].shift) & LANE_MASK;
+                    mixed |= (((x0 * weight0 + x1 * weight1) >> 8) & LANE_MASK) << shift;
                 }
-                else
+                if (pair & LANES(RGB_ALPHA))
                 {
-                    // Use provided blend colors
-                    if (!tint1)
-                    {
-                        // blend-based
-                        r2 = (r + (((r1 - r) * (s32)coeff1) >> 5));
-                        g2 = (g + (((g1 - g) * (s32)coeff1) >> 5));
-                        b2 = (b + (((b1 - b) * (s32)coeff1) >> 5));
-                    }
-                    else
-                    {
-                        // tint-based
-                        r2 = (u16)((r1 * r)) >> 8;
-                        g2 = (u16)((g1 * g)) >> 8;
-                        b2 = (u16)((b1 * b)) >> 8;
-                        if (r2 > 31)
-                            r2 = 31;
-                        if (g2 > 31)
-                            g2 = 31;
-                        if (b2 > 31)
-                            b2 = 31;
-                    }
-                    if (!tint0)
-                    {
-                        // blend-based
-                        r = (r + (((r0 - r) * (s32)coeff0) >> 5));
-                        g = (g + (((g0 - g) * (s32)coeff0) >> 5));
-                        b = (b + (((b0 - b) * (s32)coeff0) >> 5));
-                    }
-                    else
-                    {
-                        // tint-based
-                        r = (u16)((r0 * r)) >> 8;
-                        g = (u16)((g0 * g)) >> 8;
-                        b = (u16)((b0 * b)) >> 8;
-                        if (r > 31)
-                            r = 31;
-                        if (g > 31)
-                            g = 31;
-                        if (b > 31)
-                            b = 31;
-                    }
+                    if (pair & RGB_ALPHA)
+                        mixed = (mixed & 0xFFFF0000) | TimeMixColor(pair & 0xFFFF, params);
+                    if (pair >> 31)
+                        mixed = (mixed & 0xFFFF) | (TimeMixColor(pair >> 16, params) << 16);
                 }
-                r  = r2 + (((r - r2) * (s32)weight0) >> 8);
-                g  = g2 + (((g - g2) * (s32)weight0) >> 8);
-                b  = b2 + (((b - b2) * (s32)weight0) >> 8);
-                *dst++ = RGB2(r, g, b);
-                // *dst++ = RGB2(r, g, b) | (srcColor >> 15) << 15;
-                src++;
+                *dst++ = mixed;
             }
+            *(u16 *)(dst - 8) = color0;
+        }
+        else
+        {
+            src += 8;
+            dst += 8;
+        }
+        palettes >>= 1;
+    } while (palettes);
+}
+
+// Blends a weighted average of two blend parameters
+// Parameters can be either blended (as in BlendPalettes) or tinted (as in TintPaletteRGB_Copy)
+void TimeMixPalettes(u32 palettes, u16 *src, u16 *dst, struct BlendSettings *blend0, struct BlendSettings *blend1, u16 weight0)
+{
+    struct TimeMixParams params;
+    struct TimeMixLane lanes[2];
+
+    MarkBufferPalettesDirty(dst, palettes);
+    InitTimeMixParams(&params, blend0, blend1, weight0);
+    if (weight0 <= 256 && IS_WORD_ALIGNED(src) && IS_WORD_ALIGNED(dst)
+     && InitTimeMixLane(&lanes[0], params.tint0, params.coeff0, params.r0, params.g0, params.b0)
+     && InitTimeMixLane(&lanes[1], params.tint1, params.coeff1, params.r1, params.g1, params.b1))
+    {
+        TimeMixPalettes_Arm(palettes, (const u32 *)src, (u32 *)dst, &params, lanes);
+        return;
+    }
+
+    do
+    {
+        if (palettes & 1)
+        {
+            u16 *srcEnd = src + 16;
+
+            SetTimeMixAltColor(&params, *src);
+            *dst++ = *src++; // color 0 is copied through
+            while (src != srcEnd)
+                *dst++ = TimeMixColor(*src++, &params);
         }
         else
         {
@@ -960,10 +1175,38 @@ void TimeMixPalettes(u32 palettes, u16 *src, u16 *dst, struct BlendSettings *ble
     } while (palettes);
 }
 
+// r1 + (((r0 - r1) * weight0) >> 8) is the same as (r0 * weight0 + r1 * (256 - weight0)) >> 8
+// for weight0 in [0, 256].
+ARM_FUNC IWRAM_CODE NOINLINE static void AvgPaletteWeighted_Arm(const u32 *src0, const u32 *src1, u32 *dst, u32 weight0)
+{
+    const u32 *srcEnd = src0 + 8;
+    u32 weight1 = 256 - weight0;
+    u32 color0 = *(u16 *)dst;
+
+    while (src0 != srcEnd)
+    {
+        u32 pair0 = *src0++;
+        u32 pair1 = *src1++;
+        u32 r = (((pair0 & LANE_MASK) * weight0 + (pair1 & LANE_MASK) * weight1) >> 8) & LANE_MASK;
+        u32 g = ((((pair0 >> 5) & LANE_MASK) * weight0 + ((pair1 >> 5) & LANE_MASK) * weight1) >> 8) & LANE_MASK;
+        u32 b = ((((pair0 >> 10) & LANE_MASK) * weight0 + ((pair1 >> 10) & LANE_MASK) * weight1) >> 8) & LANE_MASK;
+
+        *dst = (*dst & LANES(RGB_ALPHA)) | r | (g << 5) | (b << 10);
+        dst++;
+    }
+    *(u16 *)(dst - 8) = color0; // leave dst transparency unchanged
+}
+
 // Apply weighted average to palettes, preserving high bits of dst throughout
 void AvgPaletteWeighted(u16 *src0, u16 *src1, u16 *dst, u16 weight0)
 {
     u16 *srcEnd = src0 + 16;
+    MarkBufferRangeDirty(dst, 16);
+    if (weight0 <= 256 && IS_WORD_ALIGNED(src0) && IS_WORD_ALIGNED(src1) && IS_WORD_ALIGNED(dst))
+    {
+        AvgPaletteWeighted_Arm((const u32 *)src0, (const u32 *)src1, (u32 *)dst, weight0);
+        return;
+    }
     src0++;
     src1++;
     dst++; // leave dst transparency unchanged
@@ -991,6 +1234,7 @@ void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u32 color)
 {
     // This copy is done via DMA in both RUBY and EMERALD
     CpuFastCopy(gPlttBufferUnfaded, gPlttBufferFaded, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
     BlendPalettes(selectedPalettes, coeff, color);
 }
 
@@ -999,6 +1243,8 @@ void TintPalette_GrayScale(u16 *palette, u32 count)
     s32 r, g, b, i;
     u32 gray;
 
+    MarkBufferRangeDirty(palette, count);
+
     for (i = 0; i < count; ++i)
     {
         r = GET_R(*palette);
@@ -1014,6 +1260,8 @@ void TintPalette_GrayScale2(u16 *palette, u32 count)
     s32 r, g, b, i;
     u32 gray;
 
+    MarkBufferRangeDirty(palette, count);
+
     for (i = 0; i < count; ++i)
     {
         r = GET_R(*palette);
@@ -1033,6 +1281,8 @@ void TintPalette_SepiaTone(u16 *palette, u32 count)
     s32 r, g, b, i;
     u32 gray;
 
+    MarkBufferRangeDirty(palette, count);
+
     for (i = 0; i < count; ++i)
     {
         r = GET_R(*palette);
@@ -1053,6 +1303,8 @@ void TintPalette_CustomTone(u16 *palette, u32 count, u16 rTone, u16 gTone, u16 b
     s32 r, g, b, i;
     u32 gray;
 
+    MarkBufferRangeDirty(palette, count);
+
     for (i = 0; i < count; ++i)
     {
         r = GET_R(*palette);
@@ -1077,6 +1329,8 @@ void CopyPaletteInvertedTint(const u16 *src, u16 *dst, u32 count, u8 tone)
     s32 r, g, b, i;
     u32 gray;
 
+    MarkBufferRangeDirty(dst, count);
+
     if (!tone)
     {
         for (i = 0; i < count; i++)
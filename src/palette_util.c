@@ -46,6 +46,7 @@ static u8 RouletteFlash_FadePalette(struct RouletteFlashPalette *pal)
     u8 i;
     u8 returnval;
 
+    MarkPaletteRangeDirty(pal->settings.paletteOffset, pal->settings.numColors);
     for (i = 0; i < pal->settings.numColors; i++)
     {
         struct PlttData *faded =   (struct PlttData *)&gPlttBufferFaded[pal->settings.paletteOffset + i];
@@ -106,6 +107,7 @@ static u8 RouletteFlash_FlashPalette(struct RouletteFlashPalette *pal)
 {
     u8 i = 0;
 
+    MarkPaletteRangeDirty(pal->settings.paletteOffset, pal->settings.numColors);
     switch (pal->state)
     {
     case 1:
@@ -182,6 +184,7 @@ void RouletteFlash_Stop(struct RouletteFlashUtil *flash, u16 flags)
                     u16 *faded = &gPlttBufferFaded[offset];
                     u16 *unfaded = &gPlttBufferUnfaded[offset];
                     memcpy(faded, unfaded, flash->palettes[i].settings.numColors * 2);
+                    MarkPaletteRangeDirty(offset, flash->palettes[i].settings.numColors);
                     flash->palettes[i].state = 0;
                     flash->palettes[i].fadeCycleCounter = 0;
                     flash->palettes[i].delayCounter = 0;
@@ -256,6 +259,7 @@ static void ClearPulseBlendPalettesSettings(struct PulseBlendPalette *pulseBlend
     {
         for (i = pulseBlendPalette->pulseBlendSettings.paletteOffset; i < pulseBlendPalette->pulseBlendSettings.paletteOffset + pulseBlendPalette->pulseBlendSettings.numColors; i++)
             gPlttBufferFaded[i] = gPlttBufferUnfaded[i];
+        MarkPaletteRangeDirty(pulseBlendPalette->pulseBlendSettings.paletteOffset, pulseBlendPalette->pulseBlendSettings.numColors);
     }
 
     memset(&pulseBlendPalette->pulseBlendSettings, 0, sizeof(pulseBlendPalette->pulseBlendSettings));
@@ -330,6 +334,7 @@ void UnmarkUsedPulseBlendPalettes(struct PulseBlend *pulseBlend, u16 pulseBlendP
             {
                 for (i = pulseBlendPalette->pulseBlendSettings.paletteOffset; i < pulseBlendPalette->pulseBlendSettings.paletteOffset + pulseBlendPalette->pulseBlendSettings.numColors; i++)
                     gPlttBufferFaded[i] = gPlttBufferUnfaded[i];
+                MarkPaletteRangeDirty(pulseBlendPalette->pulseBlendSettings.paletteOffset, pulseBlendPalette->pulseBlendSettings.numColors);
             }
 
             pulseBlendPalette->available = 1;
@@ -351,6 +356,7 @@ void UnmarkUsedPulseBlendPalettes(struct PulseBlend *pulseBlend, u16 pulseBlendP
                 {
                     for (i = pulseBlendPalette->pulseBlendSettings.paletteOffset; i < pulseBlendPalette->pulseBlendSettings.paletteOffset + pulseBlendPalette->pulseBlendSettings.numColors; i++)
                         gPlttBufferFaded[i] = gPlttBufferUnfaded[i];
+                    MarkPaletteRangeDirty(pulseBlendPalette->pulseBlendSettings.paletteOffset, pulseBlendPalette->pulseBlendSettings.numColors);
                 }
 
                 pulseBlendPalette->available = 1;
@@ -376,6 +382,7 @@ void UpdatePulseBlend(struct PulseBlend *pulseBlend)
                 {
                     pulseBlendPalette->delayCounter = pulseBlendPalette->pulseBlendSettings.delay;
                     CpuFastCopy(gPlttBufferUnfaded + pulseBlendPalette->pulseBlendSettings.paletteOffset, gPlttBufferFaded + pulseBlendPalette->pulseBlendSettings.paletteOffset, PLTT_SIZE_4BPP);
+                    MarkPaletteRangeDirty(pulseBlendPalette->pulseBlendSettings.paletteOffset, 16);
                     UpdatePalettesWithTime(1 << (pulseBlendPalette->pulseBlendSettings.paletteOffset >> 4));
                     BlendPalette(pulseBlendPalette->pulseBlendSettings.paletteOffset, pulseBlendPalette->pulseBlendSettings.numColors, pulseBlendPalette->blendCoeff, pulseBlendPalette->pulseBlendSettings.blendColor);
                     switch (pulseBlendPalette->pulseBlendSettings.fadeType)
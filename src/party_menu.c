@@ -855,6 +855,7 @@ static void PartyPaletteBufferCopy(u8 offset)
     offset = PLTT_ID(offset);
     CpuCopy16(&gPlttBufferUnfaded[BG_PLTT_ID(3)], &gPlttBufferUnfaded[offset], PLTT_SIZE_4BPP);
     CpuCopy16(&gPlttBufferUnfaded[BG_PLTT_ID(3)], &gPlttBufferFaded[offset], PLTT_SIZE_4BPP);
+    MarkPaletteRangeDirty(offset, 16);
 }
 
 static void FreePartyPointers(void)
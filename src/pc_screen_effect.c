@@ -84,6 +84,7 @@ static void Task_PCScreenEffect_TurnOn(u8 taskId)
             SetGpuReg(REG_OFFSET_BLDCNT, task->tBldCntBak);
             BlendPalettes(PALETTES_ALL, 0, RGB_BLACK);
             gPlttBufferFaded[BG_PLTT_ID(0)] = 0;
+            MarkPaletteRangeDirty(BG_PLTT_ID(0), 1);
         }
         SetGpuReg(REG_OFFSET_WIN0H, WIN_RANGE(task->tWin0Left, task->tWin0Right));
         if (task->tWin0Left)
@@ -118,6 +119,7 @@ static void Task_PCScreenEffect_TurnOff(u8 taskId)
     {
     case 0:
         gPlttBufferFaded[BG_PLTT_ID(0)] = 0;
+        MarkPaletteRangeDirty(BG_PLTT_ID(0), 1);
         break;
     case 1:
         task->tWin0Left = 0;
@@ -153,6 +155,7 @@ static void Task_PCScreenEffect_TurnOff(u8 taskId)
             task->tWin0Right = 120;
             BlendPalettes(PALETTES_ALL, 0x10, RGB_BLACK);
             gPlttBufferFaded[BG_PLTT_ID(0)] = 0;
+            MarkPaletteRangeDirty(BG_PLTT_ID(0), 1);
         }
         SetGpuReg(REG_OFFSET_WIN0H, WIN_RANGE(task->tWin0Left, task->tWin0Right));
         if (task->tWin0Left != 120)
@@ -76,6 +76,12 @@ struct PokedexScreenData
     u16 numOwnedKanto;
     u16 numSeenNational;
     u16 numOwnedNational;
+    // Which list listItems currently holds.
+    bool8 listItemsValid;
+    u16 listItemsFlagsVersion;
+    u8 listItemsOrderId;
+    bool8 listItemsNationalDex;
+    u16 listItemsCount;
 };
 
 struct PokedexScreenWindowGfx
@@ -92,6 +98,23 @@ struct PokedexCategoryPage
 
 EWRAM_DATA static struct PokedexScreenData * sPokedexScreenData = NULL;
 
+// The seen and caught flags as of the last time the Pokédex was opened, and
+// the dex counts taken from them. version changes whenever the flags in the
+// save block no longer match, which invalidates the counts and any list
+// built from older flags.
+struct PokedexFlagsSnapshot
+{
+    u8 seen[DEX_FLAGS_NO];
+    u8 caught[DEX_FLAGS_NO];
+    u16 version;
+    u16 numSeenKanto;
+    u16 numOwnedKanto;
+    u16 numSeenNational;
+    u16 numOwnedNational;
+};
+
+EWRAM_DATA static struct PokedexFlagsSnapshot sPokedexFlagsSnapshot = {0};
+
 static void Task_PokedexScreen(u8 taskId);
 static void DexScreen_InitGfxForTopMenu(void);
 static void Task_DexScreen_NumericalOrder(u8 taskId);
@@ -113,6 +136,7 @@ static void DexScreen_PrintNum3RightAlign(u8 windowId, u8 fontId, u16 num, u8 x,
 static void DexScreen_PrintNum4RightAlign(u8 windowId, u8 fontId, u16 num, u8 x, u8 y, u8 colorIdx);
 static void DexScreen_PrintMonDexNo(u8 windowId, u8 fontId, u16 species, u8 x, u8 y, bool32 allowNationalDex);
 static u16 DexScreen_GetDexCount(u8 caseId, bool8 whichDex);
+static void DexScreen_UpdateFlagsSnapshot(void);
 static void DexScreen_PrintControlInfo(const u8 *src);
 static void DexScreen_DestroyCategoryPageMonIconAndInfoWindows(void);
 static bool8 DexScreen_CreateCategoryListGfx(bool8 justRegistered);
@@ -927,10 +951,11 @@ void DexScreen_LoadResources(void)
     *sPokedexScreenData = sDexScreenDataInitialState;
     sPokedexScreenData->taskId = taskId;
     sPokedexScreenData->listItems = Alloc(NATIONAL_DEX_COUNT * sizeof(struct ListMenuItem));
-    sPokedexScreenData->numSeenNational = DexScreen_GetDexCount(FLAG_GET_SEEN, 1);
-    sPokedexScreenData->numOwnedNational = DexScreen_GetDexCount(FLAG_GET_CAUGHT, 1);
-    sPokedexScreenData->numSeenKanto = DexScreen_GetDexCount(FLAG_GET_SEEN, 0);
-    sPokedexScreenData->numOwnedKanto = DexScreen_GetDexCount(FLAG_GET_CAUGHT, 0);
+    DexScreen_UpdateFlagsSnapshot();
+    sPokedexScreenData->numSeenNational = sPokedexFlagsSnapshot.numSeenNational;
+    sPokedexScreenData->numOwnedNational = sPokedexFlagsSnapshot.numOwnedNational;
+    sPokedexScreenData->numSeenKanto = sPokedexFlagsSnapshot.numSeenKanto;
+    sPokedexScreenData->numOwnedKanto = sPokedexFlagsSnapshot.numOwnedKanto;
     SetBGMVolume_SuppressHelpSystemReduction(0x80);
     ChangeBgX(0, 0, 0);
     ChangeBgY(0, 0, 0);
@@ -1388,7 +1413,35 @@ static void DexScreen_CreateCharacteristicListMenu(void)
     CopyWindowToVram(1, COPYWIN_GFX);
 }
 
-static u16 DexScreen_CountMonsInOrderedList(u8 orderIdx)
+static void DexScreen_SetOrderedListItem(u16 listIdx, u16 natDexNum, bool32 seen, bool32 caught)
+{
+    u16 species = NationalDexNumToSpecies(natDexNum);
+
+    sPokedexScreenData->listItems[listIdx].label = seen ? gSpeciesInfo[species].speciesName : gText_5Dashes;
+    sPokedexScreenData->listItems[listIdx].index = (caught << 17) + (seen << 16) + species;
+}
+
+// Appends the mon to a filtered ordering if it is in the current dex
+// and has the required flag.
+static u16 DexScreen_TryAppendOrderedListItem(u16 count, u16 natDexNum, bool32 isNationalDex, bool32 requireCaught)
+{
+    bool32 seen, caught;
+
+    if (natDexNum == NATIONAL_DEX_NONE || natDexNum > NATIONAL_DEX_COUNT)
+        return count;
+    if (!isNationalDex && NationalToKantoDexNum(natDexNum) == KANTO_DEX_NONE)
+        return count;
+
+    seen = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_SEEN, FALSE);
+    caught = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_CAUGHT, FALSE);
+    if (!(requireCaught ? caught : seen))
+        return count;
+
+    DexScreen_SetOrderedListItem(count, natDexNum, seen, caught);
+    return count + 1;
+}
+
+static u16 DexScreen_BuildOrderedList(u8 orderIdx)
 {
     bool32 isNationalDex = IsNationalPokedexEnabled();
     u16 natDexNum;
@@ -1407,84 +1460,25 @@ static u16 DexScreen_CountMonsInOrderedList(u8 orderIdx)
             seen = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_SEEN, FALSE);
             caught = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_CAUGHT, FALSE);
             if (seen)
-            {
-                sPokedexScreenData->listItems[i].label = gSpeciesInfo[NationalDexNumToSpecies(natDexNum)].speciesName;
                 ret = i + 1;
-            }
-            else
-            {
-                sPokedexScreenData->listItems[i].label = gText_5Dashes;
-            }
-            sPokedexScreenData->listItems[i].index = (caught << 17) + (seen << 16) + NationalDexNumToSpecies(natDexNum);
+            DexScreen_SetOrderedListItem(i, natDexNum, seen, caught);
         }
         break;
     case DEX_ORDER_ATOZ:
         for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Alphabetical); i++)
-        {
-            natDexNum = gPokedexOrder_Alphabetical[i];
-            if (NATIONAL_DEX_NONE < natDexNum && natDexNum <= NATIONAL_DEX_COUNT && (isNationalDex || NationalToKantoDexNum(natDexNum) != KANTO_DEX_NONE))
-            {
-                seen = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_SEEN, FALSE);
-                caught = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_CAUGHT, FALSE);
-                if (seen)
-                {
-                    sPokedexScreenData->listItems[ret].label = gSpeciesInfo[NationalDexNumToSpecies(natDexNum)].speciesName;
-                    sPokedexScreenData->listItems[ret].index = (caught << 17) + (seen << 16) + NationalDexNumToSpecies(natDexNum);
-                    ret++;
-                }
-            }
-        }
+            ret = DexScreen_TryAppendOrderedListItem(ret, gPokedexOrder_Alphabetical[i], isNationalDex, FALSE);
         break;
     case DEX_ORDER_TYPE:
         for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Type); i++)
-        {
-            natDexNum = SpeciesToNationalDexNum(gPokedexOrder_Type[i]);
-            if (NATIONAL_DEX_NONE < natDexNum && natDexNum <= NATIONAL_DEX_COUNT && (isNationalDex || NationalToKantoDexNum(natDexNum) != KANTO_DEX_NONE))
-            {
-                seen = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_SEEN, FALSE);
-                caught = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_CAUGHT, FALSE);
-                if (caught)
-                {
-                    sPokedexScreenData->listItems[ret].label = gSpeciesInfo[NationalDexNumToSpecies(natDexNum)].speciesName;
-                    sPokedexScreenData->listItems[ret].index = (caught << 17) + (seen << 16) + NationalDexNumToSpecies(natDexNum);
-                    ret++;
-                }
-            }
-        }
+            ret = DexScreen_TryAppendOrderedListItem(ret, SpeciesToNationalDexNum(gPokedexOrder_Type[i]), isNationalDex, TRUE);
         break;
     case DEX_ORDER_LIGHTEST:
         for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Weight); i++)
-        {
-            natDexNum = gPokedexOrder_Weight[i];
-            if (NATIONAL_DEX_NONE < natDexNum && natDexNum <= NATIONAL_DEX_COUNT && (isNationalDex || NationalToKantoDexNum(natDexNum) != KANTO_DEX_NONE))
-            {
-                seen = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_SEEN, FALSE);
-                caught = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_CAUGHT, FALSE);
-                if (caught)
-                {
-                    sPokedexScreenData->listItems[ret].label = gSpeciesInfo[NationalDexNumToSpecies(natDexNum)].speciesName;
-                    sPokedexScreenData->listItems[ret].index = (caught << 17) + (seen << 16) + NationalDexNumToSpecies(natDexNum);
-                    ret++;
-                }
-            }
-        }
+            ret = DexScreen_TryAppendOrderedListItem(ret, gPokedexOrder_Weight[i], isNationalDex, TRUE);
         break;
     case DEX_ORDER_SMALLEST:
         for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Height); i++)
-        {
-            natDexNum = gPokedexOrder_Height[i];
-            if (NATIONAL_DEX_NONE < natDexNum && natDexNum <= NATIONAL_DEX_COUNT && (isNationalDex || NationalToKantoDexNum(natDexNum) != KANTO_DEX_NONE))
-            {
-                seen = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_SEEN, FALSE);
-                caught = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_CAUGHT, FALSE);
-                if (caught)
-                {
-                    sPokedexScreenData->listItems[ret].label = gSpeciesInfo[NationalDexNumToSpecies(natDexNum)].speciesName;
-                    sPokedexScreenData->listItems[ret].index = (caught << 17) + (seen << 16) + NationalDexNumToSpecies(natDexNum);
-                    ret++;
-                }
-            }
-        }
+            ret = DexScreen_TryAppendOrderedListItem(ret, gPokedexOrder_Height[i], isNationalDex, TRUE);
         break;
     case DEX_ORDER_NUMERICAL_NATIONAL:
         for (i = 0; i < NATIONAL_DEX_COUNT; i++)
@@ -1493,21 +1487,35 @@ static u16 DexScreen_CountMonsInOrderedList(u8 orderIdx)
             seen = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_SEEN, FALSE);
             caught = DexScreen_GetSetPokedexFlag(natDexNum, FLAG_GET_CAUGHT, FALSE);
             if (seen)
-            {
-                sPokedexScreenData->listItems[i].label = gSpeciesInfo[NationalDexNumToSpecies(natDexNum)].speciesName;
                 ret = natDexNum;
-            }
-            else
-            {
-                sPokedexScreenData->listItems[i].label = gText_5Dashes;
-            }
-            sPokedexScreenData->listItems[i].index = (caught << 17) + (seen << 16) + NationalDexNumToSpecies(natDexNum);
+            DexScreen_SetOrderedListItem(i, natDexNum, seen, caught);
         }
         break;
     }
     return ret;
 }
 
+// The list is kept while the Pokédex is open, e.g. when returning from a
+// mon's page, and rebuilt when the ordering or the flags change.
+static u16 DexScreen_CountMonsInOrderedList(u8 orderIdx)
+{
+    bool8 isNationalDex = IsNationalPokedexEnabled();
+
+    DexScreen_UpdateFlagsSnapshot();
+    if (!sPokedexScreenData->listItemsValid
+     || sPokedexScreenData->listItemsOrderId != orderIdx
+     || sPokedexScreenData->listItemsNationalDex != isNationalDex
+     || sPokedexScreenData->listItemsFlagsVersion != sPokedexFlagsSnapshot.version)
+    {
+        sPokedexScreenData->listItemsCount = DexScreen_BuildOrderedList(orderIdx);
+        sPokedexScreenData->listItemsOrderId = orderIdx;
+        sPokedexScreenData->listItemsNationalDex = isNationalDex;
+        sPokedexScreenData->listItemsFlagsVersion = sPokedexFlagsSnapshot.version;
+        sPokedexScreenData->listItemsValid = TRUE;
+    }
+    return sPokedexScreenData->listItemsCount;
+}
+
 static void DexScreen_InitListMenuForOrderedList(const struct ListMenuTemplate * template, u8 order)
 {
     switch (order)
@@ -2338,6 +2346,25 @@ static u16 DexScreen_GetDexCount(u8 caseId, bool8 whichDex)
     return count;
 }
 
+// Recounts only if a flag has changed since the last call, which is
+// cheaper than counting every mon's flags on each open.
+static void DexScreen_UpdateFlagsSnapshot(void)
+{
+    struct PokedexFlagsSnapshot *snapshot = &sPokedexFlagsSnapshot;
+
+    if (memcmp(snapshot->seen, gSaveBlock1Ptr->dexSeen, DEX_FLAGS_NO) == 0
+     && memcmp(snapshot->caught, gSaveBlock1Ptr->dexCaught, DEX_FLAGS_NO) == 0)
+        return;
+
+    memcpy(snapshot->seen, gSaveBlock1Ptr->dexSeen, DEX_FLAGS_NO);
+    memcpy(snapshot->caught, gSaveBlock1Ptr->dexCaught, DEX_FLAGS_NO);
+    snapshot->version++;
+    snapshot->numSeenNational = DexScreen_GetDexCount(FLAG_GET_SEEN, 1);
+    snapshot->numOwnedNational = DexScreen_GetDexCount(FLAG_GET_CAUGHT, 1);
+    snapshot->numSeenKanto = DexScreen_GetDexCount(FLAG_GET_SEEN, 0);
+    snapshot->numOwnedKanto = DexScreen_GetDexCount(FLAG_GET_CAUGHT, 0);
+}
+
 static void DexScreen_PrintControlInfo(const u8 *src)
 {
     DexScreen_AddTextPrinterParameterized(1, FONT_SMALL, src, 236 - GetStringWidth(FONT_SMALL, src, 0), 2, 4);
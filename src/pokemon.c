@@ -72,7 +72,6 @@ EWRAM_DATA u16 gFollowerSteps = 0;
 static union PokemonSubstruct *GetSubstruct(struct BoxPokemon *boxMon, u32 personality, u8 substructType);
 static bool8 IsPokemonStorageFull(void);
 static void EncryptBoxMon(struct BoxPokemon *boxMon);
-static u8 GetLevelFromMonExp(struct Pokemon *mon);
 static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon);
 static bool8 ShouldSkipFriendshipChange(void);
 
@@ -777,41 +776,9 @@ const struct NatureInfo gNaturesInfo[NUM_NATURES] =
 };
 
 
-#include "data/graphics/pokemon.h"
-#include "data/pokemon_graphics/front_pic_anims.h"
-
 #include "data/pokemon/trainer_class_lookups.h"
 #include "data/pokemon/experience_tables.h"
 
-#if P_LVL_UP_LEARNSETS >= GEN_9
-#include "data/pokemon/level_up_learnsets/gen_9.h" // Scarlet/Violet
-#elif P_LVL_UP_LEARNSETS >= GEN_8
-#include "data/pokemon/level_up_learnsets/gen_8.h" // Sword/Shield
-#elif P_LVL_UP_LEARNSETS >= GEN_7
-#include "data/pokemon/level_up_learnsets/gen_7.h" // Ultra Sun/ Ultra Moon
-#elif P_LVL_UP_LEARNSETS >= GEN_6
-#include "data/pokemon/level_up_learnsets/gen_6.h" // Omega Ruby/Alpha Sapphire
-#elif P_LVL_UP_LEARNSETS >= GEN_5
-#include "data/pokemon/level_up_learnsets/gen_5.h" // Black 2/White 2
-#elif P_LVL_UP_LEARNSETS >= GEN_4
-#include "data/pokemon/level_up_learnsets/gen_4.h" // HeartGold/SoulSilver
-#elif P_LVL_UP_LEARNSETS >= GEN_3
-#include "data/pokemon/level_up_learnsets/gen_3.h" // Ruby/Sapphire/Emerald
-#elif P_LVL_UP_LEARNSETS >= GEN_2
-#include "data/pokemon/level_up_learnsets/gen_2.h" // Crystal
-#elif P_LVL_UP_LEARNSETS >= GEN_1
-#include "data/pokemon/level_up_learnsets/gen_1.h" // Yellow
-#endif
-
-#include "data/pokemon/teachable_learnsets.h"
-#include "data/pokemon/egg_moves.h"
-#include "data/pokemon/form_species_tables.h"
-#include "data/pokemon/form_change_tables.h"
-#include "data/pokemon/form_change_table_pointers.h"
-#include "data/object_events/object_event_pic_tables_followers.h"
-
-#include "data/pokemon/species_info.h"
-
 static const s8 sPokeblockFlavorCompatibilityTable[NUM_NATURES * FLAVOR_COUNT] =
 {
     // Cool, Beauty, Cute, Smart, Tough
@@ -1596,28 +1563,19 @@ void ConvertPokemonToBattleTowerPokemon(struct Pokemon *mon, struct BattleTowerP
     GetMonData(mon, MON_DATA_NICKNAME10, dest->nickname);
 }
 
+// The sum of the substructs' halfwords does not depend on their order,
+// so they are summed a word at a time without looking up the permutation.
 static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 {
-    u16 checksum = 0;
-    union PokemonSubstruct *substruct0 = GetSubstruct(boxMon, boxMon->personality, 0);
-    union PokemonSubstruct *substruct1 = GetSubstruct(boxMon, boxMon->personality, 1);
-    union PokemonSubstruct *substruct2 = GetSubstruct(boxMon, boxMon->personality, 2);
-    union PokemonSubstruct *substruct3 = GetSubstruct(boxMon, boxMon->personality, 3);
-    s32 i;
-
-    for (i = 0; i < (s32)ARRAY_COUNT(substruct0->raw); i++)
-        checksum += substruct0->raw[i];
+    u32 i, lowHalves = 0, highHalves = 0;
 
-    for (i = 0; i < (s32)ARRAY_COUNT(substruct1->raw); i++)
-        checksum += substruct1->raw[i];
-
-    for (i = 0; i < (s32)ARRAY_COUNT(substruct2->raw); i++)
-        checksum += substruct2->raw[i];
-
-    for (i = 0; i < (s32)ARRAY_COUNT(substruct3->raw); i++)
-        checksum += substruct3->raw[i];
+    for (i = 0; i < ARRAY_COUNT(boxMon->secure.raw); i++)
+    {
+        lowHalves += boxMon->secure.raw[i] & 0xFFFF;
+        highHalves += boxMon->secure.raw[i] >> 16;
+    }
 
-    return checksum;
+    return lowHalves + highHalves;
 }
 
 #define CALC_STAT(base, iv, ev, statIndex, field)               \
@@ -1630,28 +1588,43 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
     SetMonData(mon, field, &n);                                 \
 }
 
+static s32 GetDecodedIV(struct DecodedBoxMon *decoded, s32 hyperTrainedField, s32 ivField)
+{
+    if (GetDecodedBoxMonData(decoded, hyperTrainedField, NULL))
+        return MAX_PER_STAT_IVS;
+    return GetDecodedBoxMonData(decoded, ivField, NULL);
+}
+
 void CalculateMonStats(struct Pokemon *mon)
 {
+    struct DecodedBoxMon decoded;
     s32 oldMaxHP = GetMonData(mon, MON_DATA_MAX_HP, NULL);
     s32 currentHP = GetMonData(mon, MON_DATA_HP, NULL);
-    s32 hpIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_HP) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_HP_IV, NULL);
-    s32 hpEV = GetMonData(mon, MON_DATA_HP_EV, NULL);
-    s32 attackIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_ATK) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_ATK_IV, NULL);
-    s32 attackEV = GetMonData(mon, MON_DATA_ATK_EV, NULL);
-    s32 defenseIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_DEF) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_DEF_IV, NULL);
-    s32 defenseEV = GetMonData(mon, MON_DATA_DEF_EV, NULL);
-    s32 speedIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPEED) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPEED_IV, NULL);
-    s32 speedEV = GetMonData(mon, MON_DATA_SPEED_EV, NULL);
-    s32 spAttackIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPATK) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPATK_IV, NULL);
-    s32 spAttackEV = GetMonData(mon, MON_DATA_SPATK_EV, NULL);
-    s32 spDefenseIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPDEF) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPDEF_IV, NULL);
-    s32 spDefenseEV = GetMonData(mon, MON_DATA_SPDEF_EV, NULL);
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    u8 friendship = GetMonData(mon, MON_DATA_FRIENDSHIP, NULL);
-    s32 level = GetLevelFromMonExp(mon);
+    s32 hpIV, hpEV, attackIV, attackEV, defenseIV, defenseEV, speedIV, speedEV;
+    s32 spAttackIV, spAttackEV, spDefenseIV, spDefenseEV;
+    u16 species;
+    u8 friendship, nature;
+    s32 level;
     s32 newMaxHP;
 
-    u8 nature = GetMonData(mon, MON_DATA_HIDDEN_NATURE, NULL);
+    // Read every field with a single decryption.
+    DecodeBoxMon(&decoded, &mon->box);
+    hpIV = GetDecodedIV(&decoded, MON_DATA_HYPER_TRAINED_HP, MON_DATA_HP_IV);
+    hpEV = GetDecodedBoxMonData(&decoded, MON_DATA_HP_EV, NULL);
+    attackIV = GetDecodedIV(&decoded, MON_DATA_HYPER_TRAINED_ATK, MON_DATA_ATK_IV);
+    attackEV = GetDecodedBoxMonData(&decoded, MON_DATA_ATK_EV, NULL);
+    defenseIV = GetDecodedIV(&decoded, MON_DATA_HYPER_TRAINED_DEF, MON_DATA_DEF_IV);
+    defenseEV = GetDecodedBoxMonData(&decoded, MON_DATA_DEF_EV, NULL);
+    speedIV = GetDecodedIV(&decoded, MON_DATA_HYPER_TRAINED_SPEED, MON_DATA_SPEED_IV);
+    speedEV = GetDecodedBoxMonData(&decoded, MON_DATA_SPEED_EV, NULL);
+    spAttackIV = GetDecodedIV(&decoded, MON_DATA_HYPER_TRAINED_SPATK, MON_DATA_SPATK_IV);
+    spAttackEV = GetDecodedBoxMonData(&decoded, MON_DATA_SPATK_EV, NULL);
+    spDefenseIV = GetDecodedIV(&decoded, MON_DATA_HYPER_TRAINED_SPDEF, MON_DATA_SPDEF_IV);
+    spDefenseEV = GetDecodedBoxMonData(&decoded, MON_DATA_SPDEF_EV, NULL);
+    species = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL);
+    friendship = GetDecodedBoxMonData(&decoded, MON_DATA_FRIENDSHIP, NULL);
+    level = GetLevelFromExp(species, GetDecodedBoxMonData(&decoded, MON_DATA_EXP, NULL));
+    nature = GetDecodedBoxMonData(&decoded, MON_DATA_HIDDEN_NATURE, NULL);
 
     SetMonData(mon, MON_DATA_LEVEL, &level);
 
@@ -1719,10 +1692,8 @@ void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest)
     SetMonData(dest, MON_DATA_HP, &value);
 }
 
-static u8 GetLevelFromMonExp(struct Pokemon *mon)
+u8 GetLevelFromExp(u16 species, u32 exp)
 {
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetMonData(mon, MON_DATA_EXP, NULL);
     s32 level = 1;
 
     while (level <= MAX_LEVEL && gExperienceTables[gSpeciesInfo[species].growthRate][level] <= exp)
@@ -1733,14 +1704,10 @@ static u8 GetLevelFromMonExp(struct Pokemon *mon)
 
 u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon)
 {
-    u16 species = GetBoxMonData(boxMon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetBoxMonData(boxMon, MON_DATA_EXP, NULL);
-    s32 level = 1;
+    struct DecodedBoxMon decoded;
 
-    while (level <= MAX_LEVEL && gExperienceTables[gSpeciesInfo[species].growthRate][level] <= exp)
-        level++;
-
-    return level - 1;
+    DecodeBoxMon(&decoded, boxMon);
+    return GetLevelFromExp(GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL), GetDecodedBoxMonData(&decoded, MON_DATA_EXP, NULL));
 }
 
 u16 GiveMoveToMon(struct Pokemon *mon, u16 move)
@@ -2138,61 +2105,58 @@ static void DecryptBoxMon(struct BoxPokemon *boxMon)
     }
 }
 
-#define SUBSTRUCT_CASE(n, v1, v2, v3, v4)                               \
-case n:                                                                 \
-    {                                                                   \
-                                                                        \
-        switch (substructType)                                          \
-        {                                                               \
-        case 0:                                                         \
-            substruct = &boxMon->secure.substructs[v1];                          \
-            break;                                                      \
-        case 1:                                                         \
-            substruct = &boxMon->secure.substructs[v2];                          \
-            break;                                                      \
-        case 2:                                                         \
-            substruct = &boxMon->secure.substructs[v3];                          \
-            break;                                                      \
-        case 3:                                                         \
-            substruct = &boxMon->secure.substructs[v4];                          \
-            break;                                                      \
-        }                                                               \
-        break;                                                          \
-    }                                                                   \
+// Index in secure.substructs of each substruct type, for each value of
+// personality % 24.
+static const u8 sSubstructIndices[24][4] =
+{
+    {0, 1, 2, 3},
+    {0, 1, 3, 2},
+    {0, 2, 1, 3},
+    {0, 3, 1, 2},
+    {0, 2, 3, 1},
+    {0, 3, 2, 1},
+    {1, 0, 2, 3},
+    {1, 0, 3, 2},
+    {2, 0, 1, 3},
+    {3, 0, 1, 2},
+    {2, 0, 3, 1},
+    {3, 0, 2, 1},
+    {1, 2, 0, 3},
+    {1, 3, 0, 2},
+    {2, 1, 0, 3},
+    {3, 1, 0, 2},
+    {2, 3, 0, 1},
+    {3, 2, 0, 1},
+    {1, 2, 3, 0},
+    {1, 3, 2, 0},
+    {2, 1, 3, 0},
+    {3, 1, 2, 0},
+    {2, 3, 1, 0},
+    {3, 2, 1, 0},
+};
+
+// personality % 24 == personality % 8 + 8 * ((personality / 8) % 3).
+// 2^16 % 3 == 1, so adding the high half of x to its low half keeps x % 3;
+// twice brings x to at most 0x10000, where x / 3 == (x * 0xAAAB) >> 17.
+// Only 32-bit multiplies, so Thumb code calls neither the division nor
+// the 64-bit multiply routine.
+static inline u32 PersonalityMod24(u32 personality)
+{
+    u32 x = personality >> 3;
+
+    x = (x >> 16) + (x & 0xFFFF);
+    x = (x >> 16) + (x & 0xFFFF);
+    return (personality & 7) + 8 * (x - ((x * 0xAAAB) >> 17) * 3);
+}
+
+u32 GetSubstructIndex(u32 personality, u32 substructType)
+{
+    return sSubstructIndices[PersonalityMod24(personality)][substructType];
+}
 
 static union PokemonSubstruct *GetSubstruct(struct BoxPokemon *boxMon, u32 personality, u8 substructType)
 {
-    union PokemonSubstruct *substruct = NULL;
-
-    switch (personality % 24)
-    {
-        SUBSTRUCT_CASE( 0,0,1,2,3)
-        SUBSTRUCT_CASE( 1,0,1,3,2)
-        SUBSTRUCT_CASE( 2,0,2,1,3)
-        SUBSTRUCT_CASE( 3,0,3,1,2)
-        SUBSTRUCT_CASE( 4,0,2,3,1)
-        SUBSTRUCT_CASE( 5,0,3,2,1)
-        SUBSTRUCT_CASE( 6,1,0,2,3)
-        SUBSTRUCT_CASE( 7,1,0,3,2)
-        SUBSTRUCT_CASE( 8,2,0,1,3)
-        SUBSTRUCT_CASE( 9,3,0,1,2)
-        SUBSTRUCT_CASE(10,2,0,3,1)
-        SUBSTRUCT_CASE(11,3,0,2,1)
-        SUBSTRUCT_CASE(12,1,2,0,3)
-        SUBSTRUCT_CASE(13,1,3,0,2)
-        SUBSTRUCT_CASE(14,2,1,0,3)
-        SUBSTRUCT_CASE(15,3,1,0,2)
-        SUBSTRUCT_CASE(16,2,3,0,1)
-        SUBSTRUCT_CASE(17,3,2,0,1)
-        SUBSTRUCT_CASE(18,1,2,3,0)
-        SUBSTRUCT_CASE(19,1,3,2,0)
-        SUBSTRUCT_CASE(20,2,1,3,0)
-        SUBSTRUCT_CASE(21,3,1,2,0)
-        SUBSTRUCT_CASE(22,2,3,1,0)
-        SUBSTRUCT_CASE(23,3,2,1,0)
-    }
-
-    return substruct;
+    return &boxMon->secure.substructs[GetSubstructIndex(personality, substructType)];
 }
 
 /* GameFreak called GetMonData with either 2 or 3 arguments, for type
@@ -2275,11 +2239,15 @@ union EvolutionTracker
     struct EvolutionTrackerBitfield asField;
 };
 
-/* GameFreak called GetBoxMonData with either 2 or 3 arguments, for type
- * safety we have a GetBoxMonData macro (in include/pokemon.h) which
- * dispatches to either GetBoxMonData2 or GetBoxMonData3 based on the
- * number of arguments. */
-u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
+static void MarkBoxMonAsBadEgg(struct BoxPokemon *boxMon)
+{
+    boxMon->isBadEgg = TRUE;
+    boxMon->isEgg = TRUE;
+    GetSubstruct(boxMon, boxMon->personality, 3)->type3.isEgg = TRUE;
+}
+
+// boxMon must already be decrypted.
+static u32 GetDecryptedBoxMonData(struct BoxPokemon *boxMon, s32 field, u8 *data)
 {
     s32 i;
     u32 retVal = 0;
@@ -2289,7 +2257,6 @@ u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
     struct PokemonSubstruct3 *substruct3 = NULL;
     union EvolutionTracker evoTracker;
 
-    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
     if (field > MON_DATA_ENCRYPT_SEPARATOR)
     {
         substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
@@ -2297,15 +2264,6 @@ u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
         substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
         substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
 
-        DecryptBoxMon(boxMon);
-
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
-        {
-            boxMon->isBadEgg = TRUE;
-            boxMon->isEgg = TRUE;
-            substruct3->isEgg = TRUE;
-        }
-
         switch (field)
         {
         case MON_DATA_NICKNAME:
@@ -2746,8 +2704,26 @@ u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
         }
     }
 
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
-        EncryptBoxMon(boxMon);
+    return retVal;
+}
+
+/* GameFreak called GetBoxMonData with either 2 or 3 arguments, for type
+ * safety we have a GetBoxMonData macro (in include/pokemon.h) which
+ * dispatches to either GetBoxMonData2 or GetBoxMonData3 based on the
+ * number of arguments. */
+u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
+{
+    u32 retVal;
+
+    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
+    if (field <= MON_DATA_ENCRYPT_SEPARATOR)
+        return GetDecryptedBoxMonData(boxMon, field, data);
+
+    DecryptBoxMon(boxMon);
+    if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
+        MarkBoxMonAsBadEgg(boxMon);
+    retVal = GetDecryptedBoxMonData(boxMon, field, data);
+    EncryptBoxMon(boxMon);
 
     return retVal;
 }
@@ -2819,7 +2795,8 @@ void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg)
     }
 }
 
-void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
+// boxMon must already be decrypted. Does not update the checksum.
+static void SetDecryptedBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
 {
     const u8 *data = dataArg;
 
@@ -2835,17 +2812,6 @@ void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
         substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
         substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
 
-        DecryptBoxMon(boxMon);
-
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
-        {
-            boxMon->isBadEgg = TRUE;
-            boxMon->isEgg = TRUE;
-            substruct3->isEgg = TRUE;
-            EncryptBoxMon(boxMon);
-            return;
-        }
-
         switch (field)
         {
         case MON_DATA_NICKNAME:
@@ -3180,14 +3146,73 @@ void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
             break;
         }
     }
+}
 
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
+{
+    if (field <= MON_DATA_ENCRYPT_SEPARATOR)
+    {
+        SetDecryptedBoxMonData(boxMon, field, dataArg);
+        return;
+    }
+
+    DecryptBoxMon(boxMon);
+    if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
+    {
+        MarkBoxMonAsBadEgg(boxMon);
+        EncryptBoxMon(boxMon);
+        return;
+    }
+    SetDecryptedBoxMonData(boxMon, field, dataArg);
+    boxMon->checksum = CalculateBoxMonChecksum(boxMon);
+    EncryptBoxMon(boxMon);
+}
+
+void DecodeBoxMon(struct DecodedBoxMon *decoded, struct BoxPokemon *boxMon)
+{
+    decoded->source = boxMon;
+    decoded->mon = *boxMon;
+    decoded->isValid = TRUE;
+    decoded->isModified = FALSE;
+
+    DecryptBoxMon(&decoded->mon);
+    if (CalculateBoxMonChecksum(&decoded->mon) != decoded->mon.checksum)
     {
-        boxMon->checksum = CalculateBoxMonChecksum(boxMon);
+        // Flag the stored mon as well, like GetBoxMonData does.
+        MarkBoxMonAsBadEgg(&decoded->mon);
+        *boxMon = decoded->mon;
         EncryptBoxMon(boxMon);
+        decoded->isValid = FALSE;
     }
 }
 
+u32 GetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, u8 *data)
+{
+    return GetDecryptedBoxMonData(&decoded->mon, field, data);
+}
+
+void SetDecodedBoxMonData(struct DecodedBoxMon *decoded, s32 field, const void *dataArg)
+{
+    // SetBoxMonData refuses to write encrypted fields of a bad egg.
+    if (field > MON_DATA_ENCRYPT_SEPARATOR && !decoded->isValid)
+        return;
+
+    SetDecryptedBoxMonData(&decoded->mon, field, dataArg);
+    decoded->isModified = TRUE;
+}
+
+void CommitDecodedBoxMon(struct DecodedBoxMon *decoded)
+{
+    if (!decoded->isModified)
+        return;
+
+    if (decoded->isValid)
+        decoded->mon.checksum = CalculateBoxMonChecksum(&decoded->mon);
+    *decoded->source = decoded->mon;
+    EncryptBoxMon(decoded->source);
+    decoded->isModified = FALSE;
+}
+
 
 void CopyMon(void *dest, void *src, size_t size)
 {
@@ -3233,6 +3258,7 @@ u8 CopyMonToPC(struct Pokemon *mon)
             {
                 MonRestorePP(mon);
                 CopyMon(checkingMon, &mon->box, sizeof(mon->box));
+                InvalidateBoxMonSummaryAt(boxNo, boxPos);
                 gSpecialVar_MonBoxId = boxNo;
                 gSpecialVar_MonBoxPos = boxPos;
                 if (GetPCBoxToSendMon() != boxNo)
@@ -3400,7 +3426,7 @@ static bool8 IsPokemonStorageFull(void)
 
     for (i = 0; i < TOTAL_BOXES_COUNT; i++)
         for (j = 0; j < IN_BOX_COUNT; j++)
-            if (GetBoxMonDataAt(i, j, MON_DATA_SPECIES) == SPECIES_NONE)
+            if (GetBoxMonSummaryAt(i, j)->species == SPECIES_NONE)
                 return FALSE;
 
     return TRUE;
@@ -4651,19 +4677,28 @@ u16 GetEvolutionTargetSpecies(struct Pokemon *mon, enum EvolutionMode mode, u16
     return targetSpecies;
 }
 
+// The first species with each national dex number, built on first use.
+static EWRAM_DATA u16 sNationalDexNumToSpecies[NATIONAL_DEX_COUNT + 1] = {0};
+static EWRAM_DATA bool8 sNationalDexNumToSpeciesBuilt = FALSE;
+
 u16 NationalDexNumToSpecies(u16 nationalNum)
 {
     u16 species;
 
-    if (!nationalNum)
+    if (!nationalNum || nationalNum > NATIONAL_DEX_COUNT)
         return SPECIES_NONE;
 
-    for (species = 1; species < NUM_SPECIES; species++)
+    if (!sNationalDexNumToSpeciesBuilt)
     {
-        if (gSpeciesInfo[species].natDexNum == nationalNum)
-            return species;
+        for (species = NUM_SPECIES - 1; species > 0; species--)
+        {
+            if (gSpeciesInfo[species].natDexNum <= NATIONAL_DEX_COUNT)
+                sNationalDexNumToSpecies[gSpeciesInfo[species].natDexNum] = species;
+        }
+        sNationalDexNumToSpecies[NATIONAL_DEX_NONE] = SPECIES_NONE;
+        sNationalDexNumToSpeciesBuilt = TRUE;
     }
-    return SPECIES_NONE;
+    return sNationalDexNumToSpecies[nationalNum];
 }
 
 u16 SpeciesToNationalDexNum(u16 species)
@@ -2,6 +2,14 @@
 #include "gflib.h"
 #include "pokemon_storage_system_internal.h"
 
+STATIC_ASSERT(IN_BOX_COUNT <= 32, BoxMonSummaryValidMaskFitsBox);
+
+static EWRAM_DATA struct BoxMonSummary sBoxMonSummaries[TOTAL_BOXES_COUNT][IN_BOX_COUNT] = {0};
+// Bit n is set if sBoxMonSummaries[box][n] is up to date.
+static EWRAM_DATA u32 sBoxMonSummariesValid[TOTAL_BOXES_COUNT] = {0};
+
+static const struct BoxMonSummary sEmptyBoxMonSummary = {0};
+
 void BackupPokemonStorage(struct PokemonStorage * dest)
 {
     *dest = *gPokemonStoragePtr;
@@ -10,6 +18,60 @@ void BackupPokemonStorage(struct PokemonStorage * dest)
 void RestorePokemonStorage(struct PokemonStorage * src)
 {
     *gPokemonStoragePtr = *src;
+    InvalidateBoxMonSummaries();
+}
+
+// Called wherever a boxed mon is written directly.
+void InvalidateBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+        sBoxMonSummariesValid[boxId] &= ~(1 << boxPosition);
+}
+
+void InvalidateBoxMonSummaries(void)
+{
+    memset(sBoxMonSummariesValid, 0, sizeof(sBoxMonSummariesValid));
+}
+
+// The checksum covers every encrypted field, so this also catches most
+// mons which were replaced or edited without invalidating their summary.
+static bool32 IsBoxMonSummaryCurrent(const struct BoxMonSummary *summary, const struct BoxPokemon *boxMon)
+{
+    return summary->personality == boxMon->personality
+        && summary->otId == boxMon->otId
+        && summary->checksum == boxMon->checksum;
+}
+
+// Decrypts the mon only if it changed since the summary was last built.
+const struct BoxMonSummary *GetBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    struct BoxPokemon *boxMon;
+    struct BoxMonSummary *summary;
+    struct DecodedBoxMon decoded;
+
+    if (boxId >= TOTAL_BOXES_COUNT || boxPosition >= IN_BOX_COUNT)
+        return &sEmptyBoxMonSummary;
+
+    boxMon = &gPokemonStoragePtr->boxes[boxId][boxPosition];
+    summary = &sBoxMonSummaries[boxId][boxPosition];
+    if (!(sBoxMonSummariesValid[boxId] & (1 << boxPosition)) || !IsBoxMonSummaryCurrent(summary, boxMon))
+    {
+        DecodeBoxMon(&decoded, boxMon);
+        summary->species = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL);
+        summary->speciesOrEgg = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES_OR_EGG, NULL);
+        summary->heldItem = GetDecodedBoxMonData(&decoded, MON_DATA_HELD_ITEM, NULL);
+        summary->isEgg = GetDecodedBoxMonData(&decoded, MON_DATA_IS_EGG, NULL);
+        summary->level = GetLevelFromExp(summary->species, GetDecodedBoxMonData(&decoded, MON_DATA_EXP, NULL));
+        summary->personality = boxMon->personality;
+        summary->otId = boxMon->otId;
+        summary->checksum = boxMon->checksum;
+        sBoxMonSummariesValid[boxId] |= 1 << boxPosition;
+    }
+
+    // Not encrypted, so cheap to read every time.
+    summary->markings = boxMon->markings;
+    summary->isShiny = GetBoxMonData(boxMon, MON_DATA_IS_SHINY);
+    return summary;
 }
 
 // Functions here are general utility functions.
@@ -35,7 +97,10 @@ u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request)
 void SetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, const void *value)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         SetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], request, value);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 u32 GetCurrentBoxMonData(u8 boxPosition, s32 request)
@@ -73,7 +138,10 @@ u32 GetAndCopyBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, void *dst)
 void SetBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon * src)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         gPokemonStoragePtr->boxes[boxId][boxPosition] = *src;
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 void CopyBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon * dst)
@@ -85,7 +153,10 @@ void CopyBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon * dst)
 void ZeroBoxMonAt(u8 boxId, u8 boxPosition)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         ZeroBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition]);
+        InvalidateBoxMonSummaryAt(boxId, boxPosition);
+    }
 }
 
 void BoxMonAtToMon(u8 boxId, u8 boxPosition, struct Pokemon * dst)
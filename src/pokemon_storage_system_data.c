@@ -735,7 +735,7 @@ void ReleaseMon(void)
         {
             boxId = StorageGetCurrentBox();
             if (OW_PC_RELEASE_ITEM >= GEN_8)
-                item = GetBoxMonDataAt(boxId, sCursorPosition, MON_DATA_HELD_ITEM);
+                item = GetBoxMonSummaryAt(boxId, sCursorPosition)->heldItem;
         }
 
         PurgeMonOrBoxMon(boxId, sCursorPosition);
@@ -965,7 +965,7 @@ bool8 CanPlaceMon(void)
     {
         if (sCursorArea == CURSOR_AREA_IN_PARTY && GetMonData(&gPlayerParty[sCursorPosition], MON_DATA_SPECIES) == SPECIES_NONE)
             return TRUE;
-        else if (sCursorArea == CURSOR_AREA_IN_BOX && GetBoxMonDataAt(StorageGetCurrentBox(), sCursorPosition, MON_DATA_SPECIES_OR_EGG) == SPECIES_NONE)
+        else if (sCursorArea == CURSOR_AREA_IN_BOX && GetBoxMonSummaryAt(StorageGetCurrentBox(), sCursorPosition)->speciesOrEgg == SPECIES_NONE)
             return TRUE;
         else
             return FALSE;
@@ -1079,26 +1079,27 @@ static void SetDisplayMonData(void *pokemon, u8 mode)
     }
     else if (mode == MODE_BOX)
     {
-        struct BoxPokemon *boxMon = (struct BoxPokemon *)pokemon;
+        struct DecodedBoxMon decoded;
 
-        gStorage->displayMonSpecies = GetBoxMonData(pokemon, MON_DATA_SPECIES_OR_EGG);
+        DecodeBoxMon(&decoded, (struct BoxPokemon *)pokemon);
+        gStorage->displayMonSpecies = GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES_OR_EGG, NULL);
         if (gStorage->displayMonSpecies != SPECIES_NONE)
         {
-            bool32 isShiny = GetBoxMonData(boxMon, MON_DATA_IS_SHINY, NULL);
-            sanityIsBagEgg = GetBoxMonData(boxMon, MON_DATA_SANITY_IS_BAD_EGG);
+            bool32 isShiny = GetDecodedBoxMonData(&decoded, MON_DATA_IS_SHINY, NULL);
+            sanityIsBagEgg = GetDecodedBoxMonData(&decoded, MON_DATA_SANITY_IS_BAD_EGG, NULL);
             if (sanityIsBagEgg)
                 gStorage->displayMonIsEgg = TRUE;
             else
-                gStorage->displayMonIsEgg = GetBoxMonData(boxMon, MON_DATA_IS_EGG);
+                gStorage->displayMonIsEgg = GetDecodedBoxMonData(&decoded, MON_DATA_IS_EGG, NULL);
 
-            GetBoxMonData(boxMon, MON_DATA_NICKNAME, gStorage->displayMonNickname);
+            GetDecodedBoxMonData(&decoded, MON_DATA_NICKNAME, gStorage->displayMonNickname);
             StringGet_Nickname(gStorage->displayMonNickname);
-            gStorage->displayMonLevel = GetLevelFromBoxMonExp(boxMon);
-            gStorage->displayMonMarkings = GetBoxMonData(boxMon, MON_DATA_MARKINGS);
-            gStorage->displayMonPersonality = GetBoxMonData(boxMon, MON_DATA_PERSONALITY);
+            gStorage->displayMonLevel = GetLevelFromExp(GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL), GetDecodedBoxMonData(&decoded, MON_DATA_EXP, NULL));
+            gStorage->displayMonMarkings = GetDecodedBoxMonData(&decoded, MON_DATA_MARKINGS, NULL);
+            gStorage->displayMonPersonality = GetDecodedBoxMonData(&decoded, MON_DATA_PERSONALITY, NULL);
             gStorage->displayMonPalette = GetMonSpritePalFromSpeciesAndPersonality(gStorage->displayMonSpecies, isShiny, gStorage->displayMonPersonality);
             gender = GetGenderFromSpeciesAndPersonality(gStorage->displayMonSpecies, gStorage->displayMonPersonality);
-            gStorage->displayMonItemId = GetBoxMonData(boxMon, MON_DATA_HELD_ITEM);
+            gStorage->displayMonItemId = GetDecodedBoxMonData(&decoded, MON_DATA_HELD_ITEM, NULL);
         }
     }
     else
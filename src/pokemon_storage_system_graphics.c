@@ -317,7 +317,7 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            species = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES_OR_EGG);
+            species = GetBoxMonSummaryAt(boxId, boxPosition)->speciesOrEgg;
             if (species != SPECIES_NONE)
             {
                 personality = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
@@ -335,7 +335,7 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
         {
-            if (GetBoxMonDataAt(boxId, boxPosition, MON_DATA_HELD_ITEM) == 0)
+            if (GetBoxMonSummaryAt(boxId, boxPosition)->heldItem == ITEM_NONE)
                 gStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
         }
     }
@@ -471,7 +471,7 @@ static u8 CreateBoxMonIconsInColumn(u8 column, u16 distance, s16 speed)
                     gStorage->boxMonsSprites[boxPosition]->sSpeed = speed;
                     gStorage->boxMonsSprites[boxPosition]->sDestX = xDest;
                     gStorage->boxMonsSprites[boxPosition]->callback = SpriteCB_BoxMonIconScrollIn;
-                    if (GetBoxMonDataAt(gStorage->incomingBoxId, boxPosition, MON_DATA_HELD_ITEM) == 0)
+                    if (GetBoxMonSummaryAt(gStorage->incomingBoxId, boxPosition)->heldItem == ITEM_NONE)
                         gStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
                     count++;
                 }
@@ -566,7 +566,7 @@ static void SetBoxSpeciesAndPersonalities(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            gStorage->boxSpecies[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES_OR_EGG);
+            gStorage->boxSpecies[boxPosition] = GetBoxMonSummaryAt(boxId, boxPosition)->speciesOrEgg;
             if (gStorage->boxSpecies[boxPosition] != SPECIES_NONE)
                 gStorage->boxPersonalities[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
             boxPosition++;
@@ -117,7 +117,7 @@ static u8 CountMonsInBox(u8 boxId)
 
     for (i = 0, count = 0; i < IN_BOX_COUNT; i++)
     {
-        if (GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES) != SPECIES_NONE)
+        if (GetBoxMonSummaryAt(boxId, i)->species != SPECIES_NONE)
             count++;
     }
 
@@ -130,7 +130,7 @@ s16 GetFirstFreeBoxSpot(u8 boxId)
 
     for (i = 0; i < IN_BOX_COUNT; i++)
     {
-        if (GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES) == SPECIES_NONE)
+        if (GetBoxMonSummaryAt(boxId, i)->species == SPECIES_NONE)
             return i;
     }
 
@@ -430,6 +430,8 @@ void EnterPokeStorage(u8 boxOption)
 
 void CB2_ReturnToPokeStorage(void)
 {
+    // The summary screen edits the boxed mon in place.
+    InvalidateBoxMonSummaries();
     ResetTasks();
     gStorage = Alloc(sizeof(struct PokemonStorageSystemData));
     if (gStorage == NULL)
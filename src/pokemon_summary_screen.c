@@ -4569,9 +4569,11 @@ static void CreateMonStatusIconObj(u16 tileTag, u16 palTag)
 {
     u16 spriteId;
     void *gfxBufferPtr;
+    u32 mark;
 
     sStatusIcon = AllocZeroed(sizeof(struct MonStatusIconObj));
-    gfxBufferPtr = AllocZeroed(0x20 * 32);
+    mark = ArenaMark(&gFrameArena);
+    gfxBufferPtr = FrameAllocZeroed(0x20 * 32);
 
     LZ77UnCompWram(gSummaryScreen_StatusAilmentIcon_Gfx, gfxBufferPtr);
 
@@ -4605,7 +4607,7 @@ static void CreateMonStatusIconObj(u16 tileTag, u16 palTag)
 
     ShowOrHideStatusIcon(TRUE);
     UpdateMonStatusIconObj();
-    FREE_AND_SET_NULL_IF_SET(gfxBufferPtr);
+    ArenaResetToMark(&gFrameArena, mark);
 }
 
 static void DestroyMonStatusIconObj(void)
@@ -4659,12 +4661,14 @@ static void CreateHpBarObjs(u16 tileTag, u16 palTag)
     u8 i;
     u8 spriteId;
     void *gfxBufferPtr;
+    u32 mark;
     u32 curHp;
     u32 maxHp;
     u8 hpBarPalTagOffset = 0;
 
     sHpBarObjs = AllocZeroed(sizeof(struct HpBarObjs));
-    gfxBufferPtr = AllocZeroed(0x20 * 12);
+    mark = ArenaMark(&gFrameArena);
+    gfxBufferPtr = FrameAllocZeroed(0x20 * 12);
     LZ77UnCompWram(gSummaryScreen_HpBar_Gfx, gfxBufferPtr);
 
     curHp = GetMonData(&sMonSummaryScreen->currentMon, MON_DATA_HP);
@@ -4718,7 +4722,7 @@ static void CreateHpBarObjs(u16 tileTag, u16 palTag)
     UpdateHpBarObjs();
     ShowOrHideHpBarObjs(TRUE);
 
-    FREE_AND_SET_NULL_IF_SET(gfxBufferPtr);
+    ArenaResetToMark(&gFrameArena, mark);
 }
 
 static void UpdateHpBarObjs(void)
@@ -4819,9 +4823,11 @@ static void CreateExpBarObjs(u16 tileTag, u16 palTag)
     u8 i;
     u8 spriteId;
     void *gfxBufferPtr;
+    u32 mark;
 
     sExpBarObjs = AllocZeroed(sizeof(struct ExpBarObjs));
-    gfxBufferPtr = AllocZeroed(0x20 * 12);
+    mark = ArenaMark(&gFrameArena);
+    gfxBufferPtr = FrameAllocZeroed(0x20 * 12);
 
     LZ77UnCompWram(gSummaryScreen_ExpBar_Gfx, gfxBufferPtr);
     if (gfxBufferPtr != NULL)
@@ -4860,7 +4866,7 @@ static void CreateExpBarObjs(u16 tileTag, u16 palTag)
     UpdateExpBarObjs();
     ShowOrHideExpBarObjs(TRUE);
 
-    FREE_AND_SET_NULL_IF_SET(gfxBufferPtr);
+    ArenaResetToMark(&gFrameArena, mark);
 }
 
 static void UpdateExpBarObjs(void)
@@ -4951,9 +4957,11 @@ static void CreatePokerusIconObj(u16 tileTag, u16 palTag)
 {
     u16 spriteId;
     void *gfxBufferPtr;
+    u32 mark;
 
     sPokerusIconObj = AllocZeroed(sizeof(struct PokerusIconObj));
-    gfxBufferPtr = AllocZeroed(0x20 * 1);
+    mark = ArenaMark(&gFrameArena);
+    gfxBufferPtr = FrameAllocZeroed(0x20 * 1);
 
     LZ77UnCompWram(sPokerusIconObjTiles, gfxBufferPtr);
 
@@ -4988,7 +4996,7 @@ static void CreatePokerusIconObj(u16 tileTag, u16 palTag)
     HideShowPokerusIcon(TRUE);
     ShowPokerusIconObjIfHasOrHadPokerus();
 
-    FREE_AND_SET_NULL_IF_SET(gfxBufferPtr);
+    ArenaResetToMark(&gFrameArena, mark);
 }
 
 static void DestroyPokerusIconObj(void)
@@ -5036,9 +5044,11 @@ static void CreateShinyStarObj(u16 tileTag, u16 palTag)
 {
     u16 spriteId;
     void *gfxBufferPtr;
+    u32 mark;
 
     sShinyStarObjData = AllocZeroed(sizeof(struct ShinyStarObjData));
-    gfxBufferPtr = AllocZeroed(0x20 * 2);
+    mark = ArenaMark(&gFrameArena);
+    gfxBufferPtr = FrameAllocZeroed(0x20 * 2);
 
     LZ77UnCompWram(sStarObjTiles, gfxBufferPtr);
 
@@ -5072,7 +5082,7 @@ static void CreateShinyStarObj(u16 tileTag, u16 palTag)
     HideShowShinyStar(TRUE);
     ShowShinyStarObjIfMonShiny();
 
-    FREE_AND_SET_NULL_IF_SET(gfxBufferPtr);
+    ArenaResetToMark(&gFrameArena, mark);
 }
 
 static void DestroyShinyStarObj(void)
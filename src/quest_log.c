@@ -677,6 +677,7 @@ void QL_ResetPartyAndPC(void)
                 {
                     // Replace the additional slots with placeholder Pokémon.
                     CopyMon(boxMon, &prev->mon.box, sizeof(struct BoxPokemon));
+                    InvalidateBoxMonSummaryAt(i, j);
                     if (++count == prev->boxMonCount)
                         break;
                 }
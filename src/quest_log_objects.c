@@ -1,5 +1,6 @@
 #include "global.h"
 #include "quest_log.h"
+#include "event_object_movement.h"
 #include "fieldmap.h"
 #include "field_player_avatar.h"
 #include "metatile_behavior.h"
@@ -126,6 +127,7 @@ void QL_LoadObjects(const struct QuestLogScene * questLog, const struct ObjectEv
         }
     }
 
+    RebuildObjectEventOccupancy();
     CpuCopy16(gObjectEvents, gSaveBlock1Ptr->objectEvents, sizeof(gObjectEvents));
 }
 
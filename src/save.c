@@ -34,10 +34,14 @@ static void CopyFromSaveBlock3(u32, struct SaveSector *);
  *
  * There are two save slots for saving the player's game data. We alternate between
  * them each time the game is saved, so that if the current save slot is corrupt,
- * we can load the previous one. We also rotate the sectors in each save slot
- * so that the same data is not always being written to the same sector. This
- * might be done to reduce wear on the flash memory, but I'm not sure, since all
- * 14 sectors get written anyway.
+ * we can load the previous one. The original game also rotated the sectors in
+ * each save slot on every save. This is no longer done, so that a sector whose
+ * contents have not changed since the slot was last written can be skipped; a
+ * save never writes a physical sector more often than the rotation did.
+ *
+ * SaveBlock2's sector is always written, and written last, link saves included.
+ * Its counter is the one used to pick the most recent slot, so a save interrupted
+ * part way through leaves the previous save as the most recent one.
  *
  * See SECTOR_ID_* constants in save.h
  */
@@ -83,7 +87,7 @@ STATIC_ASSERT(sizeof(struct SaveBlock2) <= SECTOR_DATA_SIZE, SaveBlock2FreeSpace
 STATIC_ASSERT(sizeof(struct SaveBlock1) <= SECTOR_DATA_SIZE * (SECTOR_ID_SAVEBLOCK1_END - SECTOR_ID_SAVEBLOCK1_START + 1), SaveBlock1FreeSpace);
 STATIC_ASSERT(sizeof(struct PokemonStorage) <= SECTOR_DATA_SIZE * (SECTOR_ID_PKMN_STORAGE_END - SECTOR_ID_PKMN_STORAGE_START + 1), PokemonStorageFreeSpace);
 
-// Sector num to begin writing save data. Sectors are rotated each time the game is saved. (possibly to avoid wear on flash memory?)
+// Sector num to begin writing save data. The original game rotated this each time the game was saved.
 u16 gLastWrittenSector;
 u32 gLastSaveCounter;
 u16 gLastKnownGoodSector;
@@ -100,12 +104,84 @@ u16 gSaveAttemptStatus;
 EWRAM_DATA struct SaveSector gSaveDataBuffer = {0};
 EWRAM_DATA u32 gSaveUnusedVar2 = 0;
 
+// Hashes of what each save slot sector on flash holds, excluding the counter
+// field, which skipped sectors keep from the save that last wrote them.
+EWRAM_DATA static u32 sSaveSectorHashes[NUM_SECTORS_PER_SLOT * NUM_SAVE_SLOTS] = {0};
+EWRAM_DATA static u32 sKnownSaveSectors = 0;
+EWRAM_DATA static struct SaveWriteStats sLastSaveWriteStats = {0};
+
 void ClearSaveData(void)
 {
     u16 i;
 
     for (i = 0; i < SECTORS_COUNT; i++)
         EraseFlashSector(i);
+    sKnownSaveSectors = 0;
+}
+
+// MurmurHash3's mixing, over everything but the counter.
+static u32 HashSaveSector(const struct SaveSector *sector)
+{
+    u32 i, word;
+    u32 hash = 0;
+    const u32 *words = (const u32 *)sector;
+
+    for (i = 0; i < SECTOR_COUNTER_OFFSET / 4; i++)
+    {
+        word = words[i] * 0xCC9E2D51;
+        word = (word << 15) | (word >> 17);
+        hash ^= word * 0x1B873593;
+        hash = (hash << 13) | (hash >> 19);
+        hash = hash * 5 + 0xE6546B64;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static void SetSaveSectorHash(u16 sectorNum, u32 hash, bool32 known)
+{
+    if (sectorNum >= NUM_SECTORS_PER_SLOT * NUM_SAVE_SLOTS)
+        return;
+
+    sSaveSectorHashes[sectorNum] = hash;
+    if (known)
+        sKnownSaveSectors |= 1 << sectorNum;
+    else
+        sKnownSaveSectors &= ~(1 << sectorNum);
+}
+
+static bool32 IsSaveSectorUnchanged(u16 sectorNum, u32 hash)
+{
+    return (sKnownSaveSectors & (1 << sectorNum)) && sSaveSectorHashes[sectorNum] == hash;
+}
+
+static void ResetSaveWriteStats(void)
+{
+    sLastSaveWriteStats = (struct SaveWriteStats){0};
+}
+
+static void RecordSaveSectorWrite(u16 sectorId, bool32 written)
+{
+    if (written)
+    {
+        sLastSaveWriteStats.sectorsWritten |= 1 << sectorId;
+        sLastSaveWriteStats.numWritten++;
+    }
+    else
+    {
+        sLastSaveWriteStats.sectorsSkipped |= 1 << sectorId;
+        sLastSaveWriteStats.numSkipped++;
+    }
+}
+
+const struct SaveWriteStats *GetLastSaveWriteStats(void)
+{
+    return &sLastSaveWriteStats;
 }
 
 void Save_ResetSaveCounters(void)
@@ -150,13 +226,12 @@ static u8 WriteSaveSectorOrSlot(u16 sectorId, const struct SaveSectorLocation *l
     {
         gLastKnownGoodSector = gLastWrittenSector; // backup the current written sector before attempting to write.
         gLastSaveCounter = gSaveCounter;
-        gLastWrittenSector++;
-        gLastWrittenSector %= NUM_SECTORS_PER_SLOT; // array count save sector locations
         gSaveCounter++;
         status = SAVE_STATUS_OK;
 
-        for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+        for (i = SECTOR_ID_SAVEBLOCK2 + 1; i < NUM_SECTORS_PER_SLOT; i++)
             HandleWriteSector(i, locations);
+        HandleWriteSector(SECTOR_ID_SAVEBLOCK2, locations);
 
         // Check for any bad sectors
         if (gDamagedSaveSectors != 0) // skip the damaged sector.
@@ -176,6 +251,8 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectorLocation *locat
     u16 sectorNum;
     u8 *data;
     u16 size;
+    u32 hash;
+    u8 status;
 
     sectorNum = gLastWrittenSector + sectorId;
     sectorNum %= NUM_SECTORS_PER_SLOT;
@@ -199,7 +276,21 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectorLocation *locat
     CopyFromSaveBlock3(sectorId, gReadWriteSector);
 
     gReadWriteSector->checksum = CalculateChecksum(data, size);
-    return TryWriteSector(sectorNum, gReadWriteSector->data);
+
+    // SaveBlock2's sector carries the counter for the slot, so it is always written.
+    // A matching hash is confirmed against flash before the write is skipped.
+    hash = HashSaveSector(gReadWriteSector);
+    if (sectorId != SECTOR_ID_SAVEBLOCK2 && IsSaveSectorUnchanged(sectorNum, hash)
+     && VerifyFlashSectorNBytes(sectorNum, (u8 *)gReadWriteSector, SECTOR_COUNTER_OFFSET) == 0)
+    {
+        RecordSaveSectorWrite(sectorId, FALSE);
+        return SAVE_STATUS_OK;
+    }
+
+    RecordSaveSectorWrite(sectorId, TRUE);
+    status = TryWriteSector(sectorNum, gReadWriteSector->data);
+    SetSaveSectorHash(sectorNum, hash, status == SAVE_STATUS_OK);
+    return status;
 }
 
 static u8 HandleWriteSectorNBytes(u8 sectorId, u8 *data, u16 size)
@@ -238,8 +329,6 @@ static u32 RestoreSaveBackupVarsAndIncrement(const struct SaveSectorLocation *lo
     gReadWriteSector = &gSaveDataBuffer;
     gLastKnownGoodSector = gLastWrittenSector;
     gLastSaveCounter = gSaveCounter;
-    gLastWrittenSector++;
-    gLastWrittenSector %= NUM_SECTORS_PER_SLOT;
     gSaveCounter++;
     gIncrementalSectorId = 0;
     gDamagedSaveSectors = 0;
@@ -256,6 +345,9 @@ static u32 RestoreSaveBackupVars(const struct SaveSectorLocation *locations)
     return 0;
 }
 
+// Writes the sectors after SaveBlock2's, one per call. SaveBlock2's sector holds
+// the slot's counter, so it is replaced last and the slot only becomes the most
+// recent save once that sector's signature is written.
 static u8 HandleWriteIncrementalSector(u16 numSectors, const struct SaveSectorLocation *locations)
 {
     u8 status;
@@ -263,7 +355,7 @@ static u8 HandleWriteIncrementalSector(u16 numSectors, const struct SaveSectorLo
     if (gIncrementalSectorId < numSectors - 1)
     {
         status = SAVE_STATUS_OK;
-        HandleWriteSector(gIncrementalSectorId, locations);
+        HandleWriteSector(gIncrementalSectorId + 1, locations);
         gIncrementalSectorId++;
         if (gDamagedSaveSectors)
         {
@@ -323,6 +415,10 @@ static u8 HandleReplaceSector(u16 sectorId, const struct SaveSectorLocation *loc
 
     gReadWriteSector->checksum = CalculateChecksum(data, size);
 
+    // The signature is written separately, so the sector's contents are unknown until the next load.
+    RecordSaveSectorWrite(sectorId, TRUE);
+    SetSaveSectorHash(sectorNum, 0, FALSE);
+
     // erase old save data
     EraseFlashSector(sectorNum);
 
@@ -480,14 +576,17 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
     for (sector = 0; sector < NUM_SECTORS_PER_SLOT; sector++)
     {
         ReadFlashSector(sector, gReadWriteSector);
+        SetSaveSectorHash(sector, 0, FALSE);
         if (gReadWriteSector->signature == SECTOR_SIGNATURE)
         {
             signatureValid = TRUE;
             checksum = CalculateChecksum(gReadWriteSector->data, locations[gReadWriteSector->id].size);
             if (gReadWriteSector->checksum == checksum)
             {
-                slot1saveCounter = gReadWriteSector->counter;
+                if (gReadWriteSector->id == SECTOR_ID_SAVEBLOCK2)
+                    slot1saveCounter = gReadWriteSector->counter;
                 validSectors |= 1 << gReadWriteSector->id;
+                SetSaveSectorHash(sector, HashSaveSector(gReadWriteSector), TRUE);
             }
         }
     }
@@ -508,14 +607,17 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *locations)
     for (sector = 0; sector < NUM_SECTORS_PER_SLOT; sector++)
     {
         ReadFlashSector(NUM_SECTORS_PER_SLOT + sector, gReadWriteSector);
+        SetSaveSectorHash(NUM_SECTORS_PER_SLOT + sector, 0, FALSE);
         if (gReadWriteSector->signature == SECTOR_SIGNATURE)
         {
             signatureValid = TRUE;
             checksum = CalculateChecksum(gReadWriteSector->data, locations[gReadWriteSector->id].size);
             if (gReadWriteSector->checksum == checksum)
             {
-                slot2saveCounter = gReadWriteSector->counter;
+                if (gReadWriteSector->id == SECTOR_ID_SAVEBLOCK2)
+                    slot2saveCounter = gReadWriteSector->counter;
                 validSectors |= 1 << gReadWriteSector->id;
+                SetSaveSectorHash(NUM_SECTORS_PER_SLOT + sector, HashSaveSector(gReadWriteSector), TRUE);
             }
         }
     }
@@ -654,6 +756,7 @@ u8 HandleSavingData(u8 saveType)
 
     gTrainerTowerVBlankCounter = NULL;
     UpdateSaveAddresses();
+    ResetSaveWriteStats();
     switch (saveType)
     {
     case SAVE_HALL_OF_FAME_ERASE_BEFORE: // Unused
@@ -723,6 +826,7 @@ bool8 LinkFullSave_Init(void)
 
     UpdateSaveAddresses();
     SaveSerializedGame();
+    ResetSaveWriteStats();
     RestoreSaveBackupVarsAndIncrement(gRamSaveSectorLocations);
     return FALSE;
 }
@@ -741,7 +845,7 @@ bool8 LinkFullSave_WriteSector(void)
 
 bool8 LinkFullSave_ReplaceLastSector(void)
 {
-    HandleReplaceSectorAndVerify(NUM_SECTORS_PER_SLOT, gRamSaveSectorLocations);
+    HandleReplaceSectorAndVerify(SECTOR_ID_SAVEBLOCK2 + 1, gRamSaveSectorLocations);
     if (gDamagedSaveSectors)
         DoSaveFailedScreen(SAVE_NORMAL);
 
@@ -750,7 +854,7 @@ bool8 LinkFullSave_ReplaceLastSector(void)
 
 bool8 LinkFullSave_SetLastSectorSignature(void)
 {
-    CopySectorSignatureByte(NUM_SECTORS_PER_SLOT, gRamSaveSectorLocations);
+    CopySectorSignatureByte(SECTOR_ID_SAVEBLOCK2 + 1, gRamSaveSectorLocations);
     if (gDamagedSaveSectors)
         DoSaveFailedScreen(SAVE_NORMAL);
 
@@ -764,6 +868,7 @@ bool8 WriteSaveBlock2(void)
 
     UpdateSaveAddresses();
     SaveSerializedGame();
+    ResetSaveWriteStats();
     RestoreSaveBackupVars(gRamSaveSectorLocations);
 
     // Because RestoreSaveBackupVars is called immediately prior,
@@ -813,6 +918,7 @@ u8 LoadGameSave(u8 saveType)
     default:
         result = TryLoadSaveSlot(FULL_SAVE_SLOT, gRamSaveSectorLocations);
         LoadSerializedGame();
+        InvalidateBoxMonSummaries();
         gSaveFileStatus = result;
         gGameContinueCallback = NULL;
         break;
@@ -4,6 +4,7 @@
 
 #include "dma3.h"
 #include "gpu_regs.h"
+#include "palette.h"
 #include "text.h"
 
 #include "decompress.h"
@@ -58,7 +59,7 @@ bool32 RunSaveFailedScreen(void)
         break;
     case 2:
         RequestDma3Fill(0, (void *)BG_CHAR_ADDR(3), BG_CHAR_SIZE, DMA3_16BIT);
-        RequestDma3Copy(sSaveFailedScreenPals, (void *)PLTT, 0x20, DMA3_16BIT);
+        RequestDma3Copy(sSaveFailedScreenPals, (void *)PLTT, 0x20, DMA3_16BIT | DMA3_PRIORITY);
         sSaveFailedScreenState = 3;
         break;
     case 3:
@@ -96,6 +97,8 @@ bool32 RunSaveFailedScreen(void)
         SetGpuReg(REG_OFFSET_DISPCNT, 0);
         RestoreMapTiles();
         BlankPalettes();
+        // Let TransferPlttBuffer restore the whole palette once callbacks are back.
+        MarkPalettesDirty(PALETTES_ALL);
         sSaveFailedScreenState = 8;
         break;
     case 8:
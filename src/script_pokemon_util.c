@@ -51,6 +51,7 @@ static void HealPlayerBoxes(void)
                 HealBoxPokemon(boxMon);
         }
     }
+    InvalidateBoxMonSummaries();
 }
 
 void CanHyperTrain(struct ScriptContext *ctx)
@@ -2022,7 +2022,7 @@ static bool8 SlotsTask_GraphicsInit(u8 * state, struct SlotMachineSetupTaskData
         SetVBlankCallback(NULL);
         ResetSpriteData();
         FreeAllSpritePalettes();
-        RequestDma3Fill(0, (void *)OAM, OAM_SIZE, DMA3_32BIT);
+        RequestDma3Fill(0, (void *)OAM, OAM_SIZE, DMA3_32BIT | DMA3_PRIORITY);
         RequestDma3Fill(0, (void *)VRAM, 0x20, DMA3_32BIT);
         RequestDma3Fill(0, (void *)(VRAM + 0xC000), 0x20, DMA3_32BIT);
         SetGpuReg(REG_OFFSET_DISPCNT, 0);
@@ -2432,6 +2432,7 @@ static void Task_FlashWinningLine(u8 taskId)
 
         for (i = 0; i < ARRAY_COUNT(sWinningLineFlashPalIdxs); i++)
             gPlttBufferFaded[sWinningLineFlashPalIdxs[i] + BG_PLTT_ID(PALSLOT_LINE_MATCH)] = gPlttBufferUnfaded[sWinningLineFlashPalIdxs[i] + BG_PLTT_ID(PALSLOT_LINE_MATCH)];
+        MarkPalettesDirty(1 << PALSLOT_LINE_MATCH);
         break;
     case 2:
         // Restore match lines to normal color 
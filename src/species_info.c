@@ -0,0 +1,45 @@
+#include "global.h"
+#include "battle.h"
+#include "event_object_movement.h"
+#include "graphics.h"
+#include "pokemon_animation.h"
+#include "constants/abilities.h"
+#include "constants/cries.h"
+#include "constants/event_objects.h"
+#include "constants/form_change_types.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+
+// The species data and the tables only it refers to, kept out of pokemon.c
+// so that data edits and code edits each only recompile their own half.
+#include "data/graphics/pokemon.h"
+#include "data/pokemon_graphics/front_pic_anims.h"
+
+#if P_LVL_UP_LEARNSETS >= GEN_9
+#include "data/pokemon/level_up_learnsets/gen_9.h" // Scarlet/Violet
+#elif P_LVL_UP_LEARNSETS >= GEN_8
+#include "data/pokemon/level_up_learnsets/gen_8.h" // Sword/Shield
+#elif P_LVL_UP_LEARNSETS >= GEN_7
+#include "data/pokemon/level_up_learnsets/gen_7.h" // Ultra Sun/ Ultra Moon
+#elif P_LVL_UP_LEARNSETS >= GEN_6
+#include "data/pokemon/level_up_learnsets/gen_6.h" // Omega Ruby/Alpha Sapphire
+#elif P_LVL_UP_LEARNSETS >= GEN_5
+#include "data/pokemon/level_up_learnsets/gen_5.h" // Black 2/White 2
+#elif P_LVL_UP_LEARNSETS >= GEN_4
+#include "data/pokemon/level_up_learnsets/gen_4.h" // HeartGold/SoulSilver
+#elif P_LVL_UP_LEARNSETS >= GEN_3
+#include "data/pokemon/level_up_learnsets/gen_3.h" // Ruby/Sapphire/Emerald
+#elif P_LVL_UP_LEARNSETS >= GEN_2
+#include "data/pokemon/level_up_learnsets/gen_2.h" // Crystal
+#elif P_LVL_UP_LEARNSETS >= GEN_1
+#include "data/pokemon/level_up_learnsets/gen_1.h" // Yellow
+#endif
+
+#include "data/pokemon/teachable_learnsets.h"
+#include "data/pokemon/egg_moves.h"
+#include "data/pokemon/form_species_tables.h"
+#include "data/pokemon/form_change_tables.h"
+#include "data/pokemon/form_change_table_pointers.h"
+#include "data/object_events/object_event_pic_tables_followers.h"
+
+#include "data/pokemon/species_info.h"
@@ -64,6 +64,19 @@ static void SpriteCB_TextCursor(struct Sprite *sprite);
 static EWRAM_DATA struct TextPrinter sTempTextPrinter = {0};
 static EWRAM_DATA struct TextPrinter sTextPrinters[NUM_TEXT_PRINTERS] = {0};
 
+// Decompressed glyphs, keyed by font, glyph and the colors they were
+// decompressed with. Replaced least recently used first. sGlyphCacheOrder
+// lists the entries from most to least recently used, so the common
+// letters of a text are found after a few compares.
+#define GLYPH_CACHE_SIZE 32
+#define GLYPH_CACHE_VALID (1u << 31)
+
+static EWRAM_DATA u32 sGlyphCacheKeys[GLYPH_CACHE_SIZE] = {0};
+static EWRAM_DATA u8 sGlyphCacheOrder[GLYPH_CACHE_SIZE] = {0};
+static EWRAM_DATA struct GlyphInfo sGlyphCache[GLYPH_CACHE_SIZE] = {0};
+static EWRAM_DATA struct GlyphCacheStats sGlyphCacheStats = {0};
+static EWRAM_DATA bool8 sGlyphCacheDisabled = FALSE;
+
 static u16 sFontHalfRowLookupTable[0x51];
 static u16 sLastTextBgColor;
 static u16 sLastTextFgColor;
@@ -335,6 +348,7 @@ static const u16 sFontBoldJapaneseGlyphs[] = INCBIN_U16("graphics/fonts/japanese
 void SetFontsPointer(const struct FontInfo *fonts)
 {
     gFonts = fonts;
+    ClearGlyphCache();
 }
 
 void DeactivateAllTextPrinters (void)
@@ -510,72 +524,62 @@ u8 GetLastTextColor(u8 colorType)
     }
 }
 
-#define GLYPH_COPY(widthOffset, heightOffset, width, height, tilesDest, left, top, sizeX)                                                    \
-{                                                                                                                                            \
-    int xAdd, xpos, yAdd, ypos, toOrr, bits;                                                                                                 \
-    u8 * src, * dst;                                                                                                                         \
-    u32 _8pixbuf;                                                                                                                            \
-                                                                                                                                             \
-    src = gGlyphInfo.pixels + (heightOffset / 8 * 0x40) + (widthOffset / 8 * 0x20);                                                          \
-    for (yAdd = 0, ypos = top + heightOffset; yAdd < height; yAdd++, ypos++)                                                                 \
-    {                                                                                                                                        \
-        _8pixbuf = *(u32 *)src;                                                                                                              \
-        for (xAdd = 0, xpos = left + widthOffset; xAdd < width; xAdd++, xpos++)                                                              \
-        {                                                                                                                                    \
-            dst = (u8 *)((tilesDest) + ((xpos >> 1) & 3) + ((xpos >> 3) << 5) + (((ypos >> 3) * (sizeX)) << 5) + ((u32)(ypos << 29) >> 27)); \
-            toOrr = (_8pixbuf >> (xAdd * 4)) & 0xF;                                                                                          \
-            if (toOrr != 0)                                                                                                                  \
-            {                                                                                                                                \
-                bits = (xpos & 1) * 4;                                                                                                       \
-                *dst = (toOrr << bits) | (*dst & (0xF0 >> bits));                                                                            \
-            }                                                                                                                                \
-        }                                                                                                                                    \
-        src += 4;                                                                                                                            \
-    }                                                                                                                                        \
-}
-
-void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+// Blits up to 8x8 pixels of a glyph. Each row of the glyph is a word of
+// 4bpp pixels, which spans at most two tiles of the window. Pixels with
+// color 0 are transparent.
+static void CopyGlyphBlockToWindow(const u32 *src, u8 *tiles, u32 widthInTiles, u32 x, u32 y, s32 width, s32 height)
 {
-    int glyphWidth, glyphHeight;
-    u8 sizeType;
-    
-    if (gWindows[textPrinter->printerTemplate.windowId].window.width * 8 - textPrinter->printerTemplate.currentX < gGlyphInfo.width)
-        glyphWidth = gWindows[textPrinter->printerTemplate.windowId].window.width * 8 - textPrinter->printerTemplate.currentX;
-    else
-        glyphWidth = gGlyphInfo.width;
-    if (gWindows[textPrinter->printerTemplate.windowId].window.height * 8 - textPrinter->printerTemplate.currentY < gGlyphInfo.height)
-        glyphHeight = gWindows[textPrinter->printerTemplate.windowId].window.height * 8 - textPrinter->printerTemplate.currentY;
-    else
-        glyphHeight = gGlyphInfo.height;
+    u32 widthMask, shift, row, mask;
+    u32 *dst;
 
-    sizeType = 0;
-    if (glyphWidth > 8)
-        sizeType |= 1;
-    if (glyphHeight > 8)
-        sizeType |= 2;
-    
-    switch (sizeType)
+    if (width <= 0 || height <= 0)
+        return;
+
+    widthMask = width >= 8 ? 0xFFFFFFFF : (1u << (width * 4)) - 1;
+    shift = (x & 7) * 4;
+    for (; height > 0; height--, y++)
     {
-        case 0: // ≤ 8x8
-            GLYPH_COPY(0, 0, glyphWidth, glyphHeight, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            return;
-        case 1: // ≤ 16x8
-            GLYPH_COPY(0, 0, 8, glyphHeight, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            GLYPH_COPY(8, 0, glyphWidth - 8, glyphHeight, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            return;
-        case 2: // ≤ 8x16
-            GLYPH_COPY(0, 0, glyphWidth, 8, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            GLYPH_COPY(0, 8, glyphWidth, glyphHeight - 8, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            return;
-        case 3: // ≤ 16x16
-            GLYPH_COPY(0, 0, 8, 8, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            GLYPH_COPY(8, 0, glyphWidth - 8, 8, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            GLYPH_COPY(0, 8, 8, glyphHeight - 8, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            GLYPH_COPY(8, 8, glyphWidth - 8, glyphHeight - 8, gWindows[textPrinter->printerTemplate.windowId].tileData, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY, ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8 + ((gWindows[textPrinter->printerTemplate.windowId].window.width * 8) & 7)) >> 3));
-            return;
+        row = *src++ & widthMask;
+        if (row == 0)
+            continue;
+
+        // Set every bit of the opaque pixels.
+        mask = row | (row >> 1) | (row >> 2) | (row >> 3);
+        mask = (mask & 0x11111111) * 0xF;
+
+        dst = (u32 *)(tiles + (((y / 8) * widthInTiles + (x / 8)) * TILE_SIZE_4BPP) + (y % 8) * 4);
+        *dst = (*dst & ~(mask << shift)) | (row << shift);
+        if (shift != 0 && (mask >> (32 - shift)) != 0)
+        {
+            dst += TILE_SIZE_4BPP / 4; // same row of the next tile
+            *dst = (*dst & ~(mask >> (32 - shift))) | (row >> (32 - shift));
+        }
     }
 }
 
+static void CopyGlyphPixelsToWindow(struct TextPrinter *textPrinter, const struct GlyphInfo *glyph)
+{
+    struct Window *window = &gWindows[textPrinter->printerTemplate.windowId];
+    const u32 *pixels = (const u32 *)glyph->pixels;
+    u32 x = textPrinter->printerTemplate.currentX;
+    u32 y = textPrinter->printerTemplate.currentY;
+    s32 glyphWidth, glyphHeight;
+
+    glyphWidth = min(glyph->width, window->window.width * 8 - (s32)x);
+    glyphHeight = min(glyph->height, window->window.height * 8 - (s32)y);
+
+    // The glyph is stored as up to 2x2 tiles.
+    CopyGlyphBlockToWindow(pixels, window->tileData, window->window.width, x, y, min(glyphWidth, 8), min(glyphHeight, 8));
+    CopyGlyphBlockToWindow(pixels + 8, window->tileData, window->window.width, x + 8, y, glyphWidth - 8, min(glyphHeight, 8));
+    CopyGlyphBlockToWindow(pixels + 16, window->tileData, window->window.width, x, y + 8, min(glyphWidth, 8), glyphHeight - 8);
+    CopyGlyphBlockToWindow(pixels + 24, window->tileData, window->window.width, x + 8, y + 8, glyphWidth - 8, glyphHeight - 8);
+}
+
+void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+{
+    CopyGlyphPixelsToWindow(textPrinter, &gGlyphInfo);
+}
+
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width)
 {
     struct Window *window;
@@ -918,9 +922,119 @@ void DrawDownArrow(u8 windowId, u16 x, u16 y, u8 bgColor, bool8 drawArrow, u8 *c
     }
 }
 
+static void DecompressGlyph(u32 fontId, u16 glyphId, bool32 isJapanese)
+{
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_1:
+        DecompressGlyph_NormalCopy1(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_2:
+        DecompressGlyph_NormalCopy2(glyphId, isJapanese);
+        break;
+    case FONT_MALE:
+        DecompressGlyph_Male(glyphId, isJapanese);
+        break;
+    case FONT_FEMALE:
+        DecompressGlyph_Female(glyphId, isJapanese);
+        break;
+    case FONT_NARROW:
+        DecompressGlyph_Narrow(glyphId, isJapanese);
+        break;
+    case FONT_SMALL_NARROW:
+        DecompressGlyph_SmallNarrow(glyphId, isJapanese);
+        break;
+    case FONT_NARROWER:
+        DecompressGlyph_Narrower(glyphId, isJapanese);
+        break;
+    case FONT_SMALL_NARROWER:
+        DecompressGlyph_SmallNarrower(glyphId, isJapanese);
+        break;
+    case FONT_SHORT_NARROW:
+        DecompressGlyph_ShortNarrow(glyphId, isJapanese);
+        break;
+    case FONT_SHORT:
+        DecompressGlyph_Short(glyphId, isJapanese);
+        break;
+    }
+}
+
+static const struct GlyphInfo *GetCachedGlyph(u32 fontId, u16 glyphId, bool32 isJapanese)
+{
+    u32 i, entry;
+    u32 key = GLYPH_CACHE_VALID
+            | glyphId
+            | (fontId << 9)
+            | ((isJapanese == TRUE) << 13)
+            | (sLastTextBgColor << 14)
+            | (sLastTextFgColor << 18)
+            | (sLastTextShadowColor << 22);
+
+    if (sGlyphCacheDisabled)
+    {
+        DecompressGlyph(fontId, glyphId, isJapanese);
+        return &gGlyphInfo;
+    }
+
+    for (i = 0; i < GLYPH_CACHE_SIZE - 1; i++)
+    {
+        if (sGlyphCacheKeys[sGlyphCacheOrder[i]] == key)
+            break;
+    }
+
+    entry = sGlyphCacheOrder[i];
+    if (sGlyphCacheKeys[entry] == key)
+    {
+        sGlyphCacheStats.hits++;
+    }
+    else
+    {
+        // Not found, so i is the least recently used entry.
+        sGlyphCacheStats.misses++;
+        DecompressGlyph(fontId, glyphId, isJapanese);
+        sGlyphCacheKeys[entry] = key;
+        sGlyphCache[entry] = gGlyphInfo;
+    }
+
+    for (; i > 0; i--)
+        sGlyphCacheOrder[i] = sGlyphCacheOrder[i - 1];
+    sGlyphCacheOrder[0] = entry;
+    return &sGlyphCache[entry];
+}
+
+void ClearGlyphCache(void)
+{
+    u32 i;
+
+    for (i = 0; i < GLYPH_CACHE_SIZE; i++)
+    {
+        sGlyphCacheKeys[i] = 0;
+        sGlyphCacheOrder[i] = i;
+    }
+    sGlyphCacheStats.hits = 0;
+    sGlyphCacheStats.misses = 0;
+}
+
+void SetGlyphCacheEnabled(bool32 enabled)
+{
+    sGlyphCacheDisabled = !enabled;
+}
+
+const struct GlyphCacheStats *GetGlyphCacheStats(void)
+{
+    return &sGlyphCacheStats;
+}
+
 u16 RenderText(struct TextPrinter *textPrinter)
 {
     struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+    const struct GlyphInfo *glyph;
     u16 currChar;
     s32 width;
     s32 widthHelper;
@@ -1106,47 +1220,10 @@ u16 RenderText(struct TextPrinter *textPrinter)
             return RENDER_FINISH;
         }
 
-        switch (subStruct->glyphId)
-        {
-        case FONT_SMALL:
-            DecompressGlyph_Small(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL_COPY_1:
-            DecompressGlyph_NormalCopy1(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL:
-            DecompressGlyph_Normal(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL_COPY_2:
-            DecompressGlyph_NormalCopy2(currChar, textPrinter->japanese);
-            break;
-        case FONT_MALE:
-            DecompressGlyph_Male(currChar, textPrinter->japanese);
-            break;
-        case FONT_FEMALE:
-            DecompressGlyph_Female(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROW:
-            DecompressGlyph_Narrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROW:
-            DecompressGlyph_SmallNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROWER:
-            DecompressGlyph_Narrower(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROWER:
-            DecompressGlyph_SmallNarrower(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT_NARROW:
-            DecompressGlyph_ShortNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT:
-            DecompressGlyph_Short(currChar, textPrinter->japanese);
-            break;
-        }
-
-        CopyGlyphToWindow(textPrinter);
+        glyph = GetCachedGlyph(subStruct->glyphId, currChar, textPrinter->japanese);
+        gGlyphInfo.width = glyph->width;
+        gGlyphInfo.height = glyph->height;
+        CopyGlyphPixelsToWindow(textPrinter, glyph);
 
         if (textPrinter->minLetterSpacing)
         {
@@ -860,6 +860,7 @@ static void Task_TitleScreen_BlinkPressStart(u8 taskId)
                     gPlttBufferFaded[BG_PLTT_ID(15) + 1 + i] = gGraphics_TitleScreen_BackgroundPals[1 + i];
                 }
             }
+            MarkPaletteRangeDirty(BG_PLTT_ID(15) + 1, 5);
             if (data[14])
             {
                 BlendPalettes(0x00008000, gPaletteFade.y, gPaletteFade.blendColor);
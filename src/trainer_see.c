@@ -55,6 +55,18 @@ bool8 gTrainerApproachedPlayer;
 // EWRAM
 EWRAM_DATA u8 gApproachingTrainerId = 0;
 
+// Trainers whose line of sight runs along each column (facing north or
+// south) and each row (facing west or east), folded modulo
+// SIGHT_INDEX_SIZE. A step only checks the trainers in its column and row.
+#define SIGHT_INDEX_SIZE 32
+#define SIGHT_INDEX_NONE 0xFF
+#define SIGHT_INDEX(coord) ((coord) & (SIGHT_INDEX_SIZE - 1))
+
+static EWRAM_DATA u16 sTrainersSeeingColumn[SIGHT_INDEX_SIZE] = {0};
+static EWRAM_DATA u16 sTrainersSeeingRow[SIGHT_INDEX_SIZE] = {0};
+static EWRAM_DATA u8 sTrainerSightColumns[OBJECT_EVENTS_COUNT] = {0};
+static EWRAM_DATA u8 sTrainerSightRows[OBJECT_EVENTS_COUNT] = {0};
+
 static const u16 sGfx_Emoticons[] = INCBIN_U16("graphics/misc/emoticons.4bpp");
 static const u8 sEmotion_Gfx[] = INCBIN_U8("graphics/misc/emotes.4bpp");
 
@@ -116,9 +128,49 @@ static const TrainerSeeFunc sTrainerSeeFuncList2[] = {
     TrainerSeeFunc_EndJumpOutOfAsh
 };
 
+void UpdateTrainerSight(struct ObjectEvent *objectEvent)
+{
+    u32 objectEventId = objectEvent - gObjectEvents;
+    u32 bit = 1 << objectEventId;
+    u32 column = SIGHT_INDEX_NONE, row = SIGHT_INDEX_NONE;
+
+    if (sTrainerSightColumns[objectEventId] != SIGHT_INDEX_NONE)
+        sTrainersSeeingColumn[sTrainerSightColumns[objectEventId]] &= ~bit;
+    if (sTrainerSightRows[objectEventId] != SIGHT_INDEX_NONE)
+        sTrainersSeeingRow[sTrainerSightRows[objectEventId]] &= ~bit;
+
+    if (objectEvent->active
+     && objectEvent->trainerRange_berryTreeId != 0
+     && (objectEvent->trainerType == TRAINER_TYPE_NORMAL || objectEvent->trainerType == TRAINER_TYPE_BURIED))
+    {
+        if (objectEvent->trainerType != TRAINER_TYPE_NORMAL
+         || objectEvent->facingDirection == DIR_SOUTH
+         || objectEvent->facingDirection == DIR_NORTH)
+            column = SIGHT_INDEX(objectEvent->currentCoords.x);
+        if (objectEvent->trainerType != TRAINER_TYPE_NORMAL
+         || objectEvent->facingDirection == DIR_WEST
+         || objectEvent->facingDirection == DIR_EAST)
+            row = SIGHT_INDEX(objectEvent->currentCoords.y);
+    }
+
+    sTrainerSightColumns[objectEventId] = column;
+    sTrainerSightRows[objectEventId] = row;
+    if (column != SIGHT_INDEX_NONE)
+        sTrainersSeeingColumn[column] |= bit;
+    if (row != SIGHT_INDEX_NONE)
+        sTrainersSeeingRow[row] |= bit;
+}
+
+// Superset of the trainers who can see the given coords.
+u32 GetTrainersWhoMaySeeCoords(s16 x, s16 y)
+{
+    return sTrainersSeeingColumn[SIGHT_INDEX(x)] | sTrainersSeeingRow[SIGHT_INDEX(y)];
+}
+
 bool8 CheckForTrainersWantingBattle(void)
 {
-    u8 i;
+    u32 i, candidates;
+    s16 x, y;
     if (QL_IsTrainerSightDisabled() == TRUE)
         return FALSE;
 
@@ -128,10 +180,14 @@ bool8 CheckForTrainersWantingBattle(void)
     gNoOfApproachingTrainers = 0;
     gApproachingTrainerId = 0;
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    PlayerGetDestCoords(&x, &y);
+    candidates = GetTrainersWhoMaySeeCoords(x, y);
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
         u8 numTrainers;
 
+        if (!(candidates & 1))
+            continue;
         if (!gObjectEvents[i].active)
             continue;
         if (gObjectEvents[i].trainerType != TRAINER_TYPE_NORMAL && gObjectEvents[i].trainerType != TRAINER_TYPE_BURIED)
@@ -278,6 +278,8 @@ u32 CalcByteArraySum(const u8 * array, u32 size)
 void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u32 blendColor)
 {
     u16 i;
+
+    MarkPaletteRangeDirty(palOffset, numEntries);
     for (i = 0; i < numEntries; i++)
     {
         u16 index = i + palOffset;
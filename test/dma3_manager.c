@@ -0,0 +1,101 @@
+#include "global.h"
+#include "dma3.h"
+#include "main.h"
+#include "malloc.h"
+#include "test/test.h"
+
+// Returns just after the vblank interrupt, which also processes the DMA3
+// requests, so that the test can queue and process its own before the next.
+static void WaitForVBlankIntr(void)
+{
+    u32 counter = gMain.vblankCounter2;
+
+    while (*(volatile u32 *)&gMain.vblankCounter2 == counter)
+        ;
+}
+
+TEST("RequestDma3Copy merges a copy which continues the previous one")
+{
+    u32 i;
+    s16 first, second;
+    u8 *src = Alloc(0x200);
+    u8 *dest = AllocZeroed(0x200);
+
+    for (i = 0; i < 0x200; i++)
+        src[i] = i * 7;
+
+    ClearDma3Requests();
+    WaitForVBlankIntr();
+    first = RequestDma3Copy(src, dest, 0x100, DMA3_32BIT);
+    second = RequestDma3Copy(src + 0x100, dest + 0x100, 0x100, DMA3_32BIT);
+    ProcessDma3Requests();
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(GetDma3FrameStats()->requestsMerged, 1);
+    EXPECT_EQ(GetDma3FrameStats()->bytesTransferred, 0x200);
+    EXPECT(memcmp(src, dest, 0x200) == 0);
+    Free(src);
+    Free(dest);
+}
+
+TEST("RequestDma3Copy does not merge copies with a gap between them")
+{
+    s16 first, second;
+    u8 *src = AllocZeroed(0x200);
+    u8 *dest = Alloc(0x200);
+
+    ClearDma3Requests();
+    WaitForVBlankIntr();
+    first = RequestDma3Copy(src, dest, 0x100, DMA3_32BIT);
+    second = RequestDma3Copy(src + 0x104, dest + 0x100, 0x100, DMA3_32BIT);
+    ProcessDma3Requests();
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(GetDma3FrameStats()->requestsMerged, 0);
+    Free(src);
+    Free(dest);
+}
+
+TEST("Priority DMA3 requests do not overtake overlapping normal ones")
+{
+    u32 *dest = Alloc(16);
+
+    ClearDma3Requests();
+    WaitForVBlankIntr();
+    RequestDma3Fill(0x11111111, dest, 16, DMA3_32BIT);
+    RequestDma3Fill(0x22222222, dest + 2, 8, DMA3_32BIT | DMA3_PRIORITY);
+    ProcessDma3Requests();
+
+    // The last write to each word wins.
+    EXPECT_EQ(dest[0], 0x11111111);
+    EXPECT_EQ(dest[1], 0x11111111);
+    EXPECT_EQ(dest[2], 0x22222222);
+    EXPECT_EQ(dest[3], 0x22222222);
+    Free(dest);
+}
+
+TEST("DMA3 requests over the vblank budget are deferred to the next frame")
+{
+    const u8 *src = (const u8 *)ROM_START;
+    u8 *dest = (u8 *)BG_VRAM;
+    s16 first, second;
+
+    // Each copy takes most of a vblank, so only one fits in a frame.
+    ClearDma3Requests();
+    WaitForVBlankIntr();
+    first = RequestDma3Copy(src, dest, 0x8000, DMA3_32BIT);
+    second = RequestDma3Copy(src + 0x10000, dest + 0x8000, 0x8000, DMA3_32BIT);
+    ProcessDma3Requests();
+
+    EXPECT_EQ(WaitDma3Request(first), 0);
+    EXPECT_EQ(WaitDma3Request(second), -1);
+    EXPECT_EQ(GetDma3FrameStats()->bytesTransferred, 0x8000);
+    EXPECT_EQ(GetDma3FrameStats()->bytesDeferred, 0x8000);
+    EXPECT(memcmp(src, dest, 0x8000) == 0);
+
+    WaitForVBlankIntr();
+    EXPECT_EQ(WaitDma3Request(second), 0);
+    EXPECT_EQ(GetDma3FrameStats()->bytesTransferred, 0x8000);
+    EXPECT_EQ(GetDma3FrameStats()->bytesDeferred, 0);
+    EXPECT(memcmp(src + 0x10000, dest + 0x8000, 0x8000) == 0);
+}
@@ -0,0 +1,151 @@
+#include "global.h"
+#include "event_object_movement.h"
+#include "random.h"
+#include "test/test.h"
+#include "constants/event_object_movement.h"
+#include "constants/event_objects.h"
+
+static struct ObjectEvent *AddTestObjectEvent(u32 objectEventId, s16 x, s16 y, u8 elevation)
+{
+    struct ObjectEvent *objectEvent = &gObjectEvents[objectEventId];
+
+    objectEvent->active = TRUE;
+    objectEvent->currentElevation = elevation;
+    ShiftObjectEventCoords(objectEvent, x, y);
+    ShiftStillObjectEventCoords(objectEvent);
+    return objectEvent;
+}
+
+// The linear scans which the occupancy grid replaced.
+static u32 FindObjectEventIdByXY(s16 x, s16 y)
+{
+    u32 i;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            break;
+    }
+    return i;
+}
+
+static bool32 FindObjectCollisionAt(struct ObjectEvent *objectEvent, s16 x, s16 y)
+{
+    u32 i;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        struct ObjectEvent *curObject = &gObjectEvents[i];
+
+        if (curObject->active && curObject != objectEvent
+         && ((curObject->currentCoords.x == x && curObject->currentCoords.y == y) || (curObject->previousCoords.x == x && curObject->previousCoords.y == y))
+         && (objectEvent->currentElevation == 0 || curObject->currentElevation == 0 || objectEvent->currentElevation == curObject->currentElevation))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+// (5, 5), (13, 5) and (21, 5) share an occupancy grid cell.
+TEST("Object event lookups by position find only the objects at that position")
+{
+    u32 i;
+    struct ObjectEvent *player, *other, *walker, *follower;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        gObjectEvents[i] = (struct ObjectEvent){};
+        gObjectEvents[i].localId = i + 1;
+    }
+    RebuildObjectEventOccupancy();
+    gPlayerAvatar.objectEventId = 0;
+    player = AddTestObjectEvent(0, 5, 5, 3);
+    other = AddTestObjectEvent(3, 13, 5, 4);
+    walker = AddTestObjectEvent(4, 6, 5, 0);
+    ShiftObjectEventCoords(walker, 7, 5);
+    follower = AddTestObjectEvent(2, 30, 30, 0);
+    follower->localId = OBJ_EVENT_ID_FOLLOWER;
+    // Inactive objects are never found.
+    gObjectEvents[5].currentCoords.x = 21;
+    gObjectEvents[5].currentCoords.y = 5;
+    UpdateObjectEventOccupancy(&gObjectEvents[5]);
+
+    EXPECT_EQ(GetObjectEventIdByXY(5, 5), 0);
+    EXPECT_EQ(GetObjectEventIdByXY(13, 5), 3);
+    EXPECT_EQ(GetObjectEventIdByXY(21, 5), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByXY(6, 5), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByXY(7, 5), 4);
+
+    EXPECT_EQ(GetObjectEventIdByPosition(13, 5, 4), 3);
+    EXPECT_EQ(GetObjectEventIdByPosition(13, 5, 3), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByPosition(13, 5, 0), 3);
+    EXPECT_EQ(GetObjectEventIdByPosition(7, 5, 2), 4);
+
+    // Objects block both the tile they are on and the one they left.
+    EXPECT(DoesObjectCollideWithObjectAt(player, 6, 5));
+    EXPECT(DoesObjectCollideWithObjectAt(player, 7, 5));
+    EXPECT(!DoesObjectCollideWithObjectAt(player, 13, 5));
+    EXPECT(!DoesObjectCollideWithObjectAt(player, 21, 5));
+    EXPECT(DoesObjectCollideWithObjectAt(walker, 13, 5));
+    EXPECT(!DoesObjectCollideWithObjectAt(walker, 7, 5));
+    EXPECT(!DoesObjectCollideWithObjectAt(follower, 5, 5));
+
+    other->active = FALSE;
+    UpdateObjectEventOccupancy(other);
+    MoveObjectEventToMapCoords(walker, 21, 5);
+    EXPECT_EQ(GetObjectEventIdByXY(13, 5), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByXY(7, 5), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByXY(21, 5), 4);
+    EXPECT(!DoesObjectCollideWithObjectAt(player, 6, 5));
+    EXPECT(DoesObjectCollideWithObjectAt(player, 21, 5));
+}
+
+#define FUZZ_AREA_SIZE 20
+
+TEST("Object event lookups by position match a linear scan while objects move")
+{
+    u32 i, step;
+    s16 x, y;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        gObjectEvents[i] = (struct ObjectEvent){};
+        gObjectEvents[i].localId = i + 1;
+    }
+    RebuildObjectEventOccupancy();
+    gPlayerAvatar.objectEventId = 0;
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        AddTestObjectEvent(i, Random() % FUZZ_AREA_SIZE, Random() % FUZZ_AREA_SIZE, Random() % 4);
+
+    for (step = 0; step < 200; step++)
+    {
+        struct ObjectEvent *objectEvent = &gObjectEvents[Random() % OBJECT_EVENTS_COUNT];
+
+        switch (Random() % 4)
+        {
+        case 0: // Step to a neighboring tile, wrapping around the area.
+            x = objectEvent->currentCoords.x + (Random() % 3) - 1;
+            y = objectEvent->currentCoords.y + (Random() % 3) - 1;
+            ShiftObjectEventCoords(objectEvent, (x + FUZZ_AREA_SIZE) % FUZZ_AREA_SIZE, (y + FUZZ_AREA_SIZE) % FUZZ_AREA_SIZE);
+            break;
+        case 1: // Finish the step.
+            ShiftStillObjectEventCoords(objectEvent);
+            break;
+        case 2:
+            MoveObjectEventToMapCoords(objectEvent, Random() % FUZZ_AREA_SIZE, Random() % FUZZ_AREA_SIZE);
+            break;
+        case 3:
+            objectEvent->active ^= 1;
+            UpdateObjectEventOccupancy(objectEvent);
+            break;
+        }
+
+        for (y = 0; y < FUZZ_AREA_SIZE; y++)
+        {
+            for (x = 0; x < FUZZ_AREA_SIZE; x++)
+            {
+                EXPECT_EQ(GetObjectEventIdByXY(x, y), FindObjectEventIdByXY(x, y));
+                EXPECT_EQ(DoesObjectCollideWithObjectAt(objectEvent, x, y), FindObjectCollisionAt(objectEvent, x, y));
+            }
+        }
+    }
+}
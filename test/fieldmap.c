@@ -0,0 +1,57 @@
+#include "global.h"
+#include "fieldmap.h"
+#include "overworld.h"
+#include "test/test.h"
+#include "constants/map_groups.h"
+
+static void LoadTestMap(void)
+{
+    gMapHeader = *Overworld_GetMapHeaderByGroupAndId(MAP_GROUP(ROUTE1), MAP_NUM(ROUTE1));
+    InitMap();
+}
+
+TEST("MapGridGetMetatileBehaviorAt and MapGridGetMetatileLayerTypeAt match the tileset attributes")
+{
+    s32 x, y;
+
+    LoadTestMap();
+    MapGridSetMetatileIdAt(MAP_OFFSET + 3, MAP_OFFSET + 4, MapGridGetMetatileIdAt(MAP_OFFSET, MAP_OFFSET) + 1);
+    MapGridSetMetatileImpassabilityAt(0, 0, TRUE);
+
+    // Includes coords outside the map, which fall back to its border.
+    for (y = -2; y < VMap.Ysize + 2; y++)
+    {
+        for (x = -2; x < VMap.Xsize + 2; x++)
+        {
+            EXPECT_EQ(MapGridGetMetatileBehaviorAt(x, y), MapGridGetMetatileAttributeAt(x, y, METATILE_ATTRIBUTE_BEHAVIOR));
+            EXPECT_EQ(MapGridGetMetatileLayerTypeAt(x, y), MapGridGetMetatileAttributeAt(x, y, METATILE_ATTRIBUTE_LAYER_TYPE));
+        }
+    }
+}
+
+// Roughly the lookups made by the player and a follower taking one step.
+#define STEP_LOOKUPS 24
+
+TEST("Cached metatile behaviors are faster to look up during a step")
+{
+    struct Benchmark cached, uncached;
+    u32 i, behaviors = 0;
+    s32 x = MAP_OFFSET + 8, y = MAP_OFFSET + 8;
+
+    ASSUME(OW_METATILE_ATTRIBUTE_CACHE);
+    LoadTestMap();
+
+    BENCHMARK(&uncached)
+    {
+        for (i = 0; i < STEP_LOOKUPS; i++)
+            behaviors += MapGridGetMetatileAttributeAt(x + (i % 3) - 1, y + (i / 3) % 3 - 1, METATILE_ATTRIBUTE_BEHAVIOR);
+    }
+    BENCHMARK(&cached)
+    {
+        for (i = 0; i < STEP_LOOKUPS; i++)
+            behaviors -= MapGridGetMetatileBehaviorAt(x + (i % 3) - 1, y + (i / 3) % 3 - 1);
+    }
+
+    EXPECT_EQ(behaviors, 0);
+    EXPECT_FASTER(cached, uncached);
+}
@@ -0,0 +1,136 @@
+#include "global.h"
+#include "item.h"
+#include "random.h"
+#include "test/test.h"
+
+static void Old_SortAndCompactBagPocket(struct BagPocket * pocket);
+
+static void FillTestPocket(struct BagPocket *pocket, struct ItemSlot *slots, u8 capacity)
+{
+    u32 i;
+
+    pocket->itemSlots = slots;
+    pocket->capacity = capacity;
+    for (i = 0; i < capacity; i++)
+    {
+        slots[i].itemId = 1 + (i * 29) % capacity;
+        slots[i].quantity = Random() % 4;
+        if (slots[i].quantity == 0)
+            slots[i].itemId = ITEM_NONE;
+    }
+}
+
+TEST("SortAndCompactBagPocket sorts by item id and moves empty slots last")
+{
+    u32 i;
+    struct BagPocket pocket;
+    struct ItemSlot slots[8] =
+    {
+        { ITEM_REPEL, 3 },
+        { ITEM_NONE, 0 },
+        { ITEM_POTION, 12 },
+        { ITEM_FULL_HEAL, 0 },
+        { ITEM_ESCAPE_ROPE, 1 },
+        { ITEM_POKE_BALL, 99 },
+        { ITEM_NONE, 0 },
+        { ITEM_ANTIDOTE, 2 },
+    };
+    static const struct ItemSlot sExpected[] =
+    {
+        { ITEM_POKE_BALL, 99 },
+        { ITEM_POTION, 12 },
+        { ITEM_ANTIDOTE, 2 },
+        { ITEM_REPEL, 3 },
+        { ITEM_ESCAPE_ROPE, 1 },
+    };
+
+    pocket.itemSlots = slots;
+    pocket.capacity = ARRAY_COUNT(slots);
+    SortAndCompactBagPocket(&pocket);
+
+    for (i = 0; i < ARRAY_COUNT(sExpected); i++)
+    {
+        EXPECT_EQ(slots[i].itemId, sExpected[i].itemId);
+        EXPECT_EQ(slots[i].quantity, sExpected[i].quantity);
+    }
+    for (; i < ARRAY_COUNT(slots); i++)
+        EXPECT_EQ(slots[i].quantity, 0);
+}
+
+TEST("SortBagPocket by amount is stable and keeps empty slots last")
+{
+    u32 i;
+    struct BagPocket pocket;
+    struct ItemSlot slots[BAG_ITEMS_COUNT];
+
+    FillTestPocket(&pocket, slots, BAG_ITEMS_COUNT);
+    SortBagPocket(&pocket, ITEM_SORT_BY_INDEX);
+    SortBagPocket(&pocket, ITEM_SORT_BY_AMOUNT);
+
+    for (i = 1; i < BAG_ITEMS_COUNT; i++)
+    {
+        if (slots[i].quantity == 0)
+            continue;
+        EXPECT_NE(slots[i - 1].quantity, 0);
+        EXPECT_GE(slots[i - 1].quantity, slots[i].quantity);
+        if (slots[i - 1].quantity == slots[i].quantity)
+            EXPECT_LT(slots[i - 1].itemId, slots[i].itemId);
+    }
+}
+
+TEST("SortPocketAndPlaceHMsFirst moves HMs in front of TMs")
+{
+    struct BagPocket pocket;
+    struct ItemSlot slots[4] =
+    {
+        { ITEM_HM02, 1 },
+        { ITEM_TM01, 1 },
+        { ITEM_NONE, 0 },
+        { ITEM_HM01, 1 },
+    };
+
+    pocket.itemSlots = slots;
+    pocket.capacity = ARRAY_COUNT(slots);
+    SortPocketAndPlaceHMsFirst(&pocket);
+
+    EXPECT_EQ(slots[0].itemId, ITEM_HM01);
+    EXPECT_EQ(slots[1].itemId, ITEM_HM02);
+    EXPECT_EQ(slots[2].itemId, ITEM_TM01);
+    EXPECT_EQ(slots[3].quantity, 0);
+}
+
+TEST("SortAndCompactBagPocket is faster than the original exchange sort")
+{
+    struct BagPocket pocket, oldPocket;
+    struct ItemSlot slots[BAG_TMHM_COUNT], oldSlots[BAG_TMHM_COUNT];
+    struct Benchmark sorted, old;
+
+    FillTestPocket(&pocket, slots, BAG_TMHM_COUNT);
+    memcpy(oldSlots, slots, sizeof(slots));
+    oldPocket = pocket;
+    oldPocket.itemSlots = oldSlots;
+
+    BENCHMARK(&old) { Old_SortAndCompactBagPocket(&oldPocket); }
+    BENCHMARK(&sorted) { SortAndCompactBagPocket(&pocket); }
+
+    EXPECT_FASTER(sorted, old);
+}
+
+// SortAndCompactBagPocket before the merge sort, for comparison.
+static void Old_SortAndCompactBagPocket(struct BagPocket * pocket)
+{
+    u16 i, j;
+
+    for (i = 0; i < pocket->capacity; i++)
+    {
+        for (j = i + 1; j < pocket->capacity; j++)
+        {
+            if (pocket->itemSlots[i].quantity == 0 || (pocket->itemSlots[j].quantity != 0 && pocket->itemSlots[i].itemId > pocket->itemSlots[j].itemId))
+            {
+                struct ItemSlot slot = pocket->itemSlots[i];
+                pocket->itemSlots[i] = pocket->itemSlots[j];
+                pocket->itemSlots[j] = slot;
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#include "global.h"
+#include "malloc.h"
+#include "test/test.h"
+
+TEST("ArenaAlloc returns aligned, non-overlapping memory")
+{
+    struct Arena *arena = ArenaCreate(64);
+    u8 *a = ArenaAlloc(arena, 3);
+    u8 *b = ArenaAlloc(arena, 8);
+    u8 *c = ArenaAllocZeroed(arena, 5);
+
+    EXPECT_EQ((uintptr_t)a & 3, 0);
+    EXPECT_EQ((uintptr_t)b & 3, 0);
+    EXPECT_EQ((uintptr_t)c & 3, 0);
+    EXPECT_EQ(b - a, 4);
+    EXPECT_EQ(c - b, 8);
+    EXPECT_EQ(c[0] | c[1] | c[2] | c[3] | c[4], 0);
+    EXPECT_EQ(ArenaMark(arena), 20);
+    ArenaDestroy(arena);
+}
+
+TEST("ArenaReset and ArenaResetToMark release memory for reuse")
+{
+    u32 mark;
+    struct Arena *arena = ArenaCreate(32);
+    u8 *a = ArenaAlloc(arena, 16);
+
+    mark = ArenaMark(arena);
+    EXPECT_EQ(ArenaAlloc(arena, 16), a + 16);
+    ArenaResetToMark(arena, mark);
+    EXPECT_EQ(ArenaAlloc(arena, 16), a + 16);
+    ArenaReset(arena);
+    EXPECT_EQ(ArenaAlloc(arena, 32), a);
+    ArenaDestroy(arena);
+}
+
+TEST("A scene arena sized with ARENA_ALLOC_SIZE holds exactly its allocations")
+{
+    struct Arena *arena = ArenaCreate(ARENA_ALLOC_SIZE(6) + ARENA_ALLOC_SIZE(8) + ARENA_ALLOC_SIZE(1));
+
+    EXPECT_NE(ArenaAlloc(arena, 6), NULL);
+    EXPECT_NE(ArenaAlloc(arena, 8), NULL);
+    EXPECT_NE(ArenaAlloc(arena, 1), NULL);
+    EXPECT_EQ(ArenaMark(arena), arena->size);
+    ArenaDestroy(arena);
+}
+
+TEST("gFrameArena is carved from the end of gHeap")
+{
+    u8 *mem = FrameAlloc(FRAME_ARENA_SIZE);
+    EXPECT_EQ(mem, gHeap + HEAP_SIZE);
+}
@@ -0,0 +1,193 @@
+#include "global.h"
+#include "malloc.h"
+#include "palette.h"
+#include "random.h"
+#include "constants/rgb.h"
+#include "test/test.h"
+
+static const u16 sTestPalette0[16] =
+{
+    RGB(0, 0, 0), RGB(31, 31, 31), RGB(31, 0, 0), RGB(0, 31, 0),
+    RGB(0, 0, 31), RGB(12, 20, 5), RGB(1, 2, 3), RGB(30, 29, 28),
+    RGB(31, 0, 0) | RGB_ALPHA, RGB(5, 10, 15) | RGB_ALPHA, RGB(16, 16, 16), RGB(7, 25, 13),
+    RGB(24, 3, 18) | RGB_ALPHA, RGB(9, 9, 30), RGB(20, 31, 1), RGB(2, 17, 29),
+};
+
+static const u16 sTestPalette1[16] =
+{
+    RGB(4, 8, 12) | RGB_ALPHA, RGB(0, 0, 0), RGB(31, 31, 31), RGB(10, 5, 20),
+    RGB(3, 30, 7), RGB(25, 25, 0), RGB(31, 1, 15) | RGB_ALPHA, RGB(8, 8, 8),
+    RGB(0, 0, 31), RGB(18, 22, 26), RGB(6, 0, 6) | RGB_ALPHA, RGB(29, 14, 3),
+    RGB(11, 11, 11), RGB(0, 31, 31), RGB(15, 3, 27), RGB(27, 19, 2),
+};
+
+static const struct BlendSettings sTestBlends[] =
+{
+    {.coeff = 10, .blendColor = Q_8_8(0.456) | Q_8_8(0.456) << 8 | Q_8_8(0.615) << 16, .isTint = TRUE},
+    {.coeff = 4, .blendColor = RGB(28, 10, 4), .isTint = FALSE},
+};
+
+static void RandomizePalettes(u16 *palettes, u32 numColors)
+{
+    u32 i;
+    for (i = 0; i < numColors; i++)
+        palettes[i] = Random();
+}
+
+// Expected values are from the per-channel formulas the kernels replaced.
+TEST("BlendPalettesFine blends each channel towards the color")
+{
+    static const u16 sBlend0Black[16] =
+    {
+        0x0000, 0x7FFF, 0x001F, 0x03E0, 0x7C00, 0x168C, 0x0C41, 0x73BE,
+        0x801F, 0xBD45, 0x4210, 0x3727, 0xC878, 0x7929, 0x07F4, 0x7622,
+    };
+    static const u16 sBlend7[16] =
+    {
+        0x31AC, 0x77FD, 0x31BD, 0x33EC, 0x75AC, 0x3F13, 0x35CC, 0x73BD,
+        0xB1BD, 0xD26F, 0x56D5, 0x4F70, 0xD9F9, 0x7651, 0x33F7, 0x72ED,
+    };
+    static const u16 sBlend16White[16] =
+    {
+        0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF,
+        0xFFFF, 0xFFFF, 0x7FFF, 0x7FFF, 0xFFFF, 0x7FFF, 0x7FFF, 0x7FFF,
+    };
+    static const u16 sBlend9[16] =
+    {
+        0x1961, 0x4F0F, 0x196F, 0x1B01, 0x4D61, 0x2286, 0x1D82, 0x4AEE,
+        0x996F, 0xB1E3, 0x3648, 0x2EC4, 0xB98C, 0x4DE5, 0x1B0A, 0x4A42,
+    };
+    u16 *src = Alloc(PLTT_SIZE_4BPP);
+    u16 *dst = Alloc(PLTT_SIZE_4BPP);
+    const u16 *expected = NULL;
+    u32 coeff = 0, color = 0;
+
+    PARAMETRIZE { coeff = 0; color = RGB_BLACK; expected = sBlend0Black; }
+    PARAMETRIZE { coeff = 7; color = RGB(28, 31, 28); expected = sBlend7; }
+    PARAMETRIZE { coeff = 16; color = RGB_WHITE; expected = sBlend16White; }
+    // Only the low 15 bits of the color are used.
+    PARAMETRIZE { coeff = 9; color = 0xABCD0000 | RGB_ALPHA | RGB(3, 20, 11); expected = sBlend9; }
+
+    CpuCopy16(sTestPalette0, src, PLTT_SIZE_4BPP);
+    BlendPalettesFine(1, src, dst, coeff, color);
+    EXPECT(memcmp(dst, expected, PLTT_SIZE_4BPP) == 0);
+    Free(src);
+    Free(dst);
+}
+
+TEST("TimeMixPalettes mixes the two blends by weight")
+{
+    static const u16 sMix0[2][16] =
+    {
+        {
+            0x0000, 0x633E, 0x045E, 0x0727, 0x6047, 0x1230, 0x0C87, 0x5B1D,
+            0x0CFF, 0x3DCB, 0x35D3, 0x2AAC, 0x4539, 0x5D2D, 0x0736, 0x59E8,
+        },
+        {
+            0xB104, 0x0447, 0x633E, 0x40CE, 0x1B29, 0x06B9, 0x3858, 0x1D0D,
+            0x6047, 0x5274, 0x1C45, 0x0DBC, 0x254F, 0x6327, 0x5492, 0x0A1B,
+        },
+    };
+    static const u16 sMix100[2][16] =
+    {
+        {
+            0x0000, 0x5A97, 0x0037, 0x0284, 0x5824, 0x0DAB, 0x0844, 0x5276,
+            0x113F, 0x3DED, 0x2D6E, 0x2228, 0x4179, 0x54E9, 0x0290, 0x5164,
+        },
+        {
+            0xB104, 0x0024, 0x5A97, 0x388A, 0x1685, 0x0233, 0x3455, 0x14C9,
+            0x5824, 0x49EF, 0x1C45, 0x0956, 0x1CEA, 0x5A84, 0x4C4D, 0x0595,
+        },
+    };
+    static const u16 sMix256[2][16] =
+    {
+        {
+            0x0000, 0x4DCE, 0x000E, 0x01C0, 0x4C00, 0x0D25, 0x0400, 0x45AD,
+            0x1DDF, 0x3E72, 0x24E7, 0x1D63, 0x41FB, 0x4884, 0x01C9, 0x44E0,
+        },
+        {
+            0xB104, 0x0000, 0x4DCE, 0x3044, 0x11A1, 0x016B, 0x3491, 0x1063,
+            0x4C00, 0x3D28, 0x2485, 0x04CD, 0x1884, 0x4DC0, 0x4026, 0x050C,
+        },
+    };
+    u16 *src = Alloc(PLTT_SIZE_4BPP * 2);
+    u16 *dst = Alloc(PLTT_SIZE_4BPP * 2);
+    struct BlendSettings *blend0 = (struct BlendSettings *)&sTestBlends[0];
+    struct BlendSettings *blend1 = (struct BlendSettings *)&sTestBlends[1];
+    const u16 (*expected)[16] = NULL;
+    u32 weight = 0;
+
+    PARAMETRIZE { weight = 0; expected = sMix0; }
+    PARAMETRIZE { weight = 100; expected = sMix100; }
+    PARAMETRIZE { weight = 256; expected = sMix256; }
+
+    // Palette 1 has a transparent color 0, which transparent colors blend towards.
+    CpuCopy16(sTestPalette0, &src[0], PLTT_SIZE_4BPP);
+    CpuCopy16(sTestPalette1, &src[16], PLTT_SIZE_4BPP);
+    TimeMixPalettes(3, src, dst, blend0, blend1, weight);
+    EXPECT(memcmp(&dst[0], expected[0], PLTT_SIZE_4BPP) == 0);
+    EXPECT(memcmp(&dst[16], expected[1], PLTT_SIZE_4BPP) == 0);
+    Free(src);
+    Free(dst);
+}
+
+TEST("AvgPaletteWeighted averages colors and keeps the destination's high bits")
+{
+    static const u16 sAvg0[16] =
+    {
+        0x1234, 0x8000, 0x7FFF, 0xD0AA, 0x1FC3, 0x8339, 0x3C3F, 0xA108,
+        0x7C00, 0xEAD2, 0x1806, 0x8DDD, 0x2D6B, 0xFFE0, 0x6C6F, 0x8A7B,
+    };
+    static const u16 sAvg192[16] =
+    {
+        0x1234, 0xDEF7, 0x1CFF, 0x9702, 0x64E0, 0x8EAF, 0x1828, 0xDEF8,
+        0x1C17, 0xC5A8, 0x358D, 0xAACC, 0x40B4, 0xF9C6, 0x1F12, 0xDA28,
+    };
+    static const u16 sAvg256[16] =
+    {
+        0x1234, 0xFFFF, 0x001F, 0x83E0, 0x7C00, 0x968C, 0x0C41, 0xF3BE,
+        0x001F, 0xBD45, 0x4210, 0xB727, 0x4878, 0xF929, 0x07F4, 0xF622,
+    };
+    u16 *src0 = Alloc(PLTT_SIZE_4BPP);
+    u16 *src1 = Alloc(PLTT_SIZE_4BPP);
+    u16 *dst = Alloc(PLTT_SIZE_4BPP);
+    const u16 *expected = NULL;
+    u32 i, weight = 0;
+
+    PARAMETRIZE { weight = 0; expected = sAvg0; }
+    PARAMETRIZE { weight = 192; expected = sAvg192; }
+    PARAMETRIZE { weight = 256; expected = sAvg256; }
+
+    CpuCopy16(sTestPalette0, src0, PLTT_SIZE_4BPP);
+    CpuCopy16(sTestPalette1, src1, PLTT_SIZE_4BPP);
+    for (i = 0; i < 16; i++)
+        dst[i] = (i & 1) ? RGB_ALPHA : 0x1234;
+    AvgPaletteWeighted(src0, src1, dst, weight);
+    EXPECT(memcmp(dst, expected, PLTT_SIZE_4BPP) == 0);
+    Free(src0);
+    Free(src1);
+    Free(dst);
+}
+
+// Unaligned buffers take the per-color Thumb path which the kernels replaced.
+TEST("Palette blending kernels are faster than the per-color path")
+{
+    u16 *src = Alloc(PLTT_SIZE + 4);
+    u16 *dst = Alloc(PLTT_SIZE + 4);
+    struct BlendSettings *blend0 = (struct BlendSettings *)&sTestBlends[0];
+    struct BlendSettings *blend1 = (struct BlendSettings *)&sTestBlends[1];
+    struct Benchmark armBenchmark, thumbBenchmark;
+
+    RandomizePalettes(src, PLTT_BUFFER_SIZE + 2);
+
+    BENCHMARK(&armBenchmark) { BlendPalettesFine(PALETTES_ALL, src, dst, 7, RGB(28, 31, 28)); }
+    BENCHMARK(&thumbBenchmark) { BlendPalettesFine(PALETTES_ALL, src + 1, dst + 1, 7, RGB(28, 31, 28)); }
+    EXPECT_FASTER(armBenchmark, thumbBenchmark);
+
+    BENCHMARK(&armBenchmark) { TimeMixPalettes(PALETTES_ALL, src, dst, blend0, blend1, 100); }
+    BENCHMARK(&thumbBenchmark) { TimeMixPalettes(PALETTES_ALL, src + 1, dst + 1, blend0, blend1, 100); }
+    EXPECT_FASTER(armBenchmark, thumbBenchmark);
+
+    Free(src);
+    Free(dst);
+}
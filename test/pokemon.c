@@ -2,9 +2,13 @@
 #include "battle.h"
 #include "event_data.h"
 #include "pokemon.h"
+#include "random.h"
 #include "test/overworld_script.h"
 #include "test/test.h"
 
+static u32 Old_GetSubstructIndex(u32 personality, u8 substructType);
+static u16 Old_NationalDexNumToSpecies(u16 nationalNum);
+
 TEST("Nature independent from Hidden Nature")
 {
     u32 i, j, nature = 0, hiddenNature = 0;
@@ -399,3 +403,220 @@ TEST("createmon [simple]")
     EXPECT_EQ(GetMonData(&gEnemyParty[1], MON_DATA_SPECIES), SPECIES_WYNAUT);
     EXPECT_EQ(GetMonData(&gEnemyParty[1], MON_DATA_LEVEL), 10);
 }
+
+// Roughly the fields read to draw the summary screen's pages.
+static const s32 sSummaryFields[] =
+{
+    MON_DATA_SPECIES, MON_DATA_HELD_ITEM, MON_DATA_EXP, MON_DATA_FRIENDSHIP,
+    MON_DATA_MOVE1, MON_DATA_MOVE2, MON_DATA_MOVE3, MON_DATA_MOVE4,
+    MON_DATA_PP1, MON_DATA_PP2, MON_DATA_PP3, MON_DATA_PP4, MON_DATA_PP_BONUSES,
+    MON_DATA_HP_IV, MON_DATA_ATK_IV, MON_DATA_DEF_IV, MON_DATA_SPEED_IV, MON_DATA_SPATK_IV, MON_DATA_SPDEF_IV,
+    MON_DATA_MET_LOCATION, MON_DATA_MET_LEVEL, MON_DATA_MET_GAME, MON_DATA_POKEBALL,
+    MON_DATA_IS_EGG, MON_DATA_ABILITY_NUM, MON_DATA_OT_GENDER, MON_DATA_POKERUS, MON_DATA_TERA_TYPE,
+    MON_DATA_HIDDEN_NATURE, MON_DATA_IS_SHINY, MON_DATA_MARKINGS, MON_DATA_LANGUAGE,
+};
+
+TEST("DecodedBoxMon reads and writes the same data as Get/SetBoxMonData")
+{
+    u32 i, value;
+    struct Pokemon mon;
+    struct BoxPokemon expected;
+    struct DecodedBoxMon decoded;
+
+    CreateMon(&mon, SPECIES_WOBBUFFET, 50, 0, FALSE, 0, OT_ID_PRESET, 0);
+    DecodeBoxMon(&decoded, &mon.box);
+    EXPECT_EQ(GetDecodedBoxMonData(&decoded, MON_DATA_SPECIES, NULL), SPECIES_WOBBUFFET);
+    EXPECT_EQ(GetDecodedBoxMonData(&decoded, MON_DATA_EXP, NULL), gExperienceTables[gSpeciesInfo[SPECIES_WOBBUFFET].growthRate][50]);
+    for (i = 0; i < ARRAY_COUNT(sSummaryFields); i++)
+        EXPECT_EQ(GetDecodedBoxMonData(&decoded, sSummaryFields[i], NULL), GetBoxMonData(&mon.box, sSummaryFields[i], NULL));
+
+    expected = mon.box;
+    for (i = 0; i < ARRAY_COUNT(sSummaryFields); i++)
+    {
+        value = i + 1;
+        SetBoxMonData(&expected, sSummaryFields[i], &value);
+        SetDecodedBoxMonData(&decoded, sSummaryFields[i], &value);
+    }
+    CommitDecodedBoxMon(&decoded);
+    EXPECT_EQ(memcmp(&mon.box, &expected, sizeof(expected)), 0);
+}
+
+TEST("DecodedBoxMon reads a summary page faster than GetBoxMonData")
+{
+    u32 i, sum = 0;
+    struct Pokemon mon;
+    struct DecodedBoxMon decoded;
+    struct Benchmark perField, decodeOnce;
+
+    CreateMon(&mon, SPECIES_WOBBUFFET, 50, 0, FALSE, 0, OT_ID_PRESET, 0);
+
+    BENCHMARK(&perField)
+    {
+        for (i = 0; i < ARRAY_COUNT(sSummaryFields); i++)
+            sum += GetBoxMonData(&mon.box, sSummaryFields[i], NULL);
+    }
+    BENCHMARK(&decodeOnce)
+    {
+        DecodeBoxMon(&decoded, &mon.box);
+        for (i = 0; i < ARRAY_COUNT(sSummaryFields); i++)
+            sum -= GetDecodedBoxMonData(&decoded, sSummaryFields[i], NULL);
+    }
+
+    EXPECT_EQ(sum, 0);
+    EXPECT_FASTER(decodeOnce, perField);
+}
+
+TEST("GetSubstructIndex matches the original permutation switch")
+{
+    u32 i, type, personality;
+
+    for (i = 0; i < 1000; i++)
+    {
+        personality = i < 48 ? i : Random32();
+        for (type = 0; type < 4; type++)
+            EXPECT_EQ(GetSubstructIndex(personality, type), Old_GetSubstructIndex(personality, type));
+    }
+}
+
+TEST("GetSubstructIndex is faster than the original permutation switch")
+{
+    u32 i, sum = 0;
+    struct Benchmark lookup, old;
+
+    BENCHMARK(&old)
+    {
+        for (i = 0; i < 64; i++)
+            sum += Old_GetSubstructIndex(i * 0x9E3779B9, i % 4);
+    }
+    BENCHMARK(&lookup)
+    {
+        for (i = 0; i < 64; i++)
+            sum -= GetSubstructIndex(i * 0x9E3779B9, i % 4);
+    }
+
+    EXPECT_EQ(sum, 0);
+    EXPECT_FASTER(lookup, old);
+}
+
+TEST("NationalDexNumToSpecies returns the base species with that number")
+{
+    u32 i, species;
+
+    EXPECT_EQ(NationalDexNumToSpecies(0), SPECIES_NONE);
+    EXPECT_EQ(NationalDexNumToSpecies(NATIONAL_DEX_BULBASAUR), SPECIES_BULBASAUR);
+    EXPECT_EQ(NationalDexNumToSpecies(NATIONAL_DEX_RATTATA), SPECIES_RATTATA);
+    EXPECT_EQ(NationalDexNumToSpecies(NATIONAL_DEX_WOBBUFFET), SPECIES_WOBBUFFET);
+    EXPECT_EQ(NationalDexNumToSpecies(NATIONAL_DEX_COUNT + 1), SPECIES_NONE);
+
+    for (i = 1; i <= NATIONAL_DEX_COUNT; i++)
+    {
+        species = NationalDexNumToSpecies(i);
+        if (species != SPECIES_NONE)
+            EXPECT_EQ(gSpeciesInfo[species].natDexNum, i);
+    }
+}
+
+TEST("NationalDexNumToSpecies matches the original species search")
+{
+    u32 i;
+
+    for (i = 0; i <= NATIONAL_DEX_COUNT + 1; i++)
+        EXPECT_EQ(NationalDexNumToSpecies(i), Old_NationalDexNumToSpecies(i));
+}
+
+TEST("NationalDexNumToSpecies is faster than the original species search")
+{
+    u32 i, sum = 0;
+    struct Benchmark lookup, search;
+
+    // Build the table outside the measurement.
+    NationalDexNumToSpecies(NATIONAL_DEX_BULBASAUR);
+
+    BENCHMARK(&search)
+    {
+        for (i = 0; i < 16; i++)
+            sum += Old_NationalDexNumToSpecies(NATIONAL_DEX_COUNT - i);
+    }
+    BENCHMARK(&lookup)
+    {
+        for (i = 0; i < 16; i++)
+            sum -= NationalDexNumToSpecies(NATIONAL_DEX_COUNT - i);
+    }
+
+    EXPECT_EQ(sum, 0);
+    EXPECT_FASTER(lookup, search);
+}
+
+// GetSubstruct before the permutation table, for comparison.
+#define SUBSTRUCT_CASE(n, v1, v2, v3, v4)                               \
+case n:                                                                 \
+    {                                                                   \
+                                                                        \
+        switch (substructType)                                          \
+        {                                                               \
+        case 0:                                                         \
+            index = v1;                                                 \
+            break;                                                      \
+        case 1:                                                         \
+            index = v2;                                                 \
+            break;                                                      \
+        case 2:                                                         \
+            index = v3;                                                 \
+            break;                                                      \
+        case 3:                                                         \
+            index = v4;                                                 \
+            break;                                                      \
+        }                                                               \
+        break;                                                          \
+    }                                                                   \
+
+static u32 Old_GetSubstructIndex(u32 personality, u8 substructType)
+{
+    u32 index = 0;
+
+    switch (personality % 24)
+    {
+        SUBSTRUCT_CASE( 0,0,1,2,3)
+        SUBSTRUCT_CASE( 1,0,1,3,2)
+        SUBSTRUCT_CASE( 2,0,2,1,3)
+        SUBSTRUCT_CASE( 3,0,3,1,2)
+        SUBSTRUCT_CASE( 4,0,2,3,1)
+        SUBSTRUCT_CASE( 5,0,3,2,1)
+        SUBSTRUCT_CASE( 6,1,0,2,3)
+        SUBSTRUCT_CASE( 7,1,0,3,2)
+        SUBSTRUCT_CASE( 8,2,0,1,3)
+        SUBSTRUCT_CASE( 9,3,0,1,2)
+        SUBSTRUCT_CASE(10,2,0,3,1)
+        SUBSTRUCT_CASE(11,3,0,2,1)
+        SUBSTRUCT_CASE(12,1,2,0,3)
+        SUBSTRUCT_CASE(13,1,3,0,2)
+        SUBSTRUCT_CASE(14,2,1,0,3)
+        SUBSTRUCT_CASE(15,3,1,0,2)
+        SUBSTRUCT_CASE(16,2,3,0,1)
+        SUBSTRUCT_CASE(17,3,2,0,1)
+        SUBSTRUCT_CASE(18,1,2,3,0)
+        SUBSTRUCT_CASE(19,1,3,2,0)
+        SUBSTRUCT_CASE(20,2,1,3,0)
+        SUBSTRUCT_CASE(21,3,1,2,0)
+        SUBSTRUCT_CASE(22,2,3,1,0)
+        SUBSTRUCT_CASE(23,3,2,1,0)
+    }
+
+    return index;
+}
+
+// NationalDexNumToSpecies before the lookup table, for comparison.
+static u16 Old_NationalDexNumToSpecies(u16 nationalNum)
+{
+    u16 species;
+
+    if (!nationalNum)
+        return SPECIES_NONE;
+
+    for (species = 1; species < NUM_SPECIES; species++)
+    {
+        if (gSpeciesInfo[species].natDexNum == nationalNum)
+            return species;
+    }
+    return SPECIES_NONE;
+}
@@ -0,0 +1,85 @@
+#include "global.h"
+#include "gflib.h"
+#include "pokemon_storage_system_internal.h"
+#include "test/test.h"
+#include "constants/items.h"
+
+static void ExpectSummaryMatchesBoxMon(u8 boxId, u8 boxPosition)
+{
+    const struct BoxMonSummary *summary = GetBoxMonSummaryAt(boxId, boxPosition);
+
+    EXPECT_EQ(summary->species, GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES));
+    EXPECT_EQ(summary->speciesOrEgg, GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES_OR_EGG));
+    EXPECT_EQ(summary->heldItem, GetBoxMonDataAt(boxId, boxPosition, MON_DATA_HELD_ITEM));
+    EXPECT(summary->isEgg == GetBoxMonDataAt(boxId, boxPosition, MON_DATA_IS_EGG));
+    EXPECT(summary->markings == GetBoxMonDataAt(boxId, boxPosition, MON_DATA_MARKINGS));
+    EXPECT(summary->isShiny == GetBoxMonDataAt(boxId, boxPosition, MON_DATA_IS_SHINY));
+    EXPECT_EQ(summary->level, GetLevelFromBoxMonExp(GetBoxedMonPtr(boxId, boxPosition)));
+}
+
+TEST("GetBoxMonSummaryAt follows changes to the boxed mon")
+{
+    u32 value;
+    struct Pokemon mon;
+
+    CreateMon(&mon, SPECIES_WOBBUFFET, 50, 0, FALSE, 0, OT_ID_PRESET, 0);
+    SetBoxMonAt(0, 1, &mon.box);
+    ExpectSummaryMatchesBoxMon(0, 1);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 1)->species, SPECIES_WOBBUFFET);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 1)->level, 50);
+
+    value = ITEM_LEFTOVERS;
+    SetBoxMonDataAt(0, 1, MON_DATA_HELD_ITEM, &value);
+    ExpectSummaryMatchesBoxMon(0, 1);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 1)->heldItem, ITEM_LEFTOVERS);
+
+    value = 3;
+    SetBoxMonDataAt(0, 1, MON_DATA_MARKINGS, &value);
+    ExpectSummaryMatchesBoxMon(0, 1);
+
+    // Edited and replaced without going through the storage setters.
+    value = SPECIES_WYNAUT;
+    SetBoxMonData(GetBoxedMonPtr(0, 1), MON_DATA_SPECIES, &value);
+    ExpectSummaryMatchesBoxMon(0, 1);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 1)->species, SPECIES_WYNAUT);
+    CreateMon(&mon, SPECIES_WOBBUFFET, 20, 0, TRUE, mon.box.personality, OT_ID_PRESET, 0);
+    *GetBoxedMonPtr(0, 1) = mon.box;
+    InvalidateBoxMonSummaryAt(0, 1);
+    ExpectSummaryMatchesBoxMon(0, 1);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 1)->level, 20);
+
+    ZeroBoxMonAt(0, 1);
+    ExpectSummaryMatchesBoxMon(0, 1);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 1)->species, SPECIES_NONE);
+    EXPECT_EQ(GetBoxMonSummaryAt(TOTAL_BOXES_COUNT, 0)->species, SPECIES_NONE);
+}
+
+TEST("GetBoxMonSummaryAt reads a box faster than GetBoxMonDataAt")
+{
+    u32 i, sum = 0;
+    struct Pokemon mon;
+    struct Benchmark summaries, decrypted;
+
+    for (i = 0; i < IN_BOX_COUNT; i++)
+    {
+        CreateMon(&mon, SPECIES_WOBBUFFET + i % 2, 5 + i, 0, FALSE, 0, OT_ID_PRESET, 0);
+        SetBoxMonAt(0, i, &mon.box);
+    }
+    // Built once when the box is first opened.
+    for (i = 0; i < IN_BOX_COUNT; i++)
+        GetBoxMonSummaryAt(0, i);
+
+    BENCHMARK(&decrypted)
+    {
+        for (i = 0; i < IN_BOX_COUNT; i++)
+            sum += GetBoxMonDataAt(0, i, MON_DATA_SPECIES_OR_EGG) + GetBoxMonDataAt(0, i, MON_DATA_HELD_ITEM);
+    }
+    BENCHMARK(&summaries)
+    {
+        for (i = 0; i < IN_BOX_COUNT; i++)
+            sum -= GetBoxMonSummaryAt(0, i)->speciesOrEgg + GetBoxMonSummaryAt(0, i)->heldItem;
+    }
+
+    EXPECT_EQ(sum, 0);
+    EXPECT_FASTER(summaries, decrypted);
+}
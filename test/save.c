@@ -0,0 +1,173 @@
+#include "global.h"
+#include "agb_flash.h"
+#include "load_save.h"
+#include "save.h"
+#include "gba/flash_internal.h"
+#include "test/test.h"
+
+#define FLAGS_SECTOR_ID (SECTOR_ID_SAVEBLOCK1_START + offsetof(struct SaveBlock1, flags) / SECTOR_DATA_SIZE)
+
+static void ResetSaveFlash(void)
+{
+    ClearSaveData();
+    Save_ResetSaveCounters();
+    ResetSimulatedFlashStats();
+}
+
+TEST("Saving unchanged data only writes SaveBlock2's sector")
+{
+    ASSUME(SAVE_FLASH_SIMULATOR);
+    ASSUME(gFlashMemoryPresent == TRUE);
+    ResetSaveFlash();
+
+    // Both slots start out erased.
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->numWritten, NUM_SECTORS_PER_SLOT);
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->numWritten, NUM_SECTORS_PER_SLOT);
+
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->sectorsWritten, 1 << SECTOR_ID_SAVEBLOCK2);
+    EXPECT_EQ(GetLastSaveWriteStats()->numSkipped, NUM_SECTORS_PER_SLOT - 1);
+}
+
+TEST("Saving writes the sectors whose data changed")
+{
+    ASSUME(SAVE_FLASH_SIMULATOR);
+    ASSUME(gFlashMemoryPresent == TRUE);
+    ResetSaveFlash();
+
+    TrySavingData(SAVE_NORMAL);
+    TrySavingData(SAVE_NORMAL);
+    gSaveBlock1Ptr->flags[0] ^= 1;
+
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->sectorsWritten, (1 << SECTOR_ID_SAVEBLOCK2) | (1 << FLAGS_SECTOR_ID));
+    // The other slot still holds the flag's old value.
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->sectorsWritten, (1 << SECTOR_ID_SAVEBLOCK2) | (1 << FLAGS_SECTOR_ID));
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->sectorsWritten, 1 << SECTOR_ID_SAVEBLOCK2);
+}
+
+TEST("LoadGameSave loads the most recent save")
+{
+    u8 flags;
+
+    ASSUME(SAVE_FLASH_SIMULATOR);
+    ASSUME(gFlashMemoryPresent == TRUE);
+    ResetSaveFlash();
+
+    TrySavingData(SAVE_NORMAL);
+    gSaveBlock1Ptr->flags[0] ^= 1;
+    TrySavingData(SAVE_NORMAL);
+    flags = gSaveBlock1Ptr->flags[0];
+    TrySavingData(SAVE_NORMAL);
+    gSaveBlock1Ptr->flags[0] ^= 1;
+
+    EXPECT_EQ(LoadGameSave(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(gSaveBlock1Ptr->flags[0], flags);
+
+    // Loading rebuilds what is known about each sector.
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->sectorsWritten, 1 << SECTOR_ID_SAVEBLOCK2);
+}
+
+TEST("Link saves can be loaded")
+{
+    u8 flags;
+
+    ASSUME(SAVE_FLASH_SIMULATOR);
+    ASSUME(gFlashMemoryPresent == TRUE);
+    ResetSaveFlash();
+
+    TrySavingData(SAVE_NORMAL);
+    gSaveBlock1Ptr->flags[0] ^= 1;
+    flags = gSaveBlock1Ptr->flags[0];
+
+    EXPECT_EQ(LinkFullSave_Init(), FALSE);
+    while (!LinkFullSave_WriteSector())
+        ;
+    LinkFullSave_ReplaceLastSector();
+    LinkFullSave_SetLastSectorSignature();
+    EXPECT_EQ(gDamagedSaveSectors, 0);
+
+    gSaveBlock1Ptr->flags[0] ^= 1;
+    EXPECT_EQ(LoadGameSave(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(gSaveBlock1Ptr->flags[0], flags);
+}
+
+TEST("An interrupted link save leaves the previous save to be loaded")
+{
+    u32 i, sectorsWritten = 0;
+    bool32 replaced = FALSE;
+    u8 flags;
+
+    PARAMETRIZE { sectorsWritten = 1; }
+    PARAMETRIZE { sectorsWritten = NUM_SECTORS_PER_SLOT - 1; }
+    PARAMETRIZE { sectorsWritten = NUM_SECTORS_PER_SLOT - 1; replaced = TRUE; }
+
+    ASSUME(SAVE_FLASH_SIMULATOR);
+    ASSUME(gFlashMemoryPresent == TRUE);
+    ResetSaveFlash();
+
+    TrySavingData(SAVE_NORMAL);
+    gSaveBlock1Ptr->flags[0] ^= 1;
+    TrySavingData(SAVE_NORMAL);
+    flags = gSaveBlock1Ptr->flags[0];
+    gSaveBlock1Ptr->flags[0] ^= 1;
+
+    // The save stops before SaveBlock2's signature is written.
+    LinkFullSave_Init();
+    for (i = 0; i < sectorsWritten; i++)
+        LinkFullSave_WriteSector();
+    if (replaced)
+        LinkFullSave_ReplaceLastSector();
+    EXPECT_EQ(gDamagedSaveSectors, 0);
+
+    gSaveBlock1Ptr->flags[0] ^= 1;
+    LoadGameSave(SAVE_NORMAL);
+    EXPECT_EQ(gSaveBlock1Ptr->flags[0], flags);
+}
+
+TEST("Saving rewrites a sector whose flash contents no longer match")
+{
+    ASSUME(SAVE_FLASH_SIMULATOR);
+    ASSUME(gFlashMemoryPresent == TRUE);
+    ResetSaveFlash();
+
+    TrySavingData(SAVE_NORMAL);
+    TrySavingData(SAVE_NORMAL);
+    // The third save goes to the second slot, like the first.
+    EraseFlashSector(NUM_SECTORS_PER_SLOT + FLAGS_SECTOR_ID);
+
+    EXPECT_EQ(TrySavingData(SAVE_NORMAL), SAVE_STATUS_OK);
+    EXPECT_EQ(GetLastSaveWriteStats()->sectorsWritten, (1 << SECTOR_ID_SAVEBLOCK2) | (1 << FLAGS_SECTOR_ID));
+}
+
+TEST("Saving unchanged data spends less time programming flash")
+{
+    const struct FlashSetupInfo *chip = NULL;
+    u32 fullSave, unchangedSave;
+
+    PARAMETRIZE { chip = &MX29L010; }
+    PARAMETRIZE { chip = &LE26FV10N1TS; }
+
+    ASSUME(SAVE_FLASH_SIMULATOR);
+    ASSUME(gFlashMemoryPresent == TRUE);
+    ResetSaveFlash();
+    SetSimulatedFlashTiming(chip);
+
+    TrySavingData(SAVE_NORMAL);
+    fullSave = GetSimulatedFlashStats()->elapsedMicros;
+    EXPECT_EQ(GetSimulatedFlashStats()->sectorsProgrammed, NUM_SECTORS_PER_SLOT);
+
+    TrySavingData(SAVE_NORMAL);
+    ResetSimulatedFlashStats();
+    TrySavingData(SAVE_NORMAL);
+    unchangedSave = GetSimulatedFlashStats()->elapsedMicros;
+    EXPECT_EQ(GetSimulatedFlashStats()->sectorsProgrammed, 1);
+
+    SetSimulatedFlashTiming(NULL);
+    EXPECT_LT(unchangedSave * (NUM_SECTORS_PER_SLOT / 2), fullSave);
+}
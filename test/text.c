@@ -9,6 +9,7 @@
 #include "main_menu.h"
 #include "string_util.h"
 #include "text.h"
+#include "window.h"
 #include "constants/abilities.h"
 #include "constants/battle.h"
 #include "constants/battle_string_ids.h"
@@ -828,3 +829,156 @@ TEST("Battle strings fit on the battle message window")
     Free(battleString);
 }
 //*/
+
+#define TEST_WINDOW_WIDTH 30
+#define TEST_WINDOW_HEIGHT 4
+
+static u8 *SetUpTestWindow(u32 width, u32 height)
+{
+    u8 *tileData = AllocZeroed(width * height * TILE_SIZE_4BPP);
+
+    gWindows[0].window.width = width;
+    gWindows[0].window.height = height;
+    gWindows[0].tileData = tileData;
+    return tileData;
+}
+
+static u32 GetWindowPixel(const u8 *tileData, u32 width, u32 x, u32 y)
+{
+    u32 pixels = tileData[((y / 8) * width + x / 8) * TILE_SIZE_4BPP + (y % 8) * 4 + (x % 8) / 2];
+    return (x & 1) ? pixels >> 4 : pixels & 0xF;
+}
+
+static u32 GetTestGlyphPixel(u32 x, u32 y)
+{
+    return (x * 3 + y * 5) % 16;
+}
+
+TEST("CopyGlyphToWindow draws the opaque glyph pixels clipped to the window")
+{
+    struct Window window = gWindows[0];
+    struct TextPrinter textPrinter = {0};
+    u8 *tileData;
+    u32 i, x, y, left = 0, top = 0;
+
+    PARAMETRIZE { left = 0; top = 0; }
+    PARAMETRIZE { left = 3; top = 5; }
+    PARAMETRIZE { left = 7; top = 17; }
+    PARAMETRIZE { left = TEST_WINDOW_WIDTH * 8 - 5; top = TEST_WINDOW_HEIGHT * 8 - 9; }
+
+    // 4bpp 16x16 glyph: 8x8 tiles in the order top-left, top-right,
+    // bottom-left, bottom-right.
+    memset(gGlyphInfo.pixels, 0, sizeof(gGlyphInfo.pixels));
+    gGlyphInfo.width = 13;
+    gGlyphInfo.height = 14;
+    for (y = 0; y < gGlyphInfo.height; y++)
+    {
+        for (x = 0; x < gGlyphInfo.width; x++)
+        {
+            i = (y / 8) * 0x40 + (x / 8) * 0x20 + (y % 8) * 4 + (x % 8) / 2;
+            gGlyphInfo.pixels[i] |= GetTestGlyphPixel(x, y) << ((x & 1) * 4);
+        }
+    }
+
+    tileData = SetUpTestWindow(TEST_WINDOW_WIDTH, TEST_WINDOW_HEIGHT);
+    CpuFill32(0x11111111, tileData, TEST_WINDOW_WIDTH * TEST_WINDOW_HEIGHT * TILE_SIZE_4BPP);
+    textPrinter.printerTemplate.windowId = 0;
+    textPrinter.printerTemplate.currentX = left;
+    textPrinter.printerTemplate.currentY = top;
+    CopyGlyphToWindow(&textPrinter);
+
+    for (y = 0; y < TEST_WINDOW_HEIGHT * 8; y++)
+    {
+        for (x = 0; x < TEST_WINDOW_WIDTH * 8; x++)
+        {
+            u32 expected = 1;
+            if (x >= left && x < left + gGlyphInfo.width && y >= top && y < top + gGlyphInfo.height
+             && GetTestGlyphPixel(x - left, y - top) != 0)
+                expected = GetTestGlyphPixel(x - left, y - top);
+            EXPECT_EQ(GetWindowPixel(tileData, TEST_WINDOW_WIDTH, x, y), expected);
+        }
+    }
+    Free(tileData);
+    gWindows[0] = window;
+}
+
+TEST("Printing a text decompresses each of its glyphs once")
+{
+    struct Window window = gWindows[0];
+    const u8 *str = COMPOUND_STRING("It is said that PROF. OAK's lab is\n"
+                                    "full of rare POKéMON.");
+    const u32 size = 28 * 4 * TILE_SIZE_4BPP;
+    u8 *expected = Alloc(size);
+    u8 *actual;
+    bool8 seen[256] = {0};
+    u32 i, glyphs = 0, distinctGlyphs = 0;
+
+    for (i = 0; str[i] != EOS; i++)
+    {
+        if (str[i] == CHAR_NEWLINE)
+            continue;
+        glyphs++;
+        if (!seen[str[i]])
+        {
+            seen[str[i]] = TRUE;
+            distinctGlyphs++;
+        }
+    }
+
+    SetDefaultFontsPointer();
+    actual = SetUpTestWindow(28, 4);
+
+    ClearGlyphCache();
+    AddTextPrinterParameterized(0, FONT_NORMAL, str, 0, 1, TEXT_SKIP_DRAW, NULL);
+    EXPECT_EQ(GetGlyphCacheStats()->misses, distinctGlyphs);
+    EXPECT_EQ(GetGlyphCacheStats()->hits, glyphs - distinctGlyphs);
+    CpuCopy32(actual, expected, size);
+
+    // Redrawing the text hits the cache for every glyph.
+    CpuFill32(0, actual, size);
+    AddTextPrinterParameterized(0, FONT_NORMAL, str, 0, 1, TEXT_SKIP_DRAW, NULL);
+    EXPECT_EQ(GetGlyphCacheStats()->misses, distinctGlyphs);
+    EXPECT_EQ(GetGlyphCacheStats()->hits, glyphs * 2 - distinctGlyphs);
+    EXPECT(memcmp(expected, actual, size) == 0);
+    Free(expected);
+    Free(actual);
+    gWindows[0] = window;
+}
+
+TEST("Printing a page of text with the glyph cache matches printing without it")
+{
+    struct Window window = gWindows[0];
+    const u8 *str = COMPOUND_STRING("It is said that PROF. OAK's lab is\n"
+                                    "full of rare POKéMON. Many Trainers\n"
+                                    "visit it each day, hoping to catch\n"
+                                    "a glimpse of them. The lab is in\n"
+                                    "PALLET TOWN, south of VIRIDIAN CITY.\n"
+                                    "Route 1 links the two towns, and a\n"
+                                    "trip between them takes about 25\n"
+                                    "minutes on foot, or less by bike!");
+    const u32 size = 28 * 16 * TILE_SIZE_4BPP;
+    u8 *expected = Alloc(size);
+    u8 *actual;
+
+    SetDefaultFontsPointer();
+    actual = SetUpTestWindow(28, 16);
+
+    SetGlyphCacheEnabled(FALSE);
+    AddTextPrinterParameterized(0, FONT_NORMAL, str, 0, 1, TEXT_SKIP_DRAW, NULL);
+    SetGlyphCacheEnabled(TRUE);
+    EXPECT_EQ(GetGlyphCacheStats()->hits + GetGlyphCacheStats()->misses, 0);
+    CpuCopy32(actual, expected, size);
+
+    // The page has more distinct glyphs than the cache holds, so this
+    // evicts entries, and the redraw mixes hits with misses.
+    CpuFill32(0, actual, size);
+    AddTextPrinterParameterized(0, FONT_NORMAL, str, 0, 1, TEXT_SKIP_DRAW, NULL);
+    EXPECT(memcmp(expected, actual, size) == 0);
+    CpuFill32(0, actual, size);
+    AddTextPrinterParameterized(0, FONT_NORMAL, str, 0, 1, TEXT_SKIP_DRAW, NULL);
+    EXPECT_NE(GetGlyphCacheStats()->hits, 0);
+    EXPECT(memcmp(expected, actual, size) == 0);
+    Free(expected);
+    Free(actual);
+    gWindows[0] = window;
+}
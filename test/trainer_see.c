@@ -0,0 +1,80 @@
+#include "global.h"
+#include "event_object_movement.h"
+#include "random.h"
+#include "trainer_see.h"
+#include "test/test.h"
+#include "constants/event_object_movement.h"
+#include "constants/trainer_types.h"
+
+static bool32 IsInTrainerSight(struct ObjectEvent *trainer, s16 x, s16 y)
+{
+    s16 dx = x - trainer->currentCoords.x;
+    s16 dy = y - trainer->currentCoords.y;
+    s16 range = trainer->trainerRange_berryTreeId;
+    bool32 seesAll = trainer->trainerType == TRAINER_TYPE_BURIED;
+
+    if (!trainer->active || (trainer->trainerType != TRAINER_TYPE_NORMAL && !seesAll))
+        return FALSE;
+    if (dx == 0 && dy > 0 && dy <= range && (seesAll || trainer->facingDirection == DIR_SOUTH))
+        return TRUE;
+    if (dx == 0 && dy < 0 && -dy <= range && (seesAll || trainer->facingDirection == DIR_NORTH))
+        return TRUE;
+    if (dy == 0 && dx < 0 && -dx <= range && (seesAll || trainer->facingDirection == DIR_WEST))
+        return TRUE;
+    if (dy == 0 && dx > 0 && dx <= range && (seesAll || trainer->facingDirection == DIR_EAST))
+        return TRUE;
+    return FALSE;
+}
+
+// Wider than SIGHT_INDEX_SIZE, so that rows and columns are shared.
+#define FUZZ_AREA 40
+
+TEST("GetTrainersWhoMaySeeCoords includes every trainer who can see the coords")
+{
+    u32 step, i;
+    s16 x, y;
+    struct ObjectEvent *objectEvent;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        gObjectEvents[i] = (struct ObjectEvent){};
+        gObjectEvents[i].facingDirection = DIR_SOUTH;
+    }
+    RebuildObjectEventOccupancy();
+
+    for (step = 0; step < 2000; step++)
+    {
+        objectEvent = &gObjectEvents[Random() % OBJECT_EVENTS_COUNT];
+        switch (Random() % 6)
+        {
+        case 0:
+            objectEvent->active = !objectEvent->active;
+            UpdateObjectEventOccupancy(objectEvent);
+            break;
+        case 1:
+            objectEvent->trainerType = Random() % 4;
+            objectEvent->trainerRange_berryTreeId = Random() % 6;
+            UpdateObjectEventOccupancy(objectEvent);
+            break;
+        case 2:
+            SetObjectEventDirection(objectEvent, DIR_SOUTH + Random() % 4);
+            break;
+        case 3:
+            MoveObjectEventToMapCoords(objectEvent, Random() % FUZZ_AREA, Random() % FUZZ_AREA);
+            break;
+        default:
+            x = objectEvent->currentCoords.x + (Random() % 3) - 1;
+            y = objectEvent->currentCoords.y + (Random() % 3) - 1;
+            ShiftObjectEventCoords(objectEvent, x, y);
+            break;
+        }
+
+        x = (Random() % (FUZZ_AREA + 2)) - 1;
+        y = (Random() % (FUZZ_AREA + 2)) - 1;
+        for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        {
+            if (IsInTrainerSight(&gObjectEvents[i], x, y))
+                EXPECT(GetTrainersWhoMaySeeCoords(x, y) & (1 << i));
+        }
+    }
+}
@@ -18,12 +18,19 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+// For strdup and nanosecond file times, which -std=c11 hides otherwise.
+#define _POSIX_C_SOURCE 200809L
+#define _DARWIN_C_SOURCE
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <limits.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /* extended.c */
 void ieee754_write_extended (double, uint8_t*);
@@ -95,15 +102,32 @@ struct Bytes *read_bytearray(const char *filename)
 	return bytes;
 }
 
+// The output is written under a temporary name and renamed, so that a failed
+// or interrupted conversion never leaves a file which looks up to date.
 void write_bytearray(const char *filename, struct Bytes *bytes)
 {
-	FILE *f = fopen(filename, "wb");
+	char *temp_filename = malloc(strlen(filename) + 5);
+	sprintf(temp_filename, "%s.tmp", filename);
+	FILE *f = fopen(temp_filename, "wb");
 	if (!f)
 	{
-		FATAL_ERROR("Failed to open '%s' for writing!\n", filename);
+		FATAL_ERROR("Failed to open '%s' for writing!\n", temp_filename);
 	}
 	fwrite(bytes->data, bytes->length, 1, f);
-	fclose(f);
+	if (fclose(f) != 0)
+	{
+		remove(temp_filename);
+		FATAL_ERROR("Failed to write '%s'!\n", temp_filename);
+	}
+#ifdef _WIN32
+	remove(filename);
+#endif
+	if (rename(temp_filename, filename) != 0)
+	{
+		remove(temp_filename);
+		FATAL_ERROR("Failed to rename '%s' to '%s'!\n", temp_filename, filename);
+	}
+	free(temp_filename);
 }
 
 void free_bytearray(struct Bytes *bytes)
@@ -567,8 +591,14 @@ do { \
 	(var) |= (*((src) + 3) << 24); \
 } while (0)
 
+struct SampleSizes {
+	unsigned long raw_length;
+	unsigned long pcm_length;
+};
+
 // Reads an .aif file and produces a .pcm file containing an array of 8-bit samples.
-void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
+// If sizes is not NULL, it receives the sample data size before and after compression.
+void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress, struct SampleSizes *sizes)
 {
 	struct Bytes *aif = read_bytearray(aif_filename);
 	AifData aif_data = {0};
@@ -621,6 +651,12 @@ void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
 	memcpy(&output.data[header_size], pcm->data, pcm->length);
 	write_bytearray(pcm_filename, &output);
 
+	if (sizes)
+	{
+		sizes->raw_length = aif_data.real_num_samples;
+		sizes->pcm_length = pcm->length;
+	}
+
 	free(aif->data);
 	free(aif);
 	free(pcm);
@@ -878,10 +914,186 @@ void pcm2aif(const char *pcm_filename, const char *aif_filename, uint32_t base_n
 	free(aif);
 }
 
+struct Job {
+	char *aif_filename;
+	char *pcm_filename;
+	bool compress;
+	bool converted;
+	struct SampleSizes sizes;
+};
+
+struct JobQueue {
+	struct Job *jobs;
+	int count;
+	int next;
+	pthread_mutex_t mutex;
+};
+
+long long get_mtime(const char *filename)
+{
+	struct stat st;
+
+	if (stat(filename, &st) != 0)
+	{
+		return -1;
+	}
+#if defined(__APPLE__)
+	return (long long)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#elif defined(__linux__) || defined(__CYGWIN__)
+	return (long long)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#else
+	return (long long)st.st_mtime * 1000000000;
+#endif
+}
+
+bool is_up_to_date(struct Job *job)
+{
+	long long output_mtime = get_mtime(job->pcm_filename);
+	return output_mtime >= 0 && output_mtime >= get_mtime(job->aif_filename);
+}
+
+// Each manifest line holds the arguments of one conversion:
+// "aif_file bin_file [--compress]". Blank lines and lines starting with # are ignored.
+struct Job *read_manifest(const char *manifest_filename, int *num_jobs)
+{
+	FILE *f = fopen(manifest_filename, "r");
+	if (!f)
+	{
+		FATAL_ERROR("Failed to open '%s' for reading!\n", manifest_filename);
+	}
+
+	struct Job *jobs = NULL;
+	int count = 0, capacity = 0, line_num = 0;
+	char line[3 * 1024];
+	char input[1024], output[1024], option[1024];
+
+	while (fgets(line, sizeof(line), f))
+	{
+		line_num++;
+		int num_fields = sscanf(line, "%1023s %1023s %1023s", input, output, option);
+		if (num_fields <= 0 || input[0] == '#')
+		{
+			continue;
+		}
+		if (num_fields < 2 || (num_fields == 3 && strcmp(option, "--compress") != 0))
+		{
+			FATAL_ERROR("%s:%d: expected 'aif_file bin_file [--compress]'\n", manifest_filename, line_num);
+		}
+
+		if (count == capacity)
+		{
+			capacity = capacity ? capacity * 2 : 256;
+			jobs = realloc(jobs, capacity * sizeof(struct Job));
+		}
+		struct Job *job = &jobs[count++];
+		memset(job, 0, sizeof(*job));
+		job->aif_filename = strdup(input);
+		job->pcm_filename = strdup(output);
+		job->compress = num_fields == 3;
+	}
+
+	fclose(f);
+	*num_jobs = count;
+	return jobs;
+}
+
+void *run_jobs(void *arg)
+{
+	struct JobQueue *queue = arg;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&queue->mutex);
+		int index = queue->next++;
+		pthread_mutex_unlock(&queue->mutex);
+
+		if (index >= queue->count)
+		{
+			return NULL;
+		}
+
+		struct Job *job = &queue->jobs[index];
+		if (!is_up_to_date(job))
+		{
+			aif2pcm(job->aif_filename, job->pcm_filename, job->compress, &job->sizes);
+			job->converted = true;
+		}
+	}
+}
+
+int get_default_num_threads(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+	long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (num_cpus > 0)
+	{
+		return num_cpus;
+	}
+#endif
+	return 1;
+}
+
+// Converts every out of date .aif file listed in the manifest, spread over
+// num_threads threads, then reports how much the compressed samples shrank.
+void convert_manifest(const char *manifest_filename, int num_threads)
+{
+	struct JobQueue queue = {0};
+	queue.jobs = read_manifest(manifest_filename, &queue.count);
+	pthread_mutex_init(&queue.mutex, NULL);
+
+	if (num_threads > queue.count)
+	{
+		num_threads = queue.count;
+	}
+	pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+	for (int i = 0; i < num_threads; i++)
+	{
+		if (pthread_create(&threads[i], NULL, run_jobs, &queue) != 0)
+		{
+			FATAL_ERROR("Failed to create a conversion thread!\n");
+		}
+	}
+	for (int i = 0; i < num_threads; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	int num_converted = 0, num_compressed = 0;
+	unsigned long raw_length = 0, compressed_length = 0;
+	for (int i = 0; i < queue.count; i++)
+	{
+		struct Job *job = &queue.jobs[i];
+		if (job->converted)
+		{
+			num_converted++;
+			if (job->compress)
+			{
+				num_compressed++;
+				raw_length += job->sizes.raw_length;
+				compressed_length += job->sizes.pcm_length;
+			}
+		}
+		free(job->aif_filename);
+		free(job->pcm_filename);
+	}
+
+	printf("%s: converted %d of %d samples\n", manifest_filename, num_converted, queue.count);
+	if (num_compressed)
+	{
+		printf("%s: compressed %d samples from %lu to %lu bytes (%.1f%%)\n", manifest_filename, num_compressed,
+			raw_length, compressed_length, 100.0 * compressed_length / raw_length);
+	}
+
+	pthread_mutex_destroy(&queue.mutex);
+	free(threads);
+	free(queue.jobs);
+}
+
 void usage(void)
 {
 	fprintf(stderr, "Usage: aif2pcm bin_file [aif_file]\n");
 	fprintf(stderr, "       aif2pcm aif_file [bin_file] [--compress]\n");
+	fprintf(stderr, "       aif2pcm --manifest manifest_file [--jobs num_threads]\n");
 }
 
 int main(int argc, char **argv)
@@ -892,6 +1104,27 @@ int main(int argc, char **argv)
 		exit(1);
 	}
 
+	if (strcmp(argv[1], "--manifest") == 0)
+	{
+		int num_threads = get_default_num_threads();
+
+		if (argc != 3 && !(argc == 5 && strcmp(argv[3], "--jobs") == 0))
+		{
+			usage();
+			exit(1);
+		}
+		if (argc == 5)
+		{
+			num_threads = atoi(argv[4]);
+			if (num_threads < 1)
+			{
+				FATAL_ERROR("--jobs must be at least 1\n");
+			}
+		}
+		convert_manifest(argv[2], num_threads);
+		return 0;
+	}
+
 	char *input_file = argv[1];
 	char *extension = get_file_extension(input_file);
 	char *output_file;
@@ -913,12 +1146,12 @@ int main(int argc, char **argv)
 		if (argc >= 3)
 		{
 			output_file = argv[2];
-			aif2pcm(input_file, output_file, compressed);
+			aif2pcm(input_file, output_file, compressed, NULL);
 		}
 		else
 		{
 			output_file = new_file_extension(input_file, "bin");
-			aif2pcm(input_file, output_file, compressed);
+			aif2pcm(input_file, output_file, compressed, NULL);
 			free(output_file);
 		}
 	}
@@ -69,7 +69,140 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 18
+#define LZ_MAX_DISTANCE 0x1000
+#define LZ_HASH_BITS 12
+
+struct LZMatchFinder {
+	unsigned char *src;
+	int srcSize;
+	int minDistance;
+	int insertPos;
+	int head[1 << LZ_HASH_BITS];
+	int *prev;
+};
+
+struct LZMatch {
+	int size;
+	int distance;
+};
+
+static int LZHash(unsigned char *p)
+{
+	return ((p[0] << 8) ^ (p[1] << 4) ^ p[2]) & ((1 << LZ_HASH_BITS) - 1);
+}
+
+static void LZInitMatchFinder(struct LZMatchFinder *finder, unsigned char *src, int srcSize, int minDistance)
+{
+	finder->src = src;
+	finder->srcSize = srcSize;
+	finder->minDistance = minDistance;
+	finder->insertPos = 0;
+
+	for (int i = 0; i < (1 << LZ_HASH_BITS); i++)
+		finder->head[i] = -1;
+
+	finder->prev = malloc(srcSize * sizeof(int));
+
+	if (finder->prev == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ match finder.\n");
+}
+
+// Finds the longest match at srcPos, preferring the closest of equally long
+// matches, which is what a search of every distance in order would pick.
+// Positions must be visited in increasing order.
+static struct LZMatch LZFindMatch(struct LZMatchFinder *finder, int srcPos)
+{
+	unsigned char *src = finder->src;
+	struct LZMatch best = { 0, 0 };
+
+	// Each position is chained to the previous one with the same hash,
+	// so the chain is walked from the closest candidate outwards.
+	for (; finder->insertPos < srcPos && finder->insertPos + LZ_MIN_MATCH <= finder->srcSize; finder->insertPos++) {
+		int hash = LZHash(&src[finder->insertPos]);
+		finder->prev[finder->insertPos] = finder->head[hash];
+		finder->head[hash] = finder->insertPos;
+	}
+
+	if (srcPos + LZ_MIN_MATCH > finder->srcSize)
+		return best;
+
+	int maxSize = finder->srcSize - srcPos;
+
+	if (maxSize > LZ_MAX_MATCH)
+		maxSize = LZ_MAX_MATCH;
+
+	for (int candidate = finder->head[LZHash(&src[srcPos])]; candidate >= 0; candidate = finder->prev[candidate]) {
+		int distance = srcPos - candidate;
+
+		if (distance > LZ_MAX_DISTANCE)
+			break;
+
+		if (distance < finder->minDistance)
+			continue;
+
+		int size = 0;
+
+		while (size < maxSize && src[candidate + size] == src[srcPos + size])
+			size++;
+
+		if (size > best.size) {
+			best.size = size;
+			best.distance = distance;
+
+			if (size == maxSize)
+				break;
+		}
+	}
+
+	if (best.size < LZ_MIN_MATCH)
+		best.size = 0;
+
+	return best;
+}
+
+// Chooses the cheapest sequence of literals and matches. A literal costs
+// 9 bits and a match 17, counting their bits in the flags bytes.
+static struct LZMatch *LZOptimalParse(unsigned char *src, int srcSize, const int minDistance)
+{
+	struct LZMatchFinder finder;
+	struct LZMatch *longest = malloc(srcSize * sizeof(struct LZMatch));
+	struct LZMatch *choice = malloc(srcSize * sizeof(struct LZMatch));
+	int *cost = malloc((srcSize + 1) * sizeof(int));
+
+	if (longest == NULL || choice == NULL || cost == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ optimal parse.\n");
+
+	LZInitMatchFinder(&finder, src, srcSize, minDistance);
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos++)
+		longest[srcPos] = LZFindMatch(&finder, srcPos);
+
+	free(finder.prev);
+
+	cost[srcSize] = 0;
+
+	for (int srcPos = srcSize - 1; srcPos >= 0; srcPos--) {
+		cost[srcPos] = 9 + cost[srcPos + 1];
+		choice[srcPos].size = 0;
+
+		// Any shorter prefix of the longest match is a match too.
+		for (int size = LZ_MIN_MATCH; size <= longest[srcPos].size; size++) {
+			if (17 + cost[srcPos + size] < cost[srcPos]) {
+				cost[srcPos] = 17 + cost[srcPos + size];
+				choice[srcPos].size = size;
+				choice[srcPos].distance = longest[srcPos].distance;
+			}
+		}
+	}
+
+	free(cost);
+	free(longest);
+	return choice;
+}
+
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance, const bool optimal)
 {
 	if (srcSize <= 0)
 		goto fail;
@@ -93,42 +226,28 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 	int srcPos = 0;
 	int destPos = 4;
 
+	struct LZMatchFinder finder;
+	struct LZMatch *choices = NULL;
+
+	if (optimal)
+		choices = LZOptimalParse(src, srcSize, minDistance);
+	else
+		LZInitMatchFinder(&finder, src, srcSize, minDistance);
+
 	for (;;) {
 		unsigned char *flags = &dest[destPos++];
 		*flags = 0;
 
 		for (int i = 0; i < 8; i++) {
-			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
-
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
-
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
+			struct LZMatch match = optimal ? choices[srcPos] : LZFindMatch(&finder, srcPos);
 
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
-
-					if (blockSize == 18)
-						break;
-				}
-
-				blockDistance++;
-			}
-
-			if (bestBlockSize >= 3) {
+			if (match.size >= LZ_MIN_MATCH) {
 				*flags |= (0x80 >> i);
-				srcPos += bestBlockSize;
-				bestBlockSize -= 3;
-				bestBlockDistance--;
-				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
-				dest[destPos++] = (unsigned char)bestBlockDistance;
+				srcPos += match.size;
+				match.size -= 3;
+				match.distance--;
+				dest[destPos++] = (match.size << 4) | ((unsigned int)match.distance >> 8);
+				dest[destPos++] = (unsigned char)match.distance;
 			} else {
 				dest[destPos++] = src[srcPos++];
 			}
@@ -142,6 +261,11 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 						dest[destPos++] = 0;
 				}
 
+				if (optimal)
+					free(choices);
+				else
+					free(finder.prev);
+
 				*compressedSize = destPos;
 				return dest;
 			}
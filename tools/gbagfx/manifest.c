@@ -0,0 +1,397 @@
+// A manifest lists one conversion per line, written as the arguments
+// gbagfx would take on the command line:
+//
+//     graphics/foo.png graphics/foo.4bpp -mwidth 2
+//     graphics/foo.4bpp graphics/foo.4bpp.lz
+//
+// Blank lines and lines starting with '#' are ignored. Conversions run on
+// a pool of threads. A conversion whose input, palette or tilemap is the
+// output of an earlier one waits for it, and a conversion whose output is
+// newer than all of its inputs is skipped. A conversion whose input does not
+// exist, e.g. one that make builds with another kind of rule, is left for
+// make to run.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "global.h"
+#include "util.h"
+#include "manifest.h"
+
+// The input, palette and tilemap.
+#define MAX_JOB_INPUTS 3
+
+struct ManifestJob
+{
+    int argc;
+    char **argv;
+    int dependencies[MAX_JOB_INPUTS]; // Indices of the jobs which write the inputs.
+    int numDependencies;
+    bool done;
+};
+
+struct Manifest
+{
+    struct ManifestJob *jobs;
+    int numJobs;
+    int nextJob;
+    int numConverted;
+    int numLeft;
+    ConvertFunction convert;
+    pthread_mutex_t mutex;
+    pthread_cond_t jobDone;
+};
+
+static bool IsWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Splits the manifest in place into jobs.
+static void ParseManifest(struct Manifest *manifest, char *text, int size)
+{
+    int capacity = 256;
+
+    manifest->jobs = malloc(capacity * sizeof(struct ManifestJob));
+    manifest->numJobs = 0;
+
+    if (manifest->jobs == NULL)
+        FATAL_ERROR("Failed to allocate memory for manifest.\n");
+
+    for (char *line = text; line < text + size;)
+    {
+        char *end = memchr(line, '\n', text + size - line);
+
+        if (end == NULL)
+            end = text + size;
+        *end = 0;
+
+        char *args[64];
+        int argc = 0;
+
+        args[argc++] = "gbagfx";
+        for (char *c = line; *c != 0 && *c != '#';)
+        {
+            while (IsWhitespace(*c))
+                *c++ = 0;
+            if (*c == 0 || *c == '#')
+                break;
+
+            if (argc == sizeof(args) / sizeof(args[0]))
+                FATAL_ERROR("Too many arguments in manifest line \"%s\".\n", line);
+            args[argc++] = c;
+
+            while (*c != 0 && !IsWhitespace(*c))
+                c++;
+        }
+
+        if (argc == 2)
+            FATAL_ERROR("No output path in manifest line \"%s\".\n", line);
+
+        if (argc > 2)
+        {
+            if (manifest->numJobs == capacity)
+            {
+                capacity *= 2;
+                manifest->jobs = realloc(manifest->jobs, capacity * sizeof(struct ManifestJob));
+                if (manifest->jobs == NULL)
+                    FATAL_ERROR("Failed to allocate memory for manifest.\n");
+            }
+
+            struct ManifestJob *job = &manifest->jobs[manifest->numJobs++];
+            job->argc = argc;
+            job->argv = malloc(argc * sizeof(char *));
+            if (job->argv == NULL)
+                FATAL_ERROR("Failed to allocate memory for manifest.\n");
+            memcpy(job->argv, args, argc * sizeof(char *));
+            job->numDependencies = 0;
+            job->done = false;
+        }
+
+        line = end + 1;
+    }
+}
+
+static bool IsInputOption(const char *option)
+{
+    return strcmp(option, "-palette") == 0 || strcmp(option, "-tilemap") == 0;
+}
+
+// Returns the number of files the job reads, which are stored in paths.
+static int GetJobInputs(struct ManifestJob *job, char *paths[MAX_JOB_INPUTS])
+{
+    int count = 0;
+
+    paths[count++] = job->argv[1];
+    for (int i = 3; i + 1 < job->argc; i++)
+    {
+        if (IsInputOption(job->argv[i]))
+        {
+            if (count == MAX_JOB_INPUTS)
+                FATAL_ERROR("Too many inputs for manifest job \"%s\".\n", job->argv[2]);
+            paths[count++] = job->argv[++i];
+        }
+    }
+
+    return count;
+}
+
+static unsigned int HashPath(const char *path)
+{
+    unsigned int hash = 2166136261u;
+
+    for (const char *c = path; *c != 0; c++)
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+    return hash;
+}
+
+static void FindDependencies(struct Manifest *manifest)
+{
+    // Outputs are looked up in a hash table, as there can be thousands.
+    int numBuckets = 1;
+
+    while (numBuckets < manifest->numJobs * 2)
+        numBuckets *= 2;
+
+    int *buckets = malloc(numBuckets * sizeof(int));
+
+    if (buckets == NULL)
+        FATAL_ERROR("Failed to allocate memory for manifest.\n");
+
+    for (int i = 0; i < numBuckets; i++)
+        buckets[i] = -1;
+
+    for (int i = 0; i < manifest->numJobs; i++)
+    {
+        struct ManifestJob *job = &manifest->jobs[i];
+        char *inputs[MAX_JOB_INPUTS];
+        int numInputs = GetJobInputs(job, inputs);
+
+        // The closest earlier job writing each input is the one to wait for.
+        for (int j = 0; j < numInputs; j++)
+        {
+            int dependency = -1;
+
+            for (unsigned int b = HashPath(inputs[j]) & (numBuckets - 1); buckets[b] != -1; b = (b + 1) & (numBuckets - 1))
+            {
+                if (strcmp(manifest->jobs[buckets[b]].argv[2], inputs[j]) == 0 && buckets[b] > dependency)
+                    dependency = buckets[b];
+            }
+
+            if (dependency != -1)
+                job->dependencies[job->numDependencies++] = dependency;
+        }
+
+        unsigned int b = HashPath(job->argv[2]) & (numBuckets - 1);
+
+        while (buckets[b] != -1)
+            b = (b + 1) & (numBuckets - 1);
+        buckets[b] = i;
+    }
+
+    free(buckets);
+}
+
+static bool IsNewer(const struct stat *a, const struct stat *b)
+{
+#if defined(__APPLE__)
+    if (a->st_mtimespec.tv_sec != b->st_mtimespec.tv_sec)
+        return a->st_mtimespec.tv_sec > b->st_mtimespec.tv_sec;
+    return a->st_mtimespec.tv_nsec > b->st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+    return a->st_mtime > b->st_mtime;
+#else
+    if (a->st_mtim.tv_sec != b->st_mtim.tv_sec)
+        return a->st_mtim.tv_sec > b->st_mtim.tv_sec;
+    return a->st_mtim.tv_nsec > b->st_mtim.tv_nsec;
+#endif
+}
+
+static bool IsUpToDate(struct ManifestJob *job)
+{
+    struct stat output, input;
+    char *inputs[MAX_JOB_INPUTS];
+    int numInputs = GetJobInputs(job, inputs);
+
+    if (stat(job->argv[2], &output) != 0)
+        return false;
+
+    for (int i = 0; i < numInputs; i++)
+    {
+        if (stat(inputs[i], &input) != 0 || !IsNewer(&output, &input))
+            return false;
+    }
+
+    return true;
+}
+
+static bool HasInputs(struct ManifestJob *job)
+{
+    struct stat input;
+    char *inputs[MAX_JOB_INPUTS];
+    int numInputs = GetJobInputs(job, inputs);
+
+    for (int i = 0; i < numInputs; i++)
+    {
+        if (stat(inputs[i], &input) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+// The conversion writes to a temporary file, which then replaces the output,
+// so that a conversion which fails part way never leaves a truncated output
+// that looks up to date. The temporary file keeps the output's extension, as
+// that is what picks the conversion.
+static void ConvertJob(struct Manifest *manifest, struct ManifestJob *job)
+{
+    char *outputPath = job->argv[2];
+    char *extension = GetFileExtensionAfterDot(outputPath);
+
+    if (extension == NULL)
+    {
+        manifest->convert(job->argc, job->argv);
+        return;
+    }
+
+    char *tempPath = malloc(strlen(outputPath) + strlen(extension) + 6);
+    char **argv = malloc(job->argc * sizeof(char *));
+
+    if (tempPath == NULL || argv == NULL)
+        FATAL_ERROR("Failed to allocate memory for manifest job.\n");
+
+    sprintf(tempPath, "%s.tmp.%s", outputPath, extension);
+    memcpy(argv, job->argv, job->argc * sizeof(char *));
+    argv[2] = tempPath;
+
+    manifest->convert(job->argc, argv);
+
+#ifdef _WIN32
+    remove(outputPath); // rename() does not replace files on Windows.
+#endif
+    if (rename(tempPath, outputPath) != 0)
+    {
+        remove(tempPath);
+        FATAL_ERROR("Failed to rename \"%s\" to \"%s\".\n", tempPath, outputPath);
+    }
+
+    free(argv);
+    free(tempPath);
+}
+
+static void *RunManifestJobs(void *data)
+{
+    struct Manifest *manifest = data;
+
+    pthread_mutex_lock(&manifest->mutex);
+    while (manifest->nextJob < manifest->numJobs)
+    {
+        struct ManifestJob *job = &manifest->jobs[manifest->nextJob++];
+
+        // Jobs are handed out in order, so the dependencies are already running.
+        for (int i = 0; i < job->numDependencies; i++)
+        {
+            while (!manifest->jobs[job->dependencies[i]].done)
+                pthread_cond_wait(&manifest->jobDone, &manifest->mutex);
+        }
+        pthread_mutex_unlock(&manifest->mutex);
+
+        bool converted = false;
+        bool left = false;
+
+        if (!HasInputs(job))
+        {
+            left = true;
+        }
+        else if (!IsUpToDate(job))
+        {
+            ConvertJob(manifest, job);
+            converted = true;
+        }
+
+        pthread_mutex_lock(&manifest->mutex);
+        job->done = true;
+        if (converted)
+            manifest->numConverted++;
+        if (left)
+            manifest->numLeft++;
+        pthread_cond_broadcast(&manifest->jobDone);
+    }
+    pthread_mutex_unlock(&manifest->mutex);
+
+    return NULL;
+}
+
+void RunManifest(char *manifestPath, int numThreads, ConvertFunction convert)
+{
+    struct Manifest manifest;
+    struct timespec start, end;
+    int size;
+    // Padded so that the last line is terminated.
+    char *text = (char *)ReadWholeFileZeroPadded(manifestPath, &size, 1);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    if (numThreads < 1)
+    {
+#ifdef _SC_NPROCESSORS_ONLN
+        numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        if (numThreads < 1)
+            numThreads = 1;
+    }
+
+    ParseManifest(&manifest, text, size);
+    FindDependencies(&manifest);
+    manifest.nextJob = 0;
+    manifest.numConverted = 0;
+    manifest.numLeft = 0;
+    manifest.convert = convert;
+    pthread_mutex_init(&manifest.mutex, NULL);
+    pthread_cond_init(&manifest.jobDone, NULL);
+
+    if (numThreads > manifest.numJobs)
+        numThreads = manifest.numJobs;
+
+    pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+
+    if (threads == NULL && numThreads > 0)
+        FATAL_ERROR("Failed to allocate memory for threads.\n");
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, RunManifestJobs, &manifest) != 0)
+            FATAL_ERROR("Failed to create thread.\n");
+    }
+
+    for (int i = 0; i < numThreads; i++)
+        pthread_join(threads[i], NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("%s: converted %d of %d files in %.2fs using %d thread%s.\n",
+        manifestPath,
+        manifest.numConverted,
+        manifest.numJobs,
+        (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9,
+        numThreads,
+        numThreads == 1 ? "" : "s");
+    if (manifest.numLeft != 0)
+        printf("%s: left %d files whose inputs do not exist.\n", manifestPath, manifest.numLeft);
+
+    pthread_cond_destroy(&manifest.jobDone);
+    pthread_mutex_destroy(&manifest.mutex);
+    for (int i = 0; i < manifest.numJobs; i++)
+        free(manifest.jobs[i].argv);
+    free(manifest.jobs);
+    free(threads);
+    free(text);
+}
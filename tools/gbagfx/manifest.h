@@ -0,0 +1,8 @@
+#ifndef MANIFEST_H
+#define MANIFEST_H
+
+typedef void (*ConvertFunction)(int argc, char **argv);
+
+void RunManifest(char *manifestPath, int numThreads, ConvertFunction convert);
+
+#endif // MANIFEST_H
@@ -4,6 +4,9 @@
 
 #include <map>
 
+#include <fstream>
+#include <sstream>
+
 #include <string>
 using std::string; using std::to_string;
 
@@ -23,20 +26,52 @@ string get_custom_var(string key)
     return customVars[key];
 }
 
+// Leaves the file untouched if it already has this text, so that make does
+// not recompile everything which includes it. Otherwise the text is written
+// to a temporary file which then replaces the old one.
+void write_file_if_changed(const string &filepath, const string &text)
+{
+    std::ifstream in_file(filepath, std::ios::binary);
+
+    if (in_file.is_open())
+    {
+        std::ostringstream existing;
+        existing << in_file.rdbuf();
+        in_file.close();
+        if (existing.str() == text)
+            return;
+    }
+
+    string tempFilepath = filepath + ".tmp";
+    std::ofstream out_file(tempFilepath, std::ios::binary);
+
+    if (!out_file.is_open())
+        FATAL_ERROR("Cannot open file %s for writing.\n", tempFilepath.c_str());
+
+    out_file << text;
+    out_file.close();
+
+#ifdef _WIN32
+    std::remove(filepath.c_str()); // rename() does not replace files on Windows.
+#endif
+    if (std::rename(tempFilepath.c_str(), filepath.c_str()) != 0)
+        FATAL_ERROR("Cannot replace file %s.\n", filepath.c_str());
+}
+
 int main(int argc, char *argv[])
 {
-    if (argc != 4)
-        FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath>\n");
+    if (argc < 4 || (argc - 1) % 3 != 0)
+        FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath> [<json-filepath> <template-filepath> <output-filepath>...]\n");
 
-    string jsonfilepath = argv[1];
-    string templateFilepath = argv[2];
-    string outputFilepath = argv[3];
+    // Set for each output in turn, for doNotModifyHeader.
+    string jsonfilepath;
+    string templateFilepath;
 
     Environment env;
     env.set_trim_blocks(true);
 
     // Add custom command callbacks.
-    env.add_callback("doNotModifyHeader", 0, [jsonfilepath, templateFilepath](Arguments& args) {
+    env.add_callback("doNotModifyHeader", 0, [&jsonfilepath, &templateFilepath](Arguments& args) {
         return "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from " + jsonfilepath +" and Inja template " + templateFilepath + "\n//\n";
     });
 
@@ -117,13 +152,33 @@ int main(int argc, char *argv[])
         return str;
     });
 
-    try
-    {
-        env.write_with_json_file(templateFilepath, jsonfilepath, outputFilepath);
-    }
-    catch (const std::exception& e)
+    // Inputs shared between outputs are only parsed once.
+    std::map<string, json> jsonCache;
+    std::map<string, Template> templateCache;
+
+    for (int i = 1; i < argc; i += 3)
     {
-        FATAL_ERROR("JSONPROC_ERROR: %s\n", e.what());
+        jsonfilepath = argv[i];
+        templateFilepath = argv[i + 1];
+        string outputFilepath = argv[i + 2];
+
+        try
+        {
+            auto data = jsonCache.find(jsonfilepath);
+            if (data == jsonCache.end())
+                data = jsonCache.emplace(jsonfilepath, env.load_json(jsonfilepath)).first;
+
+            auto tmpl = templateCache.find(templateFilepath);
+            if (tmpl == templateCache.end())
+                tmpl = templateCache.emplace(templateFilepath, env.parse_template(templateFilepath)).first;
+
+            customVars.clear();
+            write_file_if_changed(outputFilepath, env.render(tmpl->second, data->second));
+        }
+        catch (const std::exception& e)
+        {
+            FATAL_ERROR("JSONPROC_ERROR: %s\n", e.what());
+        }
     }
 
     return 0;
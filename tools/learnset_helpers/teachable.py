@@ -210,5 +210,12 @@ if not "// DO NOT MODIFY THIS FILE!" in out:
 else:
     out = re.sub(r"\/\/\n\/\/ DO NOT MODIFY THIS FILE!(.|\n)*\* \/\/\n\n", header, out)
 
-with open("./src/data/pokemon/teachable_learnsets.h", 'w') as file:
-    file.write(out)
+# only replace the file if its contents changed, so that make does not
+# recompile everything which includes it
+out_path = "./src/data/pokemon/teachable_learnsets.h"
+with open(out_path, 'r') as file:
+    unchanged = file.read() == out
+if not unchanged:
+    with open(out_path + ".tmp", 'w') as file:
+        file.write(out)
+    os.replace(out_path + ".tmp", out_path)
@@ -24,6 +24,12 @@ using std::ostringstream;
 #include <limits>
 using std::numeric_limits;
 
+#include <atomic>
+using std::atomic;
+
+#include <thread>
+using std::thread;
+
 #include "json11.h"
 using json11::Json;
 
@@ -52,15 +58,36 @@ string read_text_file(string filepath) {
     return text;
 }
 
+// Leaves the file untouched if it already has this text, so that make does
+// not consider anything built from it out of date. Otherwise the text is
+// written to a temporary file which then replaces the old one, so that an
+// interrupted run never leaves a truncated file behind.
 void write_text_file(string filepath, string text) {
-    ofstream out_file(filepath, std::ofstream::binary);
+    ifstream in_file(filepath, std::ifstream::binary);
+
+    if (in_file.is_open()) {
+        ostringstream existing;
+        existing << in_file.rdbuf();
+        in_file.close();
+        if (existing.str() == text)
+            return;
+    }
+
+    string temp_filepath = filepath + ".tmp";
+    ofstream out_file(temp_filepath, std::ofstream::binary);
 
     if (!out_file.is_open())
-        FATAL_ERROR("Cannot open file %s for writing.\n", filepath.c_str());
+        FATAL_ERROR("Cannot open file %s for writing.\n", temp_filepath.c_str());
 
     out_file << text;
 
     out_file.close();
+
+#ifdef _WIN32
+    std::remove(filepath.c_str()); // rename() does not replace files on Windows.
+#endif
+    if (std::rename(temp_filepath.c_str(), filepath.c_str()) != 0)
+        FATAL_ERROR("Cannot replace file %s.\n", filepath.c_str());
 }
 
 
@@ -347,6 +374,27 @@ string file_parent(string filename){
     return filename.substr(0, dir_pos + 1);
 }
 
+Json parse_json_file(string filepath) {
+    string err;
+    Json data = Json::parse(read_text_file(filepath), err);
+
+    if (data == Json())
+        FATAL_ERROR("%s: %s\n", filepath.c_str(), err.c_str());
+
+    return data;
+}
+
+void write_map_files(Json map_data, Json layouts_data, string output_dir) {
+    string header_text = generate_map_header_text(map_data, layouts_data);
+    string events_text = generate_map_events_text(map_data);
+    string connections_text = generate_map_connections_text(map_data);
+
+    string out_dir = strip_trailing_separator(output_dir).append(sep);
+    write_text_file(out_dir + "header.inc", header_text);
+    write_text_file(out_dir + "events.inc", events_text);
+    write_text_file(out_dir + "connections.inc", connections_text);
+}
+
 void process_map(string map_filepath, string layouts_filepath, string output_dir) {
     string mapdata_err, layouts_err;
 
@@ -361,14 +409,40 @@ void process_map(string map_filepath, string layouts_filepath, string output_dir
     if (layouts_data == Json())
         FATAL_ERROR("%s\n", layouts_err.c_str());
 
-    string header_text = generate_map_header_text(map_data, layouts_data);
-    string events_text = generate_map_events_text(map_data);
-    string connections_text = generate_map_connections_text(map_data);
+    write_map_files(map_data, layouts_data, output_dir);
+}
 
+// Processes every map listed in the groups file, parsing the layouts only
+// once and spreading the maps across threads.
+void process_all_maps(string groups_filepath, string layouts_filepath, string output_dir) {
+    Json groups_data = parse_json_file(groups_filepath);
+    Json layouts_data = parse_json_file(layouts_filepath);
+    string maps_dir = file_parent(groups_filepath);
     string out_dir = strip_trailing_separator(output_dir).append(sep);
-    write_text_file(out_dir + "header.inc", header_text);
-    write_text_file(out_dir + "events.inc", events_text);
-    write_text_file(out_dir + "connections.inc", connections_text);
+
+    vector<string> map_names;
+    for (auto &group : groups_data["group_order"].array_items()) {
+        for (auto &map_name : groups_data[json_to_string(group)].array_items())
+            map_names.push_back(json_to_string(map_name));
+    }
+
+    atomic<size_t> next_map(0);
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next_map++) < map_names.size()) {
+            Json map_data = parse_json_file(maps_dir + map_names[i] + sep + "map.json");
+            write_map_files(map_data, layouts_data, out_dir + map_names[i]);
+        }
+    };
+
+    size_t num_threads = std::max(1u, thread::hardware_concurrency());
+    num_threads = std::min(num_threads, map_names.size());
+    vector<thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &t : threads)
+        t.join();
 }
 
 string generate_groups_text(Json groups_data) {
@@ -641,8 +715,8 @@ int main(int argc, char *argv[]) {
 
     char *mode_arg = argv[1];
     string mode(mode_arg);
-    if (mode != "layouts" && mode != "map" && mode != "groups")
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', or 'groups'.\n");
+    if (mode != "layouts" && mode != "map" && mode != "maps-all" && mode != "groups")
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'maps-all', or 'groups'.\n");
 
     if (mode == "map") {
         if (argc != 6)
@@ -655,6 +729,17 @@ int main(int argc, char *argv[]) {
 
         process_map(filepath, layouts_filepath, output_dir);
     }
+    else if (mode == "maps-all") {
+        if (argc != 6)
+            FATAL_ERROR("USAGE: mapjson maps-all <game-version> <groups_file> <layouts_file> <output_dir>\n");
+
+        infer_separator(argv[3]);
+        string groups_filepath(argv[3]);
+        string layouts_filepath(argv[4]);
+        string output_dir(argv[5]);
+
+        process_all_maps(groups_filepath, layouts_filepath, output_dir);
+    }
     else if (mode == "groups") {
         if (argc != 6)
             FATAL_ERROR("USAGE: mapjson groups <game-version> <groups_file> <output_asm_dir> <output_c_dir>\n");
@@ -678,7 +763,7 @@ int main(int argc, char *argv[]) {
         process_layouts(filepath, output_asm, output_c);
     }
     else {
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', or 'groups'.\n");
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'maps-all', or 'groups'.\n");
     }
 
     return 0;
@@ -25,27 +25,35 @@
 #include <cassert>
 #include <string>
 #include <set>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <sys/stat.h>
 #include "main.h"
 #include "error.h"
 #include "midi.h"
 #include "agb.h"
 
-FILE* g_inputFile = nullptr;
-FILE* g_outputFile = nullptr;
+thread_local FILE* g_inputFile = nullptr;
+thread_local FILE* g_outputFile = nullptr;
 
-std::string g_asmLabel;
-int g_masterVolume = 127;
-int g_voiceGroup = 0;
-int g_priority = 0;
-int g_reverb = -1;
-int g_clocksPerBeat = 1;
-bool g_exactGateTime = false;
-bool g_compressionEnabled = true;
+thread_local std::string g_asmLabel;
+thread_local int g_masterVolume = 127;
+thread_local int g_voiceGroup = 0;
+thread_local int g_priority = 0;
+thread_local int g_reverb = -1;
+thread_local int g_clocksPerBeat = 1;
+thread_local bool g_exactGateTime = false;
+thread_local bool g_compressionEnabled = true;
 
 [[noreturn]] static void PrintUsage()
 {
     std::printf(
         "Usage: MID2AGB name [options]\n"
+        "       MID2AGB -M manifest [-J threads]\n"
         "\n"
         "    input_file  filename(.mid) of MIDI file\n"
         "   output_file  filename(.s) for AGB file (default:input_file)\n"
@@ -58,6 +66,9 @@ bool g_compressionEnabled = true;
         "            -X  48 clocks/beat (default:24 clocks/beat)\n"
         "            -E  exact gate-time\n"
         "            -N  no compression\n"
+        "\n"
+        "   -M manifest  convert every song listed in a midi.cfg style manifest\n"
+        "    -J threads  number of songs converted at once (default:all cores)\n"
     );
     std::exit(1);
 }
@@ -127,11 +138,9 @@ static const char *GetArgument(int argc, char **argv, int& index)
     }
 }
 
-int main(int argc, char** argv)
+static void ParseArguments(int argc, char** argv, std::string& inputFilename, std::string& outputFilename,
+    std::string& manifestFilename, int& threadCount)
 {
-    std::string inputFilename;
-    std::string outputFilename;
-
     for (int i = 1; i < argc; i++)
     {
         const char *option = argv[i];
@@ -151,12 +160,24 @@ int main(int argc, char** argv)
                     PrintUsage();
                 g_voiceGroup = std::stoi(arg);
                 break;
+            case 'J':
+                arg = GetArgument(argc, argv, i);
+                if (arg == nullptr)
+                    PrintUsage();
+                threadCount = std::stoi(arg);
+                break;
             case 'L':
                 arg = GetArgument(argc, argv, i);
                 if (arg == nullptr)
                     PrintUsage();
                 g_asmLabel = arg;
                 break;
+            case 'M':
+                arg = GetArgument(argc, argv, i);
+                if (arg == nullptr)
+                    PrintUsage();
+                manifestFilename = arg;
+                break;
             case 'N':
                 g_compressionEnabled = false;
                 break;
@@ -195,10 +216,10 @@ int main(int argc, char** argv)
                 PrintUsage();
         }
     }
+}
 
-    if (inputFilename.empty())
-        PrintUsage();
-
+static void ConvertMidi(const std::string& inputFilename, std::string outputFilename)
+{
     if (GetExtension(inputFilename) != "mid")
         RaiseError("input filename extension is not \"mid\"");
 
@@ -216,10 +237,14 @@ int main(int argc, char** argv)
     if (g_inputFile == nullptr)
         RaiseError("failed to open \"%s\" for reading", inputFilename.c_str());
 
-    g_outputFile = std::fopen(outputFilename.c_str(), "w");
+    // The song is written under a temporary name and renamed once complete,
+    // so that a failed conversion never leaves a file which looks up to date.
+    std::string tempFilename = outputFilename + ".tmp";
+
+    g_outputFile = std::fopen(tempFilename.c_str(), "w");
 
     if (g_outputFile == nullptr)
-        RaiseError("failed to open \"%s\" for writing", outputFilename.c_str());
+        RaiseError("failed to open \"%s\" for writing", tempFilename.c_str());
 
     ReadMidiFileHeader();
     PrintAgbHeader();
@@ -227,7 +252,173 @@ int main(int argc, char** argv)
     PrintAgbFooter();
 
     std::fclose(g_inputFile);
-    std::fclose(g_outputFile);
+
+    if (std::fclose(g_outputFile) != 0)
+        RaiseError("failed to write \"%s\"", tempFilename.c_str());
+
+#ifdef _WIN32
+    std::remove(outputFilename.c_str());
+#endif
+    if (std::rename(tempFilename.c_str(), outputFilename.c_str()) != 0)
+        RaiseError("failed to rename \"%s\" to \"%s\"", tempFilename.c_str(), outputFilename.c_str());
+}
+
+// Returns the modification time of a file in nanoseconds, or -1 if it doesn't exist.
+static long long GetModificationTime(const std::string& path)
+{
+    struct stat st;
+
+    if (stat(path.c_str(), &st) != 0)
+        return -1;
+
+#if defined(__APPLE__)
+    return (long long)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#elif defined(__linux__) || defined(__CYGWIN__)
+    return (long long)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#else
+    return (long long)st.st_mtime * 1000000000;
+#endif
+}
+
+struct Song
+{
+    std::string inputFilename;
+    std::string outputFilename;
+    std::vector<std::string> options;
+};
+
+// Reads the songs of a manifest in the format of midi.cfg, where each
+// "name.mid: options" line converts name.mid to name.s in the manifest's
+// directory. Other lines are ignored.
+static std::vector<Song> ReadManifest(const std::string& manifestFilename)
+{
+    std::ifstream manifest(manifestFilename);
+    std::size_t slashPos = manifestFilename.find_last_of("/\\");
+    std::string dir = slashPos == std::string::npos ? "" : manifestFilename.substr(0, slashPos + 1);
+    std::vector<Song> songs;
+    std::string line;
+
+    if (!manifest)
+        RaiseError("failed to open \"%s\" for reading", manifestFilename.c_str());
+
+    while (std::getline(manifest, line))
+    {
+        std::istringstream words(line);
+        std::string name;
+        std::string option;
+
+        if (!(words >> name) || name.size() <= 5 || name.compare(name.size() - 5, 5, ".mid:") != 0)
+            continue;
+
+        name.pop_back();
+
+        Song song;
+        song.inputFilename = dir + name;
+        song.outputFilename = dir + StripExtension(name) + ".s";
+
+        while (words >> option)
+            song.options.push_back(option);
+
+        songs.push_back(song);
+    }
+
+    return songs;
+}
+
+static void ConvertSong(const Song& song)
+{
+    std::vector<char*> argv;
+    std::string inputFilename;
+    std::string outputFilename;
+    std::string manifestFilename;
+    int threadCount = 0;
+
+    argv.push_back(const_cast<char*>("mid2agb"));
+    for (const std::string& option : song.options)
+        argv.push_back(const_cast<char*>(option.c_str()));
+
+    ParseArguments(argv.size(), argv.data(), inputFilename, outputFilename, manifestFilename, threadCount);
+
+    if (!inputFilename.empty() || !manifestFilename.empty())
+        RaiseError("unexpected file name in the options for \"%s\"", song.inputFilename.c_str());
+
+    ConvertMidi(song.inputFilename, song.outputFilename);
+}
+
+// Converts the songs of a manifest which are older than their MIDI file or
+// the manifest itself. Songs whose MIDI file doesn't exist are skipped, like
+// make skips the rules for them. Each song is converted on a thread of its own, so it
+// starts from the initial values of the (thread_local) globals, just as a
+// separate mid2agb process would.
+static void ConvertManifest(const std::string& manifestFilename, int threadCount)
+{
+    std::vector<Song> songs = ReadManifest(manifestFilename);
+    long long manifestTime = GetModificationTime(manifestFilename);
+    std::vector<const Song*> outdatedSongs;
+    unsigned songCount = 0;
+
+    for (const Song& song : songs)
+    {
+        long long inputTime = GetModificationTime(song.inputFilename);
+        long long outputTime = GetModificationTime(song.outputFilename);
+
+        if (inputTime < 0)
+            continue;
+
+        songCount++;
+        if (outputTime < 0 || outputTime < manifestTime || outputTime < inputTime)
+            outdatedSongs.push_back(&song);
+    }
+
+    if (threadCount <= 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    std::atomic<std::size_t> nextSong(0);
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < threadCount && i < (int)outdatedSongs.size(); i++)
+    {
+        workers.emplace_back([&]()
+        {
+            std::size_t index;
+
+            while ((index = nextSong++) < outdatedSongs.size())
+            {
+                const Song& song = *outdatedSongs[index];
+                std::thread([&song]() { ConvertSong(song); }).join();
+            }
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    std::printf("%s: converted %u of %u songs\n", manifestFilename.c_str(),
+        (unsigned)outdatedSongs.size(), songCount);
+}
+
+int main(int argc, char** argv)
+{
+    std::string inputFilename;
+    std::string outputFilename;
+    std::string manifestFilename;
+    int threadCount = 0;
+
+    ParseArguments(argc, argv, inputFilename, outputFilename, manifestFilename, threadCount);
+
+    if (!manifestFilename.empty())
+    {
+        if (!inputFilename.empty())
+            PrintUsage();
+
+        ConvertManifest(manifestFilename, threadCount);
+        return 0;
+    }
+
+    if (inputFilename.empty())
+        PrintUsage();
+
+    ConvertMidi(inputFilename, outputFilename);
 
     return 0;
 }
@@ -21,6 +21,8 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdarg>
+#include <cstring>
+#include <unistd.h>
 #include "preproc.h"
 #include "charmap.h"
 #include "char_util.h"
@@ -44,7 +46,7 @@ struct Lhs
 class CharmapReader
 {
 public:
-    CharmapReader(std::string filename);
+    CharmapReader(std::string filename, const std::string &text);
     CharmapReader(const CharmapReader&) = delete;
     ~CharmapReader();
     Lhs ReadLhs();
@@ -65,31 +67,13 @@ private:
     void SkipWhitespace();
 };
 
-CharmapReader::CharmapReader(std::string filename) : m_filename(filename)
+CharmapReader::CharmapReader(std::string filename, const std::string &text) : m_filename(filename)
 {
-    FILE *fp = std::fopen(filename.c_str(), "rb");
-
-    if (fp == NULL)
-        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
-
-    std::fseek(fp, 0, SEEK_END);
-
-    m_size = std::ftell(fp);
-
-    if (m_size < 0)
-        FATAL_ERROR("File size of \"%s\" is less than zero.\n", filename.c_str());
-
+    m_size = text.length();
     m_buffer = new char[m_size + 1];
-
-    std::rewind(fp);
-
-    if (std::fread(m_buffer, m_size, 1, fp) != 1)
-        FATAL_ERROR("Failed to read \"%s\".\n", filename.c_str());
-
+    std::memcpy(m_buffer, text.data(), m_size);
     m_buffer[m_size] = 0;
 
-    std::fclose(fp);
-
     m_pos = 0;
     m_lineNum = 1;
 
@@ -369,16 +353,105 @@ void CharmapReader::SkipWhitespace()
         m_pos++;
 }
 
-Charmap::Charmap(std::string filename)
+static std::string ReadWholeFile(const std::string &filename)
+{
+    FILE *fp = std::fopen(filename.c_str(), "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
+
+    std::fseek(fp, 0, SEEK_END);
+
+    long size = std::ftell(fp);
+
+    if (size < 0)
+        FATAL_ERROR("File size of \"%s\" is less than zero.\n", filename.c_str());
+
+    std::string text(size, 0);
+
+    std::rewind(fp);
+
+    if (size != 0 && std::fread(&text[0], size, 1, fp) != 1)
+        FATAL_ERROR("Failed to read \"%s\".\n", filename.c_str());
+
+    std::fclose(fp);
+
+    return text;
+}
+
+static std::uint64_t HashText(const std::string &text)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+
+    for (unsigned char c : text)
+        hash = (hash ^ c) * 1099511628211ull;
+
+    return hash;
+}
+
+Charmap::Charmap(std::string filename, std::string cacheFilename)
+{
+    std::string text = ReadWholeFile(filename);
+    std::uint64_t textHash = HashText(text);
+
+    if (!cacheFilename.empty() && LoadCache(cacheFilename, textHash))
+        return;
+
+    Parse(filename, text);
+
+    if (!cacheFilename.empty())
+        SaveCache(cacheFilename, textHash);
+}
+
+std::uint32_t Charmap::AddSequence(CharmapReader &reader, const std::string &sequence)
+{
+    if (sequence.length() > 0xFF)
+        reader.RaiseError("sequence too long (max is 255 bytes)");
+    if (m_data.length() > 0xFFFFFF)
+        reader.RaiseError("charmap too large (max is 16 MiB of sequences)");
+
+    std::uint32_t ref = (m_data.length() << 8) | sequence.length();
+
+    m_data += sequence;
+    return ref;
+}
+
+void Charmap::BuildConstantTable(const std::vector<ConstantSlot> &constants)
 {
-    CharmapReader reader(filename);
+    std::size_t size = 16;
+
+    // Kept at most half full, so that probe sequences stay short.
+    while (size < constants.size() * 2)
+        size *= 2;
+
+    m_constants.assign(size, ConstantSlot{0, 0});
+
+    for (const ConstantSlot &constant : constants)
+    {
+        std::uint32_t i = HashConstant(&m_data[constant.name >> 8], constant.name & 0xFF) & (size - 1);
+
+        while (m_constants[i].value != 0)
+            i = (i + 1) & (size - 1);
+
+        m_constants[i] = constant;
+    }
+}
+
+void Charmap::Parse(const std::string &filename, const std::string &text)
+{
+    CharmapReader reader(filename, text);
+    std::vector<ConstantSlot> constants;
+    std::vector<std::string> constantNames;
+
+    m_directChars.assign(kNumDirectChars, 0);
+    std::memset(m_escapes, 0, sizeof(m_escapes));
 
     for (;;)
     {
         Lhs lhs = reader.ReadLhs();
 
         if (lhs.type == LhsType::None)
-            return;
+            break;
 
         reader.ExpectEqualsSign();
 
@@ -387,22 +460,133 @@ Charmap::Charmap(std::string filename)
         switch (lhs.type)
         {
         case LhsType::Char:
-            if (m_chars.find(lhs.code) != m_chars.end())
+            if (Char(lhs.code).length() != 0)
                 reader.RaiseError("redefining char");
-            m_chars[lhs.code] = sequence;
+            if (lhs.code >= 0 && lhs.code < kNumDirectChars)
+            {
+                m_directChars[lhs.code] = AddSequence(reader, sequence);
+            }
+            else
+            {
+                auto entry = std::make_pair(lhs.code, AddSequence(reader, sequence));
+                m_otherChars.insert(std::lower_bound(m_otherChars.begin(), m_otherChars.end(), entry), entry);
+            }
             break;
         case LhsType::Escape:
-            if (m_escapes[lhs.code].length() != 0)
+            if (m_escapes[lhs.code] != 0)
                 reader.RaiseError("redefining escape");
-            m_escapes[lhs.code] = sequence;
+            m_escapes[lhs.code] = AddSequence(reader, sequence);
             break;
         case LhsType::Constant:
-            if (m_constants.find(lhs.name) != m_constants.end())
+            if (std::find(constantNames.begin(), constantNames.end(), lhs.name) != constantNames.end())
                 reader.RaiseError("redefining constant");
-            m_constants[lhs.name] = sequence;
+            if (lhs.name.length() > 0xFF)
+                reader.RaiseError("constant name too long (max is 255 characters)");
+            constantNames.push_back(lhs.name);
+            constants.push_back(ConstantSlot{AddSequence(reader, lhs.name), AddSequence(reader, sequence)});
             break;
         }
 
         reader.ExpectEmptyRestOfLine();
     }
+
+    BuildConstantTable(constants);
+}
+
+// The compiled charmap is the tables above written out as they are in memory,
+// behind a header identifying the text they were made from.
+static const char kCacheMagic[8] = { 'P', 'P', 'C', 'M', 'A', 'P', '0', '1' };
+
+struct CacheHeader
+{
+    char magic[8];
+    std::uint64_t textHash;
+    std::uint32_t dataLength;
+    std::uint32_t numOtherChars;
+    std::uint32_t numConstantSlots;
+};
+
+template <typename T>
+static bool ReadArray(FILE *fp, T *data, std::size_t count)
+{
+    return count == 0 || std::fread(data, sizeof(T), count, fp) == count;
+}
+
+template <typename T>
+static bool WriteArray(FILE *fp, const T *data, std::size_t count)
+{
+    return count == 0 || std::fwrite(data, sizeof(T), count, fp) == count;
+}
+
+bool Charmap::LoadCache(const std::string &cacheFilename, std::uint64_t textHash)
+{
+    FILE *fp = std::fopen(cacheFilename.c_str(), "rb");
+
+    if (fp == NULL)
+        return false;
+
+    CacheHeader header;
+    bool ok = ReadArray(fp, &header, 1)
+           && std::memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) == 0
+           && header.textHash == textHash;
+
+    if (ok)
+    {
+        m_data.resize(header.dataLength);
+        m_directChars.resize(kNumDirectChars);
+        m_otherChars.resize(header.numOtherChars);
+        m_constants.resize(header.numConstantSlots);
+
+        ok = (header.dataLength == 0 || ReadArray(fp, &m_data[0], header.dataLength))
+          && ReadArray(fp, m_directChars.data(), kNumDirectChars)
+          && ReadArray(fp, m_otherChars.data(), header.numOtherChars)
+          && ReadArray(fp, m_escapes, 128)
+          && ReadArray(fp, m_constants.data(), header.numConstantSlots)
+          && (header.numConstantSlots & (header.numConstantSlots - 1)) == 0
+          && header.numConstantSlots != 0;
+    }
+
+    std::fclose(fp);
+
+    if (!ok)
+    {
+        m_data.clear();
+        m_directChars.clear();
+        m_otherChars.clear();
+        m_constants.clear();
+    }
+
+    return ok;
+}
+
+// Failing to save the cache is not an error, as the charmap is already loaded.
+void Charmap::SaveCache(const std::string &cacheFilename, std::uint64_t textHash)
+{
+    // Written under a unique name and renamed into place, as other
+    // instances may be reading or writing the cache at the same time.
+    std::string tempFilename = cacheFilename + "." + std::to_string(getpid()) + ".tmp";
+    FILE *fp = std::fopen(tempFilename.c_str(), "wb");
+
+    if (fp == NULL)
+        return;
+
+    CacheHeader header;
+    std::memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+    header.textHash = textHash;
+    header.dataLength = m_data.length();
+    header.numOtherChars = m_otherChars.size();
+    header.numConstantSlots = m_constants.size();
+
+    bool ok = WriteArray(fp, &header, 1)
+           && WriteArray(fp, m_data.data(), m_data.length())
+           && WriteArray(fp, m_directChars.data(), m_directChars.size())
+           && WriteArray(fp, m_otherChars.data(), m_otherChars.size())
+           && WriteArray(fp, m_escapes, 128)
+           && WriteArray(fp, m_constants.data(), m_constants.size());
+
+    if (std::fclose(fp) != 0)
+        ok = false;
+
+    if (!ok || std::rename(tempFilename.c_str(), cacheFilename.c_str()) != 0)
+        std::remove(tempFilename.c_str());
 }
@@ -21,44 +21,96 @@
 #ifndef CHARMAP_H
 #define CHARMAP_H
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <string>
-#include <map>
 #include <vector>
 
+class CharmapReader;
+
+// Sequences are kept in one string and looked up by (offset << 8) | length,
+// where a length of 0 means there is no mapping.
 class Charmap
 {
 public:
-    Charmap(std::string filename);
+    // If cacheFilename is not empty, the charmap is loaded from the compiled
+    // form there when it was made from the same text, and saved there if not.
+    Charmap(std::string filename, std::string cacheFilename = std::string());
 
     std::string Char(std::int32_t code)
     {
-        auto it = m_chars.find(code);
+        if (code >= 0 && code < kNumDirectChars)
+            return Sequence(m_directChars[code]);
+
+        auto it = std::lower_bound(m_otherChars.begin(), m_otherChars.end(), std::make_pair(code, (std::uint32_t)0));
 
-        if (it == m_chars.end())
+        if (it == m_otherChars.end() || it->first != code)
             return std::string();
 
-        return it->second;
+        return Sequence(it->second);
     }
 
     std::string Escape(unsigned char code)
     {
-        return m_escapes[code];
+        return Sequence(m_escapes[code]);
     }
 
-    std::string Constant(std::string identifier)
+    std::string Constant(const char *identifier, std::size_t length)
     {
-        auto it = m_constants.find(identifier);
+        std::uint32_t mask = m_constants.size() - 1;
 
-        if (it == m_constants.end())
-            return std::string();
+        for (std::uint32_t i = HashConstant(identifier, length) & mask; m_constants[i].value != 0; i = (i + 1) & mask)
+        {
+            const ConstantSlot &slot = m_constants[i];
+
+            if ((slot.name & 0xFF) == length && std::memcmp(&m_data[slot.name >> 8], identifier, length) == 0)
+                return Sequence(slot.value);
+        }
 
-        return it->second;
+        return std::string();
+    }
+
+    std::string Constant(std::string identifier)
+    {
+        return Constant(identifier.data(), identifier.length());
     }
 private:
-    std::map<std::int32_t, std::string> m_chars;
-    std::string m_escapes[128];
-    std::map<std::string, std::string> m_constants;
+    // Covers ASCII, Latin and kana. Rarer characters, e.g. fullwidth forms, are searched for.
+    static const std::int32_t kNumDirectChars = 0x3100;
+
+    struct ConstantSlot
+    {
+        std::uint32_t name;
+        std::uint32_t value;
+    };
+
+    std::string m_data;
+    std::vector<std::uint32_t> m_directChars;
+    std::vector<std::pair<std::int32_t, std::uint32_t>> m_otherChars;
+    std::uint32_t m_escapes[128];
+    std::vector<ConstantSlot> m_constants;
+
+    std::string Sequence(std::uint32_t ref)
+    {
+        return m_data.substr(ref >> 8, ref & 0xFF);
+    }
+
+    static std::uint32_t HashConstant(const char *identifier, std::size_t length)
+    {
+        std::uint32_t hash = 2166136261u;
+
+        for (std::size_t i = 0; i < length; i++)
+            hash = (hash ^ (unsigned char)identifier[i]) * 16777619u;
+
+        return hash;
+    }
+
+    std::uint32_t AddSequence(CharmapReader &reader, const std::string &sequence);
+    void BuildConstantTable(const std::vector<ConstantSlot> &constants);
+    void Parse(const std::string &filename, const std::string &text);
+    bool LoadCache(const std::string &cacheFilename, std::uint64_t textHash);
+    void SaveCache(const std::string &cacheFilename, std::uint64_t textHash);
 };
 
 #endif // CHARMAP_H
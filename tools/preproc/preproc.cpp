@@ -142,7 +142,7 @@ const char* GetFileExtension(const char* filename)
 
 static void UsageAndExit(const char *program)
 {
-    std::fprintf(stderr, "Usage: %s [-i] [-e] SRC_FILE CHARMAP_FILE\nwhere -i denotes if input is from stdin\n      -e enables enum handling\n", program);
+    std::fprintf(stderr, "Usage: %s [-i] [-e] [-c CACHE_FILE] SRC_FILE CHARMAP_FILE\nwhere -i denotes if input is from stdin\n      -e enables enum handling\n      -c keeps a compiled copy of the charmap in CACHE_FILE\n", program);
     std::exit(EXIT_FAILURE);
 }
 
@@ -151,11 +151,12 @@ int main(int argc, char **argv)
     int opt;
     const char *source = NULL;
     const char *charmap = NULL;
+    const char *charmapCache = "";
     bool isStdin = false;
     bool doEnum = false;
 
-    /* preproc [-i] [-e] SRC_FILE CHARMAP_FILE */
-    while ((opt = getopt(argc, argv, "ie")) != -1)
+    /* preproc [-i] [-e] [-c CACHE_FILE] SRC_FILE CHARMAP_FILE */
+    while ((opt = getopt(argc, argv, "iec:")) != -1)
     {
         switch (opt)
         {
@@ -165,6 +166,9 @@ int main(int argc, char **argv)
         case 'e':
             doEnum = true;
             break;
+        case 'c':
+            charmapCache = optarg;
+            break;
         default:
             UsageAndExit(argv[0]);
             break;
@@ -177,7 +181,7 @@ int main(int argc, char **argv)
     source = argv[optind + 0];
     charmap = argv[optind + 1];
 
-    g_charmap = new Charmap(charmap);
+    g_charmap = new Charmap(charmap, charmapCache);
 
     const char* extension = GetFileExtension(source);
 
@@ -113,7 +113,7 @@ std::string StringParser::ReadBracketedConstants()
             while (IsIdentifierChar(m_buffer[m_pos]))
                 m_pos++;
 
-            std::string sequence = g_charmap->Constant(std::string(&m_buffer[startPos], m_pos - startPos));
+            std::string sequence = g_charmap->Constant(&m_buffer[startPos], m_pos - startPos);
 
             if (sequence.length() == 0)
             {
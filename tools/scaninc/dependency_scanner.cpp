@@ -0,0 +1,205 @@
+#include <sys/stat.h>
+#include <cstdio>
+#include <fstream>
+#include <queue>
+#include "scaninc.h"
+#include "source_file.h"
+#include "dependency_scanner.h"
+
+static const char *const CACHE_HEADER = "scaninc cache 1";
+
+bool GetFileStamp(const std::string &path, FileStamp &stamp)
+{
+    struct stat st;
+
+    if (stat(path.c_str(), &st) != 0)
+        return false;
+
+#if defined(__APPLE__)
+    stamp.mtime = (long long)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#elif defined(__linux__) || defined(__CYGWIN__)
+    stamp.mtime = (long long)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#else
+    stamp.mtime = (long long)st.st_mtime * 1000000000;
+#endif
+    stamp.size = st.st_size;
+    return true;
+}
+
+DependencyScanner::DependencyScanner(const std::vector<std::string> &includeDirs)
+    : m_includeDirs(includeDirs), m_cacheDirty(false)
+{
+}
+
+bool DependencyScanner::GetStamp(const std::string &path, FileStamp &stamp)
+{
+    auto it = m_stamps.find(path);
+
+    if (it == m_stamps.end())
+    {
+        FileStamp newStamp;
+        if (!GetFileStamp(path, newStamp))
+            newStamp = FileStamp{0, -1};
+        it = m_stamps.emplace(path, newStamp).first;
+    }
+
+    stamp = it->second;
+    return stamp.size >= 0;
+}
+
+void DependencyScanner::LoadCache(const std::string &path)
+{
+    std::ifstream input(path);
+    std::string line;
+
+    if (!input || !std::getline(input, line) || line != CACHE_HEADER)
+        return;
+
+    // Each entry is "path\tmtime\tsize\tincludes\tincbins", followed by
+    // one line per include and then one per incbin.
+    while (std::getline(input, line))
+    {
+        ScannedFile file;
+        char *end;
+        std::size_t tab = line.find('\t');
+
+        if (tab == std::string::npos)
+            break;
+
+        std::string filePath = line.substr(0, tab);
+        const char *fields = line.c_str() + tab + 1;
+        file.stamp.mtime = std::strtoll(fields, &end, 10);
+        file.stamp.size = std::strtoll(end, &end, 10);
+        long numIncludes = std::strtol(end, &end, 10);
+        long numIncbins = std::strtol(end, &end, 10);
+
+        for (long i = 0; i < numIncludes && std::getline(input, line); i++)
+            file.includes.push_back(line);
+        for (long i = 0; i < numIncbins && std::getline(input, line); i++)
+            file.incbins.push_back(line);
+
+        if ((long)file.includes.size() != numIncludes || (long)file.incbins.size() != numIncbins)
+            break;
+
+        m_scannedFiles[filePath] = std::move(file);
+    }
+}
+
+void DependencyScanner::SaveCache(const std::string &path)
+{
+    if (!m_cacheDirty)
+        return;
+
+    // Written under a temporary name and renamed, so that a concurrent or
+    // interrupted run never leaves a truncated cache behind.
+    std::string tempPath = path + ".tmp";
+    std::ofstream output(tempPath);
+
+    if (!output)
+        return;
+
+    output << CACHE_HEADER << '\n';
+    for (const auto &entry : m_scannedFiles)
+    {
+        const ScannedFile &file = entry.second;
+        output << entry.first << '\t' << file.stamp.mtime << '\t' << file.stamp.size
+               << '\t' << file.includes.size() << '\t' << file.incbins.size() << '\n';
+        for (const std::string &include : file.includes)
+            output << include << '\n';
+        for (const std::string &incbin : file.incbins)
+            output << incbin << '\n';
+    }
+
+    output.close();
+    if (output.fail() || std::rename(tempPath.c_str(), path.c_str()) != 0)
+        std::remove(tempPath.c_str());
+}
+
+const DependencyScanner::ScannedFile &DependencyScanner::GetScannedFile(const std::string &path)
+{
+    FileStamp stamp;
+    auto it = m_scannedFiles.find(path);
+
+    GetStamp(path, stamp);
+    if (it != m_scannedFiles.end() && it->second.stamp == stamp)
+        return it->second;
+
+    SourceFile source(path);
+    ScannedFile &file = m_scannedFiles[path];
+
+    file.stamp = stamp;
+    file.includes.assign(source.GetIncludes().begin(), source.GetIncludes().end());
+    file.incbins.assign(source.GetIncbins().begin(), source.GetIncbins().end());
+    m_cacheDirty = true;
+    return file;
+}
+
+// Includes are looked up in the include directories, then next to the
+// including file, then (for asm) relative to the working directory.
+const DependencyScanner::ResolvedFile &DependencyScanner::GetResolvedFile(const std::string &path)
+{
+    auto it = m_resolvedFiles.find(path);
+
+    if (it != m_resolvedFiles.end())
+        return it->second;
+
+    std::string pathCopy(path);
+    SourceFileType fileType = GetFileType(pathCopy);
+    std::string srcDir = GetDir(pathCopy);
+    ResolvedFile resolved;
+    FileStamp stamp;
+
+    resolved.scanned = &GetScannedFile(path);
+    for (const std::string &include : resolved.scanned->includes)
+    {
+        bool exists = false;
+        std::string includePath;
+
+        for (const std::string &includeDir : m_includeDirs)
+        {
+            includePath = includeDir + include;
+            if (GetStamp(includePath, stamp))
+            {
+                exists = true;
+                break;
+            }
+        }
+        if (!exists)
+        {
+            includePath = srcDir + include;
+            exists = GetStamp(includePath, stamp);
+        }
+        if (!exists && (fileType == SourceFileType::Asm || fileType == SourceFileType::Inc))
+        {
+            includePath = include;
+            exists = GetStamp(includePath, stamp);
+        }
+        if (exists)
+            resolved.includes.push_back(includePath);
+    }
+
+    return m_resolvedFiles.emplace(path, std::move(resolved)).first->second;
+}
+
+void DependencyScanner::Scan(const std::string &path, std::set<std::string> &dependencies, std::set<std::string> &dependencies_includes)
+{
+    std::queue<std::string> filesToProcess;
+
+    filesToProcess.push(path);
+
+    while (!filesToProcess.empty())
+    {
+        const ResolvedFile &file = GetResolvedFile(filesToProcess.front());
+        filesToProcess.pop();
+
+        for (const std::string &incbin : file.scanned->incbins)
+            dependencies.insert(incbin);
+
+        for (const std::string &include : file.includes)
+        {
+            dependencies_includes.insert(include);
+            if (dependencies.insert(include).second)
+                filesToProcess.push(include);
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef DEPENDENCY_SCANNER_H
+#define DEPENDENCY_SCANNER_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct FileStamp
+{
+    long long mtime;
+    long long size;
+
+    bool operator ==(const FileStamp &other) const { return mtime == other.mtime && size == other.size; }
+};
+
+bool GetFileStamp(const std::string &path, FileStamp &stamp);
+
+// Finds the includes and incbins of source files, following includes
+// transitively. Every file is parsed at most once per scanner, and the
+// results can be kept in a cache file between runs, so that scanning a
+// whole tree only reparses the files which were modified since.
+class DependencyScanner
+{
+public:
+    DependencyScanner(const std::vector<std::string> &includeDirs);
+    void LoadCache(const std::string &path);
+    void SaveCache(const std::string &path);
+    void Scan(const std::string &path, std::set<std::string> &dependencies, std::set<std::string> &dependencies_includes);
+    bool GetStamp(const std::string &path, FileStamp &stamp);
+
+private:
+    struct ScannedFile
+    {
+        FileStamp stamp;
+        std::vector<std::string> includes;
+        std::vector<std::string> incbins;
+    };
+
+    struct ResolvedFile
+    {
+        const ScannedFile *scanned;
+        std::vector<std::string> includes;
+    };
+
+    std::vector<std::string> m_includeDirs;
+    std::map<std::string, ScannedFile> m_scannedFiles;
+    std::unordered_map<std::string, ResolvedFile> m_resolvedFiles;
+    // A stamp with a negative size means the file does not exist.
+    std::unordered_map<std::string, FileStamp> m_stamps;
+    bool m_cacheDirty;
+
+    const ScannedFile &GetScannedFile(const std::string &path);
+    const ResolvedFile &GetResolvedFile(const std::string &path);
+};
+
+#endif // DEPENDENCY_SCANNER_H
@@ -20,44 +20,110 @@
 
 #include <cstdio>
 #include <cstdlib>
-#include <list>
-#include <queue>
 #include <set>
 #include <string>
 #include <iostream>
-#include <tuple>
 #include <fstream>
+#include <sstream>
 #include "scaninc.h"
-#include "source_file.h"
+#include "dependency_scanner.h"
 
-bool CanOpenFile(std::string path)
+const char *const USAGE =
+    "Usage: scaninc [-I INCLUDE_PATH] [-C CACHE_PATH] [-M DEPENDENCY_OUT_PATH] FILE_PATH\n"
+    "       scaninc [-I INCLUDE_PATH] [-C CACHE_PATH] -D DEPENDENCY_DIR FILE_PATH...\n"
+    "\n"
+    "With -D, the dependencies of every FILE_PATH are written to\n"
+    "DEPENDENCY_DIR/FILE_PATH with its extension replaced by \".d\".\n";
+
+static std::string FormatMakeRules(const std::string &make_outfile, const std::set<std::string> &dependencies, const std::set<std::string> &dependencies_includes)
+{
+    std::ostringstream output;
+
+    // Print a make rule for the object file
+    size_t ext_pos = make_outfile.find_last_of(".");
+    auto object_file = make_outfile.substr(0, ext_pos + 1) + "o";
+    output << object_file.c_str() << ":";
+    for (const std::string &path : dependencies)
+    {
+        output << " " << path;
+    }
+    output << '\n';
+
+    // Dependency list rule.
+    // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
+    output << make_outfile.c_str() << ":";
+    for (const std::string &path : dependencies_includes)
+    {
+        output << " " << path;
+    }
+    output << '\n';
+
+    // Dummy rules
+    // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
+    for (const std::string &path : dependencies)
+    {
+        output << path << ":\n";
+    }
+
+    return output.str();
+}
+
+static void WriteFile(const std::string &path, const std::string &contents)
 {
-    FILE *fp = std::fopen(path.c_str(), "rb");
+    std::ofstream output(path, std::ios::binary);
 
-    if (fp == NULL)
+    if (!output)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", path.c_str());
+
+    output << contents;
+    output.close();
+}
+
+static bool FileHasContents(const std::string &path, const std::string &contents)
+{
+    std::ifstream input(path, std::ios::binary);
+
+    if (!input)
         return false;
 
-    std::fclose(fp);
-    return true;
+    std::ostringstream existing;
+    existing << input.rdbuf();
+    return existing.str() == contents;
 }
 
-const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_PATH] FILE_PATH\n";
+// A dependency file is rewritten if its rules changed, or if make would
+// otherwise consider it out of date and rescan the source on its own.
+static bool IsDependencyFileCurrent(DependencyScanner &scanner, const std::string &make_outfile, const std::string &contents, const std::string &sourcePath, const std::set<std::string> &dependencies_includes)
+{
+    FileStamp outStamp, stamp;
+
+    if (!GetFileStamp(make_outfile, outStamp) || !FileHasContents(make_outfile, contents))
+        return false;
+
+    if (scanner.GetStamp(sourcePath, stamp) && stamp.mtime > outStamp.mtime)
+        return false;
+    for (const std::string &path : dependencies_includes)
+    {
+        if (scanner.GetStamp(path, stamp) && stamp.mtime > outStamp.mtime)
+            return false;
+    }
+
+    return true;
+}
 
 int main(int argc, char **argv)
 {
-    std::queue<std::string> filesToProcess;
-    std::set<std::string> dependencies;
-    std::set<std::string> dependencies_includes;
-
     std::vector<std::string> includeDirs;
 
     bool makeformat = false;
     std::string make_outfile;
+    std::string cachePath;
+    std::string dependencyDir;
 
     argc--;
     argv++;
 
-    while (argc > 1)
+    while (argc > 1 && argv[0][0] == '-')
     {
         std::string arg(argv[0]);
         if (arg.substr(0, 2) == "-I")
@@ -82,6 +148,20 @@ int main(int argc, char **argv)
             argv++;
             make_outfile = std::string(argv[0]);
         }
+        else if (arg == "-C")
+        {
+            argc--;
+            argv++;
+            cachePath = std::string(argv[0]);
+        }
+        else if (arg == "-D")
+        {
+            argc--;
+            argv++;
+            dependencyDir = std::string(argv[0]);
+            if (!dependencyDir.empty() && dependencyDir.back() != '/')
+                dependencyDir += '/';
+        }
         else
         {
             FATAL_ERROR(USAGE);
@@ -90,97 +170,54 @@ int main(int argc, char **argv)
         argv++;
     }
 
-    if (argc != 1) {
+    if (dependencyDir.empty() ? argc != 1 : (argc < 1 || makeformat)) {
         FATAL_ERROR(USAGE);
     }
 
-    std::string initialPath(argv[0]);
+    DependencyScanner scanner(includeDirs);
 
-    filesToProcess.push(initialPath);
+    if (!cachePath.empty())
+        scanner.LoadCache(cachePath);
 
-    while (!filesToProcess.empty())
+    if (!dependencyDir.empty())
     {
-        std::string filePath = filesToProcess.front();
-        SourceFile file(filePath);
-        filesToProcess.pop();
-
-        includeDirs.push_back(file.GetSrcDir());
-        for (auto incbin : file.GetIncbins())
-        {
-            dependencies.insert(incbin);
-        }
-        for (auto include : file.GetIncludes())
+        for (int i = 0; i < argc; i++)
         {
-            bool exists = false;
-            std::string path("");
-            for (auto includeDir : includeDirs)
-            {
-                path = includeDir + include;
-                if (CanOpenFile(path))
-                {
-                    exists = true;
-                    break;
-                }
-            }
-            if (!exists && (file.FileType() == SourceFileType::Asm || file.FileType() == SourceFileType::Inc))
-            {
-                path = include;
-                if (CanOpenFile(path))
-                    exists = true;
-            }
-            if (!exists)
-                continue;
+            std::string sourcePath(argv[i]);
+            std::set<std::string> dependencies;
+            std::set<std::string> dependencies_includes;
 
-            dependencies_includes.insert(path);
-            bool inserted = dependencies.insert(path).second;
-            if (inserted && exists)
-            {
-                filesToProcess.push(path);
-            }
-        }
-        includeDirs.pop_back();
-    }
+            scanner.Scan(sourcePath, dependencies, dependencies_includes);
 
-    if(!makeformat)
-    {
-        for (const std::string &path : dependencies)
-        {
-            std::printf("%s\n", path.c_str());
+            make_outfile = dependencyDir + sourcePath.substr(0, sourcePath.find_last_of('.')) + ".d";
+            std::string contents = FormatMakeRules(make_outfile, dependencies, dependencies_includes);
+            if (!IsDependencyFileCurrent(scanner, make_outfile, contents, sourcePath, dependencies_includes))
+                WriteFile(make_outfile, contents);
         }
-        std::cout << std::endl;
     }
     else
     {
-        // Write out make rules to a file
-        std::ofstream output(make_outfile);
-
-        // Print a make rule for the object file
-        size_t ext_pos = make_outfile.find_last_of(".");
-        auto object_file = make_outfile.substr(0, ext_pos + 1) + "o";
-        output << object_file.c_str() << ":";
-        for (const std::string &path : dependencies)
-        {
-            output << " " << path;
-        }
-        output << '\n';
+        std::string initialPath(argv[0]);
+        std::set<std::string> dependencies;
+        std::set<std::string> dependencies_includes;
 
-        // Dependency list rule.
-        // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
-        output << make_outfile.c_str() << ":";
-        for (const std::string &path : dependencies_includes)
+        scanner.Scan(initialPath, dependencies, dependencies_includes);
+
+        if(!makeformat)
         {
-            output << " " << path;
+            for (const std::string &path : dependencies)
+            {
+                std::printf("%s\n", path.c_str());
+            }
+            std::cout << std::endl;
         }
-        output << '\n';
-
-        // Dummy rules
-        // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
-        for (const std::string &path : dependencies)
+        else
         {
-            output << path << ":\n";
+            // Write out make rules to a file
+            WriteFile(make_outfile, FormatMakeRules(make_outfile, dependencies, dependencies_includes));
         }
-
-        output.flush();
-        output.close();
     }
+
+    if (!cachePath.empty())
+        scanner.SaveCache(cachePath);
 }
@@ -1592,7 +1592,167 @@ static void fprint_species(FILE *f, const char *prefix, struct String s)
     }
 }
 
-static void fprint_trainers(const char *output_path, FILE *f, struct Parsed *parsed)
+static void fprint_party_name(FILE *f, struct Trainer *trainer)
+{
+    fprintf(f, "gTrainerParty_");
+    fprint_string(f, trainer->id);
+}
+
+static void fprint_party(FILE *f, struct Trainer *trainer)
+{
+    for (int j = 0; j < trainer->pokemon_n; j++)
+    {
+        struct Pokemon *pokemon = &trainer->pokemon[j];
+        fprintf(f, "            {\n");
+
+        if (!is_empty_string(pokemon->nickname))
+        {
+            fprintf(f, "#line %d\n", pokemon->header_line);
+            fprintf(f, "            .nickname = COMPOUND_STRING(\"");
+            fprint_string(f, pokemon->nickname);
+            fprintf(f, "\"),\n");
+        }
+
+        fprintf(f, "#line %d\n", pokemon->header_line);
+        fprintf(f, "            .species = ");
+        fprint_species(f, "SPECIES", pokemon->species);
+        fprintf(f, ",\n");
+
+        switch (pokemon->gender)
+        {
+        case GENDER_ANY:
+            fprintf(f, "            .gender = TRAINER_MON_RANDOM_GENDER,\n");
+            break;
+        case GENDER_MALE:
+            fprintf(f, "#line %d\n", pokemon->header_line);
+            fprintf(f, "            .gender = TRAINER_MON_MALE,\n");
+            break;
+        case GENDER_FEMALE:
+            fprintf(f, "#line %d\n", pokemon->header_line);
+            fprintf(f, "            .gender = TRAINER_MON_FEMALE,\n");
+            break;
+        }
+
+        if (!is_empty_string(pokemon->item))
+        {
+            fprintf(f, "#line %d\n", pokemon->header_line);
+            fprintf(f, "            .heldItem = ");
+            fprint_constant(f, "ITEM", pokemon->item);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->evs_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->evs_line);
+            fprintf(f, "            .ev = ");
+            fprint_stats(f, "TRAINER_PARTY_EVS", pokemon->evs);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->ivs_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->ivs_line);
+            fprintf(f, "            .iv = ");
+            fprint_stats(f, "TRAINER_PARTY_IVS", pokemon->ivs);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->ability_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->ability_line);
+            fprintf(f, "            .ability = ");
+            fprint_constant(f, "ABILITY", pokemon->ability);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->level_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->level_line);
+            fprintf(f, "            .lvl = %d,\n", pokemon->level);
+        }
+
+        if (pokemon->ball_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->ball_line);
+            fprintf(f, "            .ball = ");
+            fprint_constant(f, "ITEM", pokemon->ball);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->friendship_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->friendship_line);
+            fprintf(f, "            .friendship = %d,\n", pokemon->friendship);
+        }
+
+        if (pokemon->nature_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->nature_line);
+            fprintf(f, "            .nature = ");
+            fprint_constant(f, "NATURE", pokemon->nature);
+            fprintf(f, ",\n");
+        }
+        else
+        {
+            fprintf(f, "            .nature = NATURE_HARDY,\n");
+        }
+
+        if (pokemon->shiny_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->shiny_line);
+            fprintf(f, "            .isShiny = ");
+            fprint_bool(f, pokemon->shiny);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->dynamax_level_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->dynamax_level_line);
+            fprintf(f, "            .dynamaxLevel = %d,\n", pokemon->dynamax_level);
+        }
+        else
+        {
+            fprintf(f, "            .dynamaxLevel = MAX_DYNAMAX_LEVEL,\n");
+        }
+
+        if (pokemon->gigantamax_factor_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->gigantamax_factor_line);
+            fprintf(f, "            .gigantamaxFactor = ");
+            fprint_bool(f, pokemon->gigantamax_factor);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->dynamax_level_line || pokemon->gigantamax_factor_line)
+        {
+            fprintf(f, "            .shouldUseDynamax = TRUE,\n");
+        }
+        else if (pokemon->tera_type_line)
+        {
+            fprintf(f, "#line %d\n", pokemon->tera_type_line);
+            fprintf(f, "            .teraType = ");
+            fprint_constant(f, "TYPE", pokemon->tera_type);
+            fprintf(f, ",\n");
+        }
+
+        if (pokemon->moves_n > 0)
+        {
+            fprintf(f, "            .moves = {\n");
+            fprintf(f, "#line %d\n", pokemon->move1_line);
+            for (int k = 0; k < pokemon->moves_n; k++)
+            {
+                fprintf(f, "                ");
+                fprint_constant(f, "MOVE", pokemon->moves[k]);
+                fprintf(f, ",\n");
+            }
+            fprintf(f, "            },\n");
+        }
+
+        fprintf(f, "            },\n");
+    }
+}
+
+static void fprint_trainers(const char *output_path, FILE *f, struct Parsed *parsed, int party_shards_n)
 {
     fprintf(f, "//\n");
     fprintf(f, "// DO NOT MODIFY THIS FILE! It is auto-generated from %s\n", parsed->source->path);
@@ -1712,166 +1872,166 @@ static void fprint_trainers(const char *output_path, FILE *f, struct Parsed *par
         }
 
         fprintf(f, "        .partySize = %d,\n", trainer->pokemon_n);
-        fprintf(f, "        .party = (const struct TrainerMon[])\n");
-        fprintf(f, "        {\n");
-        for (int j = 0; j < trainer->pokemon_n; j++)
+        if (party_shards_n > 0 && trainer->pokemon_n > 0)
         {
-            struct Pokemon *pokemon = &trainer->pokemon[j];
-            fprintf(f, "            {\n");
-
-            if (!is_empty_string(pokemon->nickname))
-            {
-                fprintf(f, "#line %d\n", pokemon->header_line);
-                fprintf(f, "            .nickname = COMPOUND_STRING(\"");
-                fprint_string(f, pokemon->nickname);
-                fprintf(f, "\"),\n");
-            }
-
-            fprintf(f, "#line %d\n", pokemon->header_line);
-            fprintf(f, "            .species = ");
-            fprint_species(f, "SPECIES", pokemon->species);
+            fprintf(f, "        .party = ");
+            fprint_party_name(f, trainer);
             fprintf(f, ",\n");
+        }
+        else
+        {
+            fprintf(f, "        .party = (const struct TrainerMon[])\n");
+            fprintf(f, "        {\n");
+            fprint_party(f, trainer);
+            fprintf(f, "        },\n");
+        }
+        fprintf(f, "    },\n");
+    }
+}
 
-            switch (pokemon->gender)
-            {
-            case GENDER_ANY:
-                fprintf(f, "            .gender = TRAINER_MON_RANDOM_GENDER,\n");
-                break;
-            case GENDER_MALE:
-                fprintf(f, "#line %d\n", pokemon->header_line);
-                fprintf(f, "            .gender = TRAINER_MON_MALE,\n");
-                break;
-            case GENDER_FEMALE:
-                fprintf(f, "#line %d\n", pokemon->header_line);
-                fprintf(f, "            .gender = TRAINER_MON_FEMALE,\n");
-                break;
-            }
+/* FNV-1a, so that adding or removing a trainer only changes its own shard. */
+static int party_shard(struct String id, int party_shards_n)
+{
+    unsigned hash = 2166136261u;
+    for (int i = 0; i < id.string_n; i++)
+        hash = (hash ^ id.string[i]) * 16777619u;
+    return hash % party_shards_n;
+}
 
-            if (!is_empty_string(pokemon->item))
-            {
-                fprintf(f, "#line %d\n", pokemon->header_line);
-                fprintf(f, "            .heldItem = ");
-                fprint_constant(f, "ITEM", pokemon->item);
-                fprintf(f, ",\n");
-            }
+static void fprint_party_declarations(FILE *f, struct Parsed *parsed)
+{
+    fprintf(f, "//\n");
+    fprintf(f, "// DO NOT MODIFY THIS FILE! It is auto-generated from %s\n", parsed->source->path);
+    fprintf(f, "//\n");
+    fprintf(f, "\n");
 
-            if (pokemon->evs_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->evs_line);
-                fprintf(f, "            .ev = ");
-                fprint_stats(f, "TRAINER_PARTY_EVS", pokemon->evs);
-                fprintf(f, ",\n");
-            }
+    for (int i = 0; i < parsed->trainers_n; i++)
+    {
+        struct Trainer *trainer = &parsed->trainers[i];
+        if (trainer->pokemon_n == 0)
+            continue;
+        fprintf(f, "extern const struct TrainerMon ");
+        fprint_party_name(f, trainer);
+        fprintf(f, "[];\n");
+    }
+}
 
-            if (pokemon->ivs_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->ivs_line);
-                fprintf(f, "            .iv = ");
-                fprint_stats(f, "TRAINER_PARTY_IVS", pokemon->ivs);
-                fprintf(f, ",\n");
-            }
+static void fprint_party_shard(const char *output_path, FILE *f, struct Parsed *parsed, const char *declarations_name, int shard, int party_shards_n)
+{
+    fprintf(f, "//\n");
+    fprintf(f, "// DO NOT MODIFY THIS FILE! It is auto-generated from %s\n", parsed->source->path);
+    fprintf(f, "//\n");
+    fprintf(f, "// Use sed -i '/^#line/d' '%s' to remove #line markers.\n", output_path);
+    fprintf(f, "//\n");
+    fprintf(f, "\n");
 
-            if (pokemon->ability_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->ability_line);
-                fprintf(f, "            .ability = ");
-                fprint_constant(f, "ABILITY", pokemon->ability);
-                fprintf(f, ",\n");
-            }
+    fprintf(f, "#include \"global.h\"\n");
+    fprintf(f, "#include \"data.h\"\n");
+    fprintf(f, "#include \"constants/abilities.h\"\n");
+    fprintf(f, "#include \"constants/items.h\"\n");
+    fprintf(f, "#include \"constants/moves.h\"\n");
+    fprintf(f, "#include \"%s\"\n", declarations_name);
+    fprintf(f, "\n");
 
-            if (pokemon->level_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->level_line);
-                fprintf(f, "            .lvl = %d,\n", pokemon->level);
-            }
+    fprintf(f, "#line 1 \"%s\"\n", parsed->source->path);
+    fprintf(f, "\n");
 
-            if (pokemon->ball_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->ball_line);
-                fprintf(f, "            .ball = ");
-                fprint_constant(f, "ITEM", pokemon->ball);
-                fprintf(f, ",\n");
-            }
+    for (int i = 0; i < parsed->trainers_n; i++)
+    {
+        struct Trainer *trainer = &parsed->trainers[i];
+        if (trainer->pokemon_n == 0 || party_shard(trainer->id, party_shards_n) != shard)
+            continue;
+        fprintf(f, "#line %d\n", trainer->id_line);
+        fprintf(f, "const struct TrainerMon ");
+        fprint_party_name(f, trainer);
+        fprintf(f, "[] =\n");
+        fprintf(f, "{\n");
+        fprint_party(f, trainer);
+        fprintf(f, "};\n");
+    }
+}
 
-            if (pokemon->friendship_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->friendship_line);
-                fprintf(f, "            .friendship = %d,\n", pokemon->friendship);
-            }
+static bool files_equal(const char *path1, const char *path2)
+{
+    bool equal = false;
+    FILE *file1 = fopen(path1, "rb");
+    FILE *file2 = fopen(path2, "rb");
 
-            if (pokemon->nature_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->nature_line);
-                fprintf(f, "            .nature = ");
-                fprint_constant(f, "NATURE", pokemon->nature);
-                fprintf(f, ",\n");
-            }
-            else
-            {
-                fprintf(f, "            .nature = NATURE_HARDY,\n");
-            }
+    if (file1 && file2)
+    {
+        char buffer1[4096], buffer2[4096];
+        size_t n1, n2;
+        do
+        {
+            n1 = fread(buffer1, 1, sizeof(buffer1), file1);
+            n2 = fread(buffer2, 1, sizeof(buffer2), file2);
+        } while (n1 == n2 && n1 > 0 && memcmp(buffer1, buffer2, n1) == 0);
+        equal = n1 == 0 && n2 == 0;
+    }
 
-            if (pokemon->shiny_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->shiny_line);
-                fprintf(f, "            .isShiny = ");
-                fprint_bool(f, pokemon->shiny);
-                fprintf(f, ",\n");
-            }
+    if (file1) fclose(file1);
+    if (file2) fclose(file2);
+    return equal;
+}
 
-            if (pokemon->dynamax_level_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->dynamax_level_line);
-                fprintf(f, "            .dynamaxLevel = %d,\n", pokemon->dynamax_level);
-            }
-            else
-            {
-                fprintf(f, "            .dynamaxLevel = MAX_DYNAMAX_LEVEL,\n");
-            }
+/* Moves 'temp_path' over 'path' unless they have the same contents, so
+ * that make does not recompile everything which includes 'path'. */
+static bool replace_if_changed(const char *temp_path, const char *path)
+{
+    if (files_equal(temp_path, path))
+    {
+        remove(temp_path);
+        return true;
+    }
 
-            if (pokemon->gigantamax_factor_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->gigantamax_factor_line);
-                fprintf(f, "            .gigantamaxFactor = ");
-                fprint_bool(f, pokemon->gigantamax_factor);
-                fprintf(f, ",\n");
-            }
+#ifdef _WIN32
+    remove(path); // rename does not replace files on Windows.
+#endif
+    if (rename(temp_path, path) != 0)
+    {
+        fprintf(stderr, "could not replace '%s'\n", path);
+        remove(temp_path);
+        return false;
+    }
+    return true;
+}
 
-            if (pokemon->dynamax_level_line || pokemon->gigantamax_factor_line)
-            {
-                fprintf(f, "            .shouldUseDynamax = TRUE,\n");
-            }
-            else if (pokemon->tera_type_line)
-            {
-                fprintf(f, "#line %d\n", pokemon->tera_type_line);
-                fprintf(f, "            .teraType = ");
-                fprint_constant(f, "TYPE", pokemon->tera_type);
-                fprintf(f, ",\n");
-            }
+/* Output goes to a temporary file, which 'close_output' moves over 'path'
+ * if its contents changed. */
+static FILE *open_output(const char *path, char **temp_path)
+{
+    FILE *file;
 
-            if (pokemon->moves_n > 0)
-            {
-                fprintf(f, "            .moves = {\n");
-                fprintf(f, "#line %d\n", pokemon->move1_line);
-                for (int k = 0; k < pokemon->moves_n; k++)
-                {
-                    fprintf(f, "                ");
-                    fprint_constant(f, "MOVE", pokemon->moves[k]);
-                    fprintf(f, ",\n");
-                }
-                fprintf(f, "            },\n");
-            }
+    if (!(*temp_path = malloc(strlen(path) + sizeof(".tmp"))))
+    {
+        fprintf(stderr, "could not allocate %zu bytes\n", strlen(path) + sizeof(".tmp"));
+        return NULL;
+    }
+    strcpy(*temp_path, path);
+    strcat(*temp_path, ".tmp");
 
-            fprintf(f, "            },\n");
-        }
-        fprintf(f, "        },\n");
-        fprintf(f, "    },\n");
+    if (!(file = fopen(*temp_path, "w")))
+    {
+        fprintf(stderr, "could not open '%s' for writing\n", *temp_path);
+        free(*temp_path);
+        *temp_path = NULL;
     }
+    return file;
+}
+
+static bool close_output(FILE *file, char *temp_path, const char *path)
+{
+    bool ok = fclose(file) == 0 && replace_if_changed(temp_path, path);
+    free(temp_path);
+    return ok;
 }
 
 static void usage(FILE *file, char *argv0)
 {
-    fprintf(file, "Usage: %s -o <output> <source>\n", argv0);
+    fprintf(file, "Usage: %s -o <output> [-d <party declarations> -s <shards>] <source>\n", argv0);
+    fprintf(file, "\n");
+    fprintf(file, "With -d, parties are defined in <shards> separately compiled files named\n");
+    fprintf(file, "after <party declarations>, e.g. trainer_parties_0.c for trainer_parties.h.\n");
 }
 
 int main(int argc, char *argv[])
@@ -1888,18 +2048,27 @@ int main(int argc, char *argv[])
     const char *source_path = NULL;
     const char *output_path = NULL;
     const char *real_source_path = NULL;
+    const char *declarations_path = NULL;
+    char *temp_output_path = NULL;
+    int party_shards_n = 0;
 
     int opt;
-    while ((opt = getopt(argc, argv, "i:o:")) != -1)
+    while ((opt = getopt(argc, argv, "d:i:o:s:")) != -1)
     {
         switch (opt)
         {
+        case 'd':
+            declarations_path = optarg;
+            break;
         case 'i':
             real_source_path = optarg;
             break;
         case 'o':
             output_path = optarg;
             break;
+        case 's':
+            party_shards_n = atoi(optarg);
+            break;
         default:
             fprintf(stderr, "unknown option '%c'\n", opt);
             usage(stderr, argv[0]);
@@ -1907,7 +2076,7 @@ int main(int argc, char *argv[])
         }
     }
 
-    if (!output_path)
+    if (!output_path || (declarations_path != NULL) != (party_shards_n > 0))
     {
         usage(stderr, argv[0]);
         goto exit;
@@ -1998,14 +2167,47 @@ int main(int argc, char *argv[])
     }
     else
     {
-        output_file = fopen(output_path, "w");
-        if (output_file == NULL)
-        {
-            fprintf(stderr, "could not open '%s' for writing\n", output_path);
+        if (!(output_file = open_output(output_path, &temp_output_path)))
             goto exit;
+    }
+    fprint_trainers(output_path, output_file, &parsed, party_shards_n);
+
+    if (temp_output_path)
+    {
+        FILE *file = output_file;
+        output_file = NULL;
+        if (!close_output(file, temp_output_path, output_path))
+            goto exit;
+    }
+
+    if (declarations_path)
+    {
+        const char *slash = strrchr(declarations_path, '/');
+        const char *declarations_name = slash ? slash + 1 : declarations_path;
+        size_t stem_n = strlen(declarations_path);
+        char shard_path[4096];
+        char *temp_path;
+        FILE *file;
+
+        if (stem_n > 2 && strcmp(&declarations_path[stem_n - 2], ".h") == 0)
+            stem_n -= 2;
+
+        if (!(file = open_output(declarations_path, &temp_path)))
+            goto exit;
+        fprint_party_declarations(file, &parsed);
+        if (!close_output(file, temp_path, declarations_path))
+            goto exit;
+
+        for (int shard = 0; shard < party_shards_n; shard++)
+        {
+            snprintf(shard_path, sizeof(shard_path), "%.*s_%d.c", (int)stem_n, declarations_path, shard);
+            if (!(file = open_output(shard_path, &temp_path)))
+                goto exit;
+            fprint_party_shard(shard_path, file, &parsed, declarations_name, shard, party_shards_n);
+            if (!close_output(file, temp_path, shard_path))
+                goto exit;
         }
     }
-    fprint_trainers(output_path, output_file, &parsed);
 
     status = 0;
 